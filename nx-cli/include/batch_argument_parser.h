@@ -33,7 +33,7 @@ public:
     /**
      * Parse arguments for batch validate operation
      * Requires: --file <path>
-     * Optional: --json
+     * Optional: --json, --max-errors <n>
      */
     static BatchParseResult parse_validate_args(const std::vector<std::string>& args, BatchValidateRequest& request);
     
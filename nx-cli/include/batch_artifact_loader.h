@@ -1,7 +1,12 @@
 #pragma once
 
 #include "cli_types.h"
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <optional>
@@ -24,6 +29,20 @@ struct BatchPlanArtifact {
     std::map<std::string, size_t> execution_order;  // job_id -> order
 };
 
+// Per-job plan summary for job listings
+struct BatchJobSummary {
+    std::string job_id;
+    std::string job_type;
+    size_t execution_order;
+    size_t dependency_count;
+    size_t dependent_count;  // Jobs that list this job as a dependency
+};
+
+struct BatchJobSummaries {
+    std::string batch_id;
+    std::vector<BatchJobSummary> jobs;
+};
+
 // Execution State Data Structures
 struct JobExecutionState {
     std::string job_id;
@@ -69,8 +88,72 @@ struct BatchArtifactIndex {
     std::vector<ArtifactMetadata> artifacts;
 };
 
+class BatchArtifactStore;
+
+/**
+ * Read-only handle to one artifact's content file
+ *
+ * Content is never loaded as a whole: every read names a byte range and
+ * moves it in bounded windows, so multi-GB artifacts stream in constant
+ * memory.
+ * - send_to() hands the range to the kernel (sendfile) when the sink is a
+ *   file descriptor, falling back to pread/write where sendfile is refused
+ * - visit() maps the range window by window (mmap) and passes each window
+ *   to a callback, for sinks that transform bytes (e.g. JSON escaping)
+ *
+ * Ranges are clamped to the file; offsets past the end read nothing.
+ * Move-only; the file stays open for the handle's lifetime.
+ */
+class ArtifactContentReader {
+public:
+    static constexpr uint64_t kWindowSize = 8u << 20;   // Bytes mapped or copied per step
+
+    ArtifactContentReader() = default;
+    ~ArtifactContentReader();
+    ArtifactContentReader(ArtifactContentReader&& other) noexcept;
+    ArtifactContentReader& operator=(ArtifactContentReader&& other) noexcept;
+    ArtifactContentReader(const ArtifactContentReader&) = delete;
+    ArtifactContentReader& operator=(const ArtifactContentReader&) = delete;
+
+    /**
+     * Open a content file
+     * Returns ERROR_ARTIFACT_NOT_FOUND if it does not exist
+     */
+    static CliResult open(const std::filesystem::path& path, ArtifactContentReader& reader);
+
+    uint64_t size() const noexcept { return size_; }
+
+    /**
+     * Call visit(window) for consecutive windows covering [offset, offset + length)
+     */
+    CliResult visit(uint64_t offset, uint64_t length,
+                    const std::function<void(std::string_view)>& visit) const;
+
+    /**
+     * Write [offset, offset + length) to a stream
+     */
+    CliResult copy_to(std::ostream& out, uint64_t offset, uint64_t length) const;
+
+    /**
+     * Write [offset, offset + length) to a file descriptor without a user-space copy where possible
+     */
+    CliResult send_to(int out_fd, uint64_t offset, uint64_t length) const;
+
+private:
+    std::filesystem::path path_;
+    int fd_ = -1;
+    uint64_t size_ = 0;
+
+    void close() noexcept;
+};
+
 /**
  * Batch Artifact Loader - Read-only access to materialized artifacts
+ *
+ * STORAGE:
+ * - A batch with an indexed store (<root>/batches/<batch_id>.nxbatch, see
+ *   BatchArtifactStore) is served from the mapped store
+ * - Otherwise the legacy per-artifact JSON locations are consulted
  */
 class BatchArtifactLoader {
 public:
@@ -98,13 +181,75 @@ public:
      */
     static CliResult load_artifact_index(const std::string& batch_id, BatchArtifactIndex& index);
     
+    /**
+     * Load the execution state of a single job
+     * Fills batch_id and execution_complete; job_states holds the job, or is
+     * empty if the batch has no such job. O(log n) on an indexed store.
+     */
+    static CliResult load_job_state(const std::string& batch_id,
+                                    const std::string& job_id,
+                                    BatchExecutionArtifact& execution);
+    
+    /**
+     * Load metadata of a single artifact
+     * Returns ERROR_ARTIFACT_NOT_FOUND if the batch has no such artifact
+     */
+    static CliResult load_artifact_metadata(const std::string& batch_id,
+                                            const std::string& artifact_id,
+                                            ArtifactMetadata& artifact);
+    
+    /**
+     * Filtered queries; an empty filter matches everything
+     * Answered from the store's secondary indexes in time proportional to
+     * the result; legacy batches are loaded whole and filtered.
+     * - query_jobs: plan job summaries, unordered (callers sort)
+     * - query_job_states: job states in job_id order
+     * - query_artifacts: artifacts in (job_id, artifact_type, artifact_id) order
+     */
+    static CliResult query_jobs(const std::string& batch_id,
+                                const std::string& job_type,
+                                BatchJobSummaries& jobs);
+    static CliResult query_job_states(const std::string& batch_id,
+                                      const std::string& final_state,
+                                      BatchExecutionArtifact& execution);
+    static CliResult query_artifacts(const std::string& batch_id,
+                                     const std::string& artifact_type,
+                                     const std::string& job_id,
+                                     BatchArtifactIndex& index);
+    
     /**
      * Load specific artifact content by batch ID and artifact ID
      * Returns error if batch or artifact not found
+     * Buffers the whole artifact; prefer open_artifact_content() for large content
      */
     static CliResult load_artifact_content(const std::string& batch_id, 
                                          const std::string& artifact_id, 
                                          std::string& content);
+    
+    /**
+     * Open artifact content for ranged, streaming reads
+     * Returns NX_EXEC_FAILED if the artifact has no materialized content
+     */
+    static CliResult open_artifact_content(const std::string& batch_id,
+                                           const std::string& artifact_id,
+                                           ArtifactContentReader& reader);
+
+    /**
+     * Root directory for batch stores and artifact content (default: "artifacts")
+     * Safe to change while other threads load; each path is resolved against one snapshot
+     */
+    static void set_storage_root(const std::filesystem::path& root);
+    static std::filesystem::path storage_root();
+    
+    /**
+     * Location of the indexed store for a batch
+     */
+    static std::filesystem::path get_batch_store_path(const std::string& batch_id);
+    
+    /**
+     * Location of an artifact's materialized content
+     */
+    static std::string get_artifact_content_path(const std::string& batch_id, const std::string& artifact_id);
 
     // Utility functions for deterministic ordering
     static void sort_jobs_by_execution_order(std::vector<std::string>& job_ids, 
@@ -113,12 +258,14 @@ public:
 private:
     static void sort_artifacts_by_id(std::vector<ArtifactMetadata>& artifacts);
     
+    // Open the batch's indexed store if it has one; found = false selects the legacy path
+    static CliResult open_store(const std::string& batch_id, BatchArtifactStore& store, bool& found);
+    
     // Artifact path resolution (based on existing conventions)
     static std::string get_batch_plan_path(const std::string& batch_id);
     static std::string get_execution_state_path(const std::string& batch_id);
     static std::string get_policy_resolution_path(const std::string& batch_id);
     static std::string get_artifact_index_path(const std::string& batch_id);
-    static std::string get_artifact_content_path(const std::string& batch_id, const std::string& artifact_id);
 };
 
 } // namespace nx::cli
\ No newline at end of file
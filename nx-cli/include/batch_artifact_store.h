@@ -0,0 +1,128 @@
+#pragma once
+
+#include "batch_artifact_loader.h"
+#include "cli_types.h"
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nx::cli {
+
+/**
+ * Everything materialized for one batch; absent parts are not stored
+ */
+struct BatchArtifactBundle {
+    std::string batch_id;
+    std::optional<BatchPlanArtifact> plan;
+    std::optional<BatchExecutionArtifact> execution;
+    std::optional<BatchPolicyArtifact> policies;
+    std::optional<BatchArtifactIndex> artifacts;
+};
+
+/**
+ * Indexed, memory-mapped per-batch artifact store
+ *
+ * FILE LAYOUT (one file per batch, host byte order guarded by a mark):
+ * - Fixed header: magic, format version, presence flags, record counts,
+ *   batch id, plan hash and a section table of (offset, size)
+ * - String table shared by all records
+ * - Plan jobs sorted by job_id (with precomputed dependent counts), plan
+ *   order as indices, dependency lists
+ * - Job execution states sorted by job_id
+ * - Policy resolutions in recorded order
+ * - Artifact metadata sorted by artifact_id
+ * - Secondary indexes (record indices) grouped by job type, final state,
+ *   artifact type and artifact job_id, built once when the store is written
+ *
+ * ACCESS:
+ * - open() maps the file and validates only the header and section bounds,
+ *   so opening costs the same for 10 or 1M jobs
+ * - find_job_state() / find_artifact() binary-search the sorted sections:
+ *   O(log n) record reads, nothing else is touched
+ * - find_*() filtered queries binary-search a secondary index and touch
+ *   only the matching records: O(log n + k)
+ * - read_*() materialize a whole section when a command needs all of it
+ * - String references are bounds-checked on access; a corrupt record
+ *   throws std::runtime_error (BatchArtifactLoader maps it to NX_EXEC_FAILED)
+ *
+ * Stores are immutable once written; copies share one mapping. The header,
+ * string table and mapping helpers are shared with compiled presets
+ * (nx_binary_image.h).
+ *
+ * WRITERS: nothing in nx-cli produces a store yet - batch execution does not
+ * emit artifact bundles - so stores come from write() callers outside the
+ * inspect path.
+ */
+class BatchArtifactStore {
+public:
+    static constexpr const char* kFileExtension = ".nxbatch";
+
+    /**
+     * Serialize a bundle into a store image
+     */
+    static std::string serialize(const BatchArtifactBundle& bundle);
+
+    /**
+     * Write a bundle to path (temporary file + rename)
+     * Returns NX_EXEC_FAILED on I/O failure
+     */
+    static CliResult write(const std::filesystem::path& path, const BatchArtifactBundle& bundle);
+
+    /**
+     * Map the store at path
+     * Returns ERROR_BATCH_NOT_FOUND if missing, NX_EXEC_FAILED if unreadable or incompatible
+     */
+    static CliResult open(const std::filesystem::path& path, BatchArtifactStore& store);
+
+    BatchArtifactStore() = default;
+
+    bool is_open() const noexcept { return image_ != nullptr; }
+
+    std::string_view batch_id() const;
+    bool has_plan() const noexcept;
+    bool has_execution_state() const noexcept;
+    bool has_policy_resolutions() const noexcept;
+    bool has_artifact_index() const noexcept;
+    bool execution_complete() const noexcept;
+
+    size_t plan_job_count() const noexcept;
+    size_t job_state_count() const noexcept;
+    size_t artifact_count() const noexcept;
+
+    /**
+     * Materialize whole sections
+     * Job states are returned in job_id order; plan jobs keep plan order
+     */
+    void read_plan(BatchPlanArtifact& plan) const;
+    void read_execution_state(BatchExecutionArtifact& execution) const;
+    void read_policy_resolutions(BatchPolicyArtifact& policies) const;
+    void read_artifact_index(BatchArtifactIndex& index) const;
+
+    /**
+     * O(log n) point lookups
+     */
+    std::optional<JobExecutionState> find_job_state(std::string_view job_id) const;
+    std::optional<ArtifactMetadata> find_artifact(std::string_view artifact_id) const;
+    
+    /**
+     * O(log n + k) filtered queries; an empty filter matches everything
+     * Plan jobs come back in job_id order when filtered, plan order otherwise;
+     * job states in job_id order; artifacts in (job_id, artifact_type, artifact_id) order
+     */
+    void find_plan_jobs(std::string_view job_type, std::vector<BatchJobSummary>& jobs) const;
+    void find_job_states(std::string_view final_state, std::vector<JobExecutionState>& states) const;
+    void find_artifacts(std::string_view artifact_type, std::string_view job_id,
+                        std::vector<ArtifactMetadata>& artifacts) const;
+
+private:
+    struct Image;
+    std::shared_ptr<const Image> image_;
+
+    explicit BatchArtifactStore(std::shared_ptr<const Image> image) : image_(std::move(image)) {}
+};
+
+} // namespace nx::cli
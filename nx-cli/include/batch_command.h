@@ -2,8 +2,13 @@
 
 #include "cli_types.h"
 #include "batch_types.h"
+#include "batch_file_reader.h"
+#include <functional>
+#include <iostream>
+#include <map>
 #include <vector>
 #include <string>
+#include <string_view>
 
 namespace nx::cli {
 
@@ -11,30 +16,72 @@ class BatchCommand {
 public:
     /**
      * Main entry point for batch component
+     * All command output is written to out; nothing touches global streams
+     * unless out is std::cout, so concurrent calls with distinct sinks are safe.
      */
-    static CliResult execute(const std::vector<std::string>& args);
+    static CliResult execute(const std::vector<std::string>& args, std::ostream& out = std::cout);
     
     /**
      * Execute batch run operation - sequential command execution
+     *
+     * The file is streamed in chunks of BatchFileReader::kDefaultChunkLines.
+     * Every line is validated before any command is dispatched, so an invalid
+     * line anywhere in the file produces no output at all.
      */
-    static CliResult handle_run(const BatchRunRequest& request);
+    static CliResult handle_run(const BatchRunRequest& request, std::ostream& out = std::cout);
     
     /**
      * Execute batch validate operation - file validation only
+     *
+     * Unlike run, validate does not stop at the first invalid line: every
+     * line is checked (large chunks are split across worker threads) and all
+     * errors are reported in line order, identical to a serial pass. With
+     * --max-errors the scan stops once that many errors have been collected.
      */
-    static CliResult handle_validate(const BatchValidateRequest& request);
+    static CliResult handle_validate(const BatchValidateRequest& request, std::ostream& out = std::cout);
     
     /**
      * Execute batch summarize operation - static summary
      */
-    static CliResult handle_summarize(const BatchSummaryRequest& request);
+    static CliResult handle_summarize(const BatchSummaryRequest& request, std::ostream& out = std::cout);
 
 private:
-    static CliResult read_batch_file(const std::string& file_path, std::vector<std::string>& commands);
-    static CliResult validate_command_line(const std::string& line, int line_number);
-    static void print_run_output(const BatchRunRequest& request, const std::vector<std::string>& commands);
-    static void print_validate_output(const BatchValidateRequest& request, const std::vector<std::string>& commands);
-    static void print_summary_output(const BatchSummaryRequest& request, const std::vector<std::string>& commands);
+    /** Lines read per chunk by validate; larger than run's so threads get enough work */
+    static constexpr size_t kValidateChunkLines = 65536;
+    
+    /** Chunks smaller than this are validated on the calling thread */
+    static constexpr size_t kParallelValidateThreshold = 2048;
+    
+    /** Validation failure of one batch line */
+    struct LineError {
+        int line_number;
+        std::string message;
+    };
+    
+    /**
+     * Stream batch file chunk by chunk to on_chunk once every line is valid
+     * A first pass validates the whole file and stops at the first invalid
+     * line; on_chunk is only called in the second pass. Both passes read in
+     * bounded chunks.
+     */
+    static CliResult for_each_validated_chunk(const std::string& file_path,
+                                              const std::function<void(const std::vector<BatchLine>&)>& on_chunk);
+    /**
+     * Validate every line of chunk and return its errors in line order
+     * At most max_errors are returned (0 = no limit); the result does not
+     * depend on how many worker threads were used.
+     */
+    static std::vector<LineError> validate_chunk(const std::vector<BatchLine>& chunk, size_t max_errors);
+    static CliResult validate_command_line(std::string_view line, int line_number);
+    static std::string_view command_component(std::string_view line);
+    static void print_run_header(std::ostream& out, const BatchRunRequest& request);
+    static void print_run_command(std::ostream& out, const BatchRunRequest& request, size_t index, std::string_view command);
+    static void print_run_footer(std::ostream& out, const BatchRunRequest& request, size_t command_count);
+    static void print_validate_output(std::ostream& out, const BatchValidateRequest& request, size_t command_count);
+    static void print_validate_errors(std::ostream& out, const BatchValidateRequest& request,
+                                      const std::vector<LineError>& errors, bool limit_reached);
+    static void print_summary_output(std::ostream& out, const BatchSummaryRequest& request, size_t command_count,
+                                     const std::map<std::string, int>& component_counts);
 };
 
 } // namespace nx::cli
\ No newline at end of file
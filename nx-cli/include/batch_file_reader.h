@@ -0,0 +1,70 @@
+#pragma once
+
+#include "cli_types.h"
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nx::cli {
+
+/**
+ * One line of a batch file
+ * text is a view into the reader's buffer, valid until the next chunk is read
+ */
+struct BatchLine {
+    std::string_view text;
+    int line_number;
+};
+
+/**
+ * Streaming batch-file reader with bounded memory
+ *
+ * Lines are split on '\n' exactly like std::getline: a trailing newline does
+ * not produce an extra line and '\r' is kept. On POSIX the file is memory
+ * mapped and read sequentially; pages behind the current chunk are released
+ * so resident memory stays proportional to the chunk size, not the file size.
+ * Other platforms fall back to buffered std::getline into per-chunk storage.
+ */
+class BatchFileReader {
+public:
+    /** Lines handed out per chunk by default */
+    static constexpr size_t kDefaultChunkLines = 4096;
+
+    BatchFileReader() = default;
+    ~BatchFileReader();
+
+    BatchFileReader(const BatchFileReader&) = delete;
+    BatchFileReader& operator=(const BatchFileReader&) = delete;
+
+    /**
+     * Open batch file for reading
+     * Returns NX_CLI_USAGE_ERROR if the file cannot be read
+     */
+    CliResult open(const std::string& file_path);
+
+    /**
+     * Read up to max_lines lines into chunk (previous contents replaced)
+     * Returns false once the file is exhausted and chunk is empty
+     */
+    bool next_chunk(std::vector<BatchLine>& chunk, size_t max_lines = kDefaultChunkLines);
+
+private:
+    void close();
+
+    // Mapped file contents (POSIX)
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    size_t offset_ = 0;
+    size_t released_ = 0;  // Bytes of mapping already released to the kernel
+    bool mapped_ = false;
+
+    // Fallback stream and per-chunk line storage
+    std::ifstream stream_;
+    std::vector<std::string> storage_;
+
+    int line_number_ = 0;
+};
+
+} // namespace nx::cli
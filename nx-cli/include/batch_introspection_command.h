@@ -2,6 +2,7 @@
 
 #include "cli_types.h"
 #include "batch_introspection_types.h"
+#include <iostream>
 #include <vector>
 #include <string>
 
@@ -16,18 +17,19 @@ public:
     /**
      * Main entry point for batch inspect commands
      * Handles: nx batch inspect <subcommand> [args...]
+     * Output is written to out only
      */
-    static CliResult execute(const std::vector<std::string>& args);
+    static CliResult execute(const std::vector<std::string>& args, std::ostream& out = std::cout);
 
 private:
     // Command handlers (skeleton implementations)
-    static CliResult handle_plan(const std::vector<std::string>& args);
-    static CliResult handle_jobs(const std::vector<std::string>& args);
-    static CliResult handle_status(const std::vector<std::string>& args);
-    static CliResult handle_job(const std::vector<std::string>& args);
-    static CliResult handle_policies(const std::vector<std::string>& args);
-    static CliResult handle_artifacts(const std::vector<std::string>& args);
-    static CliResult handle_artifact(const std::vector<std::string>& args);
+    static CliResult handle_plan(const std::vector<std::string>& args, std::ostream& out);
+    static CliResult handle_jobs(const std::vector<std::string>& args, std::ostream& out);
+    static CliResult handle_status(const std::vector<std::string>& args, std::ostream& out);
+    static CliResult handle_job(const std::vector<std::string>& args, std::ostream& out);
+    static CliResult handle_policies(const std::vector<std::string>& args, std::ostream& out);
+    static CliResult handle_artifacts(const std::vector<std::string>& args, std::ostream& out);
+    static CliResult handle_artifact(const std::vector<std::string>& args, std::ostream& out);
     
     // Argument parsing (to be implemented)
     static CliResult parse_plan_args(const std::vector<std::string>& args, BatchInspectPlanRequest& request);
@@ -38,9 +40,8 @@ private:
     static CliResult parse_artifacts_args(const std::vector<std::string>& args, BatchInspectArtifactsRequest& request);
     static CliResult parse_artifact_args(const std::vector<std::string>& args, BatchInspectArtifactRequest& request);
     
-    // JSON output utilities (deterministic serialization)
-    static void output_json(const std::string& json_content);
-    static std::string escape_json_string(const std::string& input);
+    // JSON output utilities (deterministic serialization, see json_writer.h)
+    static void output_json(std::ostream& out, const std::string& json_content);
 };
 
 } // namespace nx::cli
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -78,6 +80,8 @@ struct BatchInspectArtifactRequest {
     struct Flags {
         bool json_output = false;  // Raw format is default for artifact content
         size_t max_size = 0;  // 0 = unlimited
+        uint64_t offset = 0;  // First byte of the requested range
+        std::optional<uint64_t> length;  // Unset = to end of artifact
     } flags;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace nx::cli {
@@ -24,6 +25,7 @@ struct BatchValidateRequest {
     
     struct Flags {
         bool json_output = false;
+        size_t max_errors = 0;  // Stop after this many errors (0 = report all)
     } flags;
 };
 
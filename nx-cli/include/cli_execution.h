@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iosfwd>
 #include <string>
 #include <vector>
 
@@ -16,6 +17,13 @@ struct CliExecutionResult {
     std::string stderr_text;
 };
 
+// Run one command and return its buffered output
+// Reentrant: output is captured through per-call sinks, never by redirecting
+// std::cout/std::cerr, so commands may run concurrently on different threads.
 CliExecutionResult execute_command(const std::vector<std::string>& args);
 
-} // namespace nx::cli
\ No newline at end of file
+// Run one command, writing output to the given sinks as it is produced
+// Returns the exit code.
+int execute_command(const std::vector<std::string>& args, std::ostream& out, std::ostream& err);
+
+} // namespace nx::cli
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "cli_execution.h"
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nx::cli {
+
+/**
+ * One request read by `nx-cli serve`
+ *
+ * Wire format is one JSON object per line:
+ *   {"id": 7, "args": ["monitor", "status", "--json"]}
+ * id is optional (integer, string or null) and is echoed verbatim.
+ */
+struct ServeRequest {
+    std::string id_json = "null";
+    std::vector<std::string> args;
+};
+
+/**
+ * Parse one NDJSON request line
+ * Returns an error description when the line is not a valid request.
+ */
+std::optional<std::string> parse_serve_request(std::string_view line, ServeRequest& request);
+
+/**
+ * Encode one NDJSON response line (without trailing newline):
+ *   {"id":7,"exit_code":0,"stdout":"...","stderr":"..."}
+ * stdout/stderr carry exactly what a one-shot `nx-cli <args>` run would print.
+ */
+std::string format_serve_response(std::string_view id_json, const CliExecutionResult& result);
+
+/**
+ * Long-lived request loop for `nx-cli serve`
+ *
+ * Reads requests from in until EOF and dispatches each through
+ * execute_command(), i.e. the same CliApp/CommandRegistry path as a one-shot
+ * invocation. Every response is flushed before the next request is read, so
+ * clients can issue requests one at a time over a pipe. Malformed lines get an
+ * InvalidCommand response and do not end the session.
+ */
+int serve(std::istream& in, std::ostream& out);
+
+} // namespace nx::cli
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+namespace nx::cli {
+
+/**
+ * Output stream writing straight to a file descriptor
+ *
+ * Created by the process entry point for its own stdout. Handlers that can
+ * move bytes without a user-space copy (artifact content via sendfile)
+ * recognise this sink, flush it and write to fd() directly. Every other
+ * std::ostream, including std::cout with a replaced rdbuf, only ever
+ * receives ordinary stream writes, so output capture keeps working.
+ *
+ * The descriptor is borrowed and never closed; the destructor flushes.
+ */
+class FdOutputStream : public std::ostream {
+public:
+    explicit FdOutputStream(int fd);
+    ~FdOutputStream() override;
+
+    FdOutputStream(const FdOutputStream&) = delete;
+    FdOutputStream& operator=(const FdOutputStream&) = delete;
+
+    int fd() const noexcept { return buffer_.fd(); }
+
+private:
+    class Buffer : public std::streambuf {
+    public:
+        explicit Buffer(int fd);
+        int fd() const noexcept { return fd_; }
+
+    protected:
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char* data, std::streamsize size) override;
+        int sync() override;
+
+    private:
+        int fd_;
+        std::vector<char> storage_;
+
+        bool drain();
+        bool write_all(const char* data, size_t size);
+    };
+
+    Buffer buffer_;
+};
+
+} // namespace nx::cli
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "nx_batchflow_json.h"
+
+namespace nx::cli {
+
+// Escaping is shared with nx-core: Unicode is the CLI default; Legacy is frozen
+// by the batch inspect contract and its golden files
+using nx::batchflow::JsonEscape;
+using nx::batchflow::append_json_escaped;
+
+/**
+ * Streaming JSON writer over a caller-owned buffer
+ *
+ * Layout-free companion to nx::batchflow::JsonWriter: escaping is delegated
+ * to nx-core, structure is written by the caller.
+ *
+ * Appends directly into the buffer: no temporaries per field, and a buffer
+ * reused across documents keeps its capacity. Layout (indentation, spacing,
+ * separators) stays with the caller via raw(), so each command keeps its
+ * exact canonical format.
+ *
+ *   std::string buffer;
+ *   JsonWriter json(buffer);
+ *   json.raw("{\"id\": ").string(id).raw(", \"count\": ").number(count).raw("}");
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& buffer, JsonEscape escape = JsonEscape::Unicode)
+        : buffer_(buffer), escape_(escape) {}
+
+    /**
+     * Append text verbatim (structure, keys, pre-encoded JSON)
+     */
+    JsonWriter& raw(std::string_view text) {
+        buffer_.append(text);
+        return *this;
+    }
+
+    JsonWriter& raw(char c) {
+        buffer_.push_back(c);
+        return *this;
+    }
+
+    /**
+     * Append a quoted, escaped string
+     */
+    JsonWriter& string(std::string_view value) {
+        buffer_.push_back('"');
+        append_json_escaped(buffer_, value, escape_);
+        buffer_.push_back('"');
+        return *this;
+    }
+
+    /**
+     * Append escaped string content without quotes (for values written in pieces)
+     */
+    JsonWriter& escaped(std::string_view value) {
+        append_json_escaped(buffer_, value, escape_);
+        return *this;
+    }
+
+    /**
+     * Append an integer in decimal, formatted in place
+     */
+    template <typename Integer, typename = std::enable_if_t<std::is_integral_v<Integer> && !std::is_same_v<Integer, bool>>>
+    JsonWriter& number(Integer value) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer_.append(digits, static_cast<size_t>(result.ptr - digits));
+        return *this;
+    }
+
+    JsonWriter& boolean(bool value) {
+        return raw(value ? std::string_view("true") : std::string_view("false"));
+    }
+
+    JsonWriter& null() {
+        return raw("null");
+    }
+
+    std::string& buffer() noexcept { return buffer_; }
+
+private:
+    std::string& buffer_;
+    JsonEscape escape_;
+};
+
+} // namespace nx::cli
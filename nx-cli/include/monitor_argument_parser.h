@@ -53,6 +53,18 @@ public:
      * Optional: --json
      */
     static MonitorParseResult parse_version_args(const std::vector<std::string>& args, MonitorVersionRequest& request);
+    
+    /**
+     * Parse arguments for monitor stats operation
+     * Optional: --json
+     */
+    static MonitorParseResult parse_stats_args(const std::vector<std::string>& args, MonitorStatsRequest& request);
+    
+    /**
+     * Parse arguments for monitor metrics operation
+     * No flags accepted
+     */
+    static MonitorParseResult parse_metrics_args(const std::vector<std::string>& args, MonitorMetricsRequest& request);
 
 private:
     static bool has_flag(const std::vector<std::string>& args, const std::string& flag);
@@ -2,6 +2,7 @@
 
 #include "cli_types.h"
 #include "monitor_types.h"
+#include <iostream>
 #include <vector>
 #include <string>
 
@@ -11,33 +12,44 @@ class MonitorCommand {
 public:
     /**
      * Main entry point for monitor component
+     * Output is written to out only
      */
-    static CliResult execute(const std::vector<std::string>& args);
+    static CliResult execute(const std::vector<std::string>& args, std::ostream& out = std::cout);
     
     /**
      * Execute monitor status operation - global system snapshot
      */
-    static CliResult handle_status(const MonitorStatusRequest& request);
+    static CliResult handle_status(const MonitorStatusRequest& request, std::ostream& out = std::cout);
     
     /**
      * Execute monitor jobs operation - jobs list snapshot
      */
-    static CliResult handle_jobs(const MonitorJobsRequest& request);
+    static CliResult handle_jobs(const MonitorJobsRequest& request, std::ostream& out = std::cout);
     
     /**
      * Execute monitor job operation - single job snapshot
      */
-    static CliResult handle_job(const MonitorJobRequest& request);
+    static CliResult handle_job(const MonitorJobRequest& request, std::ostream& out = std::cout);
     
     /**
      * Execute monitor engines operation - engines list snapshot
      */
-    static CliResult handle_engines(const MonitorEnginesRequest& request);
+    static CliResult handle_engines(const MonitorEnginesRequest& request, std::ostream& out = std::cout);
     
     /**
      * Execute monitor version operation - version information
      */
-    static CliResult handle_version(const MonitorVersionRequest& request);
+    static CliResult handle_version(const MonitorVersionRequest& request, std::ostream& out = std::cout);
+    
+    /**
+     * Execute monitor stats operation - per-engine latency and throughput
+     */
+    static CliResult handle_stats(const MonitorStatsRequest& request, std::ostream& out = std::cout);
+    
+    /**
+     * Execute monitor metrics operation - OpenMetrics text exposition
+     */
+    static CliResult handle_metrics(const MonitorMetricsRequest& request, std::ostream& out = std::cout);
 };
 
 } // namespace nx::cli
\ No newline at end of file
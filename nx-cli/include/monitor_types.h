@@ -27,6 +27,7 @@ struct MonitorJobsRequest {
  */
 struct MonitorJobRequest {
     std::string job_id;
+    std::string session_id;   // Empty: most recently started job with this id
     struct Flags {
         bool json_output = false;
     } flags;
@@ -50,4 +51,19 @@ struct MonitorVersionRequest {
     } flags;
 };
 
+/**
+ * Request for latency histograms and throughput counters
+ */
+struct MonitorStatsRequest {
+    struct Flags {
+        bool json_output = false;
+    } flags;
+};
+
+/**
+ * Request for OpenMetrics text exposition (no format flags: output is OpenMetrics)
+ */
+struct MonitorMetricsRequest {
+};
+
 } // namespace nx::cli
\ No newline at end of file
@@ -1,59 +1,32 @@
 #include "CliApp.h"
 #include "CommandRegistry.h"
-#include "CommandId.h"
-#include "adapters/MonitorQueryAdapter.h"
-#include "dto/MonitorStatusDto.h"
-#include "serialize/MonitorStatusJsonSerializer.h"
-#include "serialize/MonitorStatusTextSerializer.h"
 #include "error/CliError.h"
-#include "nx/monitor/RealMonitorEngine.h"
-#include <iostream>
+#include <ostream>
 
 namespace nx::cli {
 
-int CliApp::run(const std::vector<std::string>& args) {
-    CommandId command = CommandRegistry::parse(args);
-    
-    if (command == CommandId::Invalid) {
+int CliApp::run(const std::vector<std::string>& args, std::ostream& out, std::ostream& err) {
+    if (args.empty()) {
+        err << "Error: Missing command group. Available: " << CommandRegistry::available_groups() << "\n";
         return error::CliErrorMapper::to_exit_code(error::CliError::InvalidCommand);
     }
     
-    // Check for format flag
-    bool has_json = false;
-    bool has_text = false;
-    for (const auto& arg : args) {
-        if (arg == "--json") has_json = true;
-        if (arg == "--text") has_text = true;
-    }
-    
-    // Require explicit format flag
-    if (!has_json && !has_text) {
+    const std::string& group = args[0];
+    CommandHandler handler = CommandRegistry::find_group(group);
+    if (!handler) {
+        err << "Error: Unknown command group: " << group << ". Available: "
+            << CommandRegistry::available_groups() << "\n";
         return error::CliErrorMapper::to_exit_code(error::CliError::InvalidCommand);
     }
     
-    // Only one format allowed
-    if (has_json && has_text) {
-        return error::CliErrorMapper::to_exit_code(error::CliError::InvalidCommand);
-    }
+    // Handlers write command output to out; only the failure report goes to err
+    std::vector<std::string> group_args(args.begin() + 1, args.end());
+    CliResult result = handler(group_args, out);
     
-    switch (command) {
-        case CommandId::MonitorStatus: {
-            nx::monitor::RealMonitorEngine engine;
-            auto status = adapters::MonitorQueryAdapter::query_status(engine);
-            dto::MonitorStatusDto dto(status);
-            
-            if (has_json) {
-                std::cout << serialize::MonitorStatusJsonSerializer::serialize(dto);
-            } else if (has_text) {
-                std::cout << serialize::MonitorStatusTextSerializer::serialize(dto);
-            }
-            break;
-        }
-        default:
-            break;
+    if (!result.success) {
+        err << "Error: " << result.message << "\n";
     }
-    
-    return error::CliErrorMapper::to_exit_code(error::CliError::Success);
+    return error::CliErrorMapper::to_exit_code(error::CliErrorMapper::from_cli_error_code(result.error_code));
 }
 
-} // namespace nx::cli
\ No newline at end of file
+} // namespace nx::cli
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iosfwd>
 #include <vector>
 #include <string>
 
@@ -7,7 +8,8 @@ namespace nx::cli {
 
 class CliApp {
 public:
-    int run(const std::vector<std::string>& args);
+    // Command output goes to out, diagnostics to err; no global stream state is used
+    int run(const std::vector<std::string>& args, std::ostream& out, std::ostream& err);
 };
 
-} // namespace nx::cli
\ No newline at end of file
+} // namespace nx::cli
@@ -1,4 +1,8 @@
 #include "CommandRegistry.h"
+#include "batch_command.h"
+#include "monitor_command.h"
+#include <array>
+#include <string_view>
 
 // Compile-time guard: CommandGroup must never be used in execution paths
 #ifdef COMMANDGROUP_H
@@ -7,8 +11,41 @@
 
 namespace nx::cli {
 
+namespace {
+
+struct GroupEntry {
+    std::string_view name;
+    CommandHandler handler;
+};
+
+// Every command group nx-cli dispatches; CliApp and the serve session route through this table
+constexpr std::array<GroupEntry, 2> kGroups{{
+    {"batch", [](const std::vector<std::string>& args, std::ostream& out) { return BatchCommand::execute(args, out); }},
+    {"monitor", [](const std::vector<std::string>& args, std::ostream& out) { return MonitorCommand::execute(args, out); }},
+}};
+
+} // anonymous namespace
+
+CommandHandler CommandRegistry::find_group(const std::string& group) {
+    for (const auto& entry : kGroups) {
+        if (entry.name == group) {
+            return entry.handler;
+        }
+    }
+    return nullptr;
+}
+
+std::string CommandRegistry::available_groups() {
+    std::string names;
+    for (const auto& entry : kGroups) {
+        if (!names.empty()) names += ", ";
+        names += entry.name;
+    }
+    return names;
+}
+
 CommandId CommandRegistry::parse(const std::vector<std::string>& args) {
-    if (args.size() < 2) {
+    if (args.size() < 2 || !find_group(args[0])) {
         return CommandId::Invalid;
     }
     
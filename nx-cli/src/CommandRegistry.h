@@ -1,14 +1,25 @@
 #pragma once
 
 #include "CommandId.h"
+#include "cli_types.h"
+#include <iosfwd>
 #include <vector>
 #include <string>
 
 namespace nx::cli {
 
+// Group handler: receives the arguments after the group name
+using CommandHandler = CliResult (*)(const std::vector<std::string>& args, std::ostream& out);
+
 class CommandRegistry {
 public:
     static CommandId parse(const std::vector<std::string>& args);
+
+    // Handler for a command group, or nullptr if the group is unknown
+    static CommandHandler find_group(const std::string& group);
+
+    // Registered group names for diagnostics, e.g. "batch, monitor"
+    static std::string available_groups();
 };
 
-} // namespace nx::cli
\ No newline at end of file
+} // namespace nx::cli
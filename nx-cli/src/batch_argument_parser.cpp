@@ -1,6 +1,7 @@
 #include "batch_argument_parser.h"
 #include <algorithm>
 #include <set>
+#include <stdexcept>
 
 namespace nx::cli {
 
@@ -33,7 +34,7 @@ BatchParseResult BatchArgumentParser::parse_run_args(const std::vector<std::stri
 }
 
 BatchParseResult BatchArgumentParser::parse_validate_args(const std::vector<std::string>& args, BatchValidateRequest& request) {
-    std::vector<std::string> allowed_flags = {"--file", "--json"};
+    std::vector<std::string> allowed_flags = {"--file", "--json", "--max-errors"};
     
     auto validation_result = validate_no_unknown_flags(args, allowed_flags);
     if (!validation_result.success) {
@@ -56,6 +57,26 @@ BatchParseResult BatchArgumentParser::parse_validate_args(const std::vector<std:
     request.batch_file = file_path;
     request.flags.json_output = has_flag(args, "--json");
     
+    if (has_flag(args, "--max-errors")) {
+        // Positive decimal count only; 0 would mean "unbounded" and is not accepted
+        std::string value = get_flag_value(args, "--max-errors");
+        size_t max_errors = 0;
+        if (!value.empty() && value.find_first_not_of("0123456789") == std::string::npos) {
+            try {
+                max_errors = std::stoull(value);
+            } catch (const std::out_of_range&) {
+                max_errors = 0;
+            }
+        }
+        if (max_errors == 0) {
+            return BatchParseResult::error(
+                CliErrorCode::NX_CLI_USAGE_ERROR,
+                "Invalid --max-errors value: '" + value + "' (expected a positive integer)"
+            );
+        }
+        request.flags.max_errors = max_errors;
+    }
+    
     return BatchParseResult::ok();
 }
 
@@ -1,12 +1,289 @@
 #include "batch_artifact_loader.h"
+#include "batch_artifact_store.h"
+#include <algorithm>
+#include <cerrno>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
 
 namespace nx::cli {
 
-CliResult BatchArtifactLoader::load_batch_plan(const std::string& batch_id, BatchPlanArtifact& plan) {
+namespace {
+
+// Commands may run concurrently with a root change; readers take a copy
+struct StorageRoot {
+    std::mutex mutex;
+    std::filesystem::path path = "artifacts";
+};
+
+StorageRoot& storage_root_state() {
+    static StorageRoot root;
+    return root;
+}
+
+// Run a store read, mapping a corrupt record to NX_EXEC_FAILED
+template <typename Read>
+CliResult read_store(const std::string& batch_id, Read read) {
+    try {
+        read();
+    } catch (const std::exception& e) {
+        return CliResult::error(CliErrorCode::NX_EXEC_FAILED,
+                                "Corrupt batch store for ID: " + batch_id + " (" + e.what() + ")");
+    }
+    return CliResult::ok();
+}
+
+// Batch and artifact ids name files and directories under the storage root;
+// refuse anything that could escape it
+bool is_safe_path_component(const std::string& id) {
+    return id != "." && id.find("..") == std::string::npos &&
+           id.find('/') == std::string::npos && id.find('\\') == std::string::npos;
+}
+
+CliResult check_batch_id(const std::string& batch_id) {
     if (batch_id.empty()) {
         return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Batch ID cannot be empty");
     }
+    if (!is_safe_path_component(batch_id)) {
+        return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Invalid batch ID: " + batch_id);
+    }
+    return CliResult::ok();
+}
+
+CliResult content_read_error(const std::filesystem::path& path) {
+    return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Cannot read artifact content: " + path.string());
+}
+
+} // anonymous namespace
+
+ArtifactContentReader::~ArtifactContentReader() {
+    close();
+}
+
+ArtifactContentReader::ArtifactContentReader(ArtifactContentReader&& other) noexcept
+    : path_(std::move(other.path_)), fd_(other.fd_), size_(other.size_) {
+    other.fd_ = -1;
+    other.size_ = 0;
+}
+
+ArtifactContentReader& ArtifactContentReader::operator=(ArtifactContentReader&& other) noexcept {
+    if (this != &other) {
+        close();
+        path_ = std::move(other.path_);
+        fd_ = other.fd_;
+        size_ = other.size_;
+        other.fd_ = -1;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+void ArtifactContentReader::close() noexcept {
+#if !defined(_WIN32)
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+#endif
+    fd_ = -1;
+}
+
+CliResult ArtifactContentReader::open(const std::filesystem::path& path, ArtifactContentReader& reader) {
+    ArtifactContentReader opened;
+    opened.path_ = path;
+#if !defined(_WIN32)
+    opened.fd_ = ::open(path.c_str(), O_RDONLY);
+    if (opened.fd_ < 0) {
+        if (errno == ENOENT) {
+            return CliResult::error(CliErrorCode::ERROR_ARTIFACT_NOT_FOUND, "Artifact content not found: " + path.string());
+        }
+        return content_read_error(path);
+    }
+    struct stat info {};
+    if (fstat(opened.fd_, &info) != 0 || !S_ISREG(info.st_mode)) {
+        return content_read_error(path);
+    }
+    opened.size_ = static_cast<uint64_t>(info.st_size);
+#else
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec)) {
+        return CliResult::error(CliErrorCode::ERROR_ARTIFACT_NOT_FOUND, "Artifact content not found: " + path.string());
+    }
+    opened.size_ = static_cast<uint64_t>(std::filesystem::file_size(path, ec));
+    if (ec) {
+        return content_read_error(path);
+    }
+#endif
+    reader = std::move(opened);
+    return CliResult::ok();
+}
+
+CliResult ArtifactContentReader::visit(uint64_t offset, uint64_t length,
+                                       const std::function<void(std::string_view)>& visit) const {
+    if (offset >= size_) {
+        return CliResult::ok();
+    }
+    uint64_t end = offset + std::min(length, size_ - offset);
+
+#if !defined(_WIN32)
+    // mmap offsets must be page aligned: map from the page containing each window start
+    static const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    while (offset < end) {
+        uint64_t window = std::min(kWindowSize, end - offset);
+        uint64_t map_offset = offset - offset % page_size;
+        size_t map_size = static_cast<size_t>(offset - map_offset + window);
+        void* mapping = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd_, static_cast<off_t>(map_offset));
+        if (mapping == MAP_FAILED) {
+            return content_read_error(path_);
+        }
+        madvise(mapping, map_size, MADV_SEQUENTIAL);
+        visit(std::string_view(static_cast<const char*>(mapping) + (offset - map_offset), static_cast<size_t>(window)));
+        munmap(mapping, map_size);
+        offset += window;
+    }
+#else
+    std::ifstream in(path_, std::ios::binary);
+    if (!in.is_open() || !in.seekg(static_cast<std::streamoff>(offset))) {
+        return content_read_error(path_);
+    }
+    std::vector<char> buffer(static_cast<size_t>(std::min(kWindowSize, end - offset)));
+    while (offset < end) {
+        size_t window = static_cast<size_t>(std::min<uint64_t>(buffer.size(), end - offset));
+        if (!in.read(buffer.data(), static_cast<std::streamsize>(window))) {
+            return content_read_error(path_);
+        }
+        visit(std::string_view(buffer.data(), window));
+        offset += window;
+    }
+#endif
+    return CliResult::ok();
+}
+
+CliResult ArtifactContentReader::copy_to(std::ostream& out, uint64_t offset, uint64_t length) const {
+    auto result = visit(offset, length, [&out](std::string_view window) {
+        out.write(window.data(), static_cast<std::streamsize>(window.size()));
+    });
+    if (result.success && !out) {
+        return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Cannot write artifact content");
+    }
+    return result;
+}
+
+CliResult ArtifactContentReader::send_to(int out_fd, uint64_t offset, uint64_t length) const {
+#if !defined(_WIN32)
+    if (offset >= size_) {
+        return CliResult::ok();
+    }
+    uint64_t end = offset + std::min(length, size_ - offset);
+
+#if defined(__linux__)
+    // Kernel-side copy; some sinks (older kernels, certain pipes/ttys) refuse it
+    while (offset < end) {
+        off_t position = static_cast<off_t>(offset);
+        ssize_t sent = sendfile(out_fd, fd_, &position, static_cast<size_t>(std::min(kWindowSize, end - offset)));
+        if (sent > 0) {
+            offset += static_cast<uint64_t>(sent);
+            continue;
+        }
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent < 0 && (errno == EINVAL || errno == ENOSYS)) {
+            break;   // Fall back to pread/write for the remainder
+        }
+        return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Cannot write artifact content");
+    }
+#endif
+
+    std::vector<char> buffer;
+    while (offset < end) {
+        if (buffer.empty()) {
+            buffer.resize(static_cast<size_t>(std::min<uint64_t>(1u << 20, end - offset)));
+        }
+        ssize_t got = pread(fd_, buffer.data(), static_cast<size_t>(std::min<uint64_t>(buffer.size(), end - offset)),
+                            static_cast<off_t>(offset));
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            return content_read_error(path_);
+        }
+        for (ssize_t written = 0; written < got;) {
+            ssize_t n = ::write(out_fd, buffer.data() + written, static_cast<size_t>(got - written));
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Cannot write artifact content");
+            }
+            written += n;
+        }
+        offset += static_cast<uint64_t>(got);
+    }
+    return CliResult::ok();
+#else
+    (void)out_fd;
+    (void)offset;
+    (void)length;
+    return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Descriptor output not supported on this platform");
+#endif
+}
+
+void BatchArtifactLoader::set_storage_root(const std::filesystem::path& root) {
+    auto& state = storage_root_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.path = root;
+}
+
+std::filesystem::path BatchArtifactLoader::storage_root() {
+    auto& state = storage_root_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.path;
+}
+
+std::filesystem::path BatchArtifactLoader::get_batch_store_path(const std::string& batch_id) {
+    return storage_root() / "batches" / (batch_id + BatchArtifactStore::kFileExtension);
+}
+
+CliResult BatchArtifactLoader::open_store(const std::string& batch_id, BatchArtifactStore& store, bool& found) {
+    auto path = get_batch_store_path(batch_id);
+    found = std::filesystem::exists(path);
+    if (!found) {
+        return CliResult::ok();
+    }
+    return BatchArtifactStore::open(path, store);
+}
+
+CliResult BatchArtifactLoader::load_batch_plan(const std::string& batch_id, BatchPlanArtifact& plan) {
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (found) {
+        if (!store.has_plan()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Batch plan not found for ID: " + batch_id);
+        }
+        return read_store(batch_id, [&] { store.read_plan(plan); });
+    }
     
     std::string plan_path = get_batch_plan_path(batch_id);
     if (!std::filesystem::exists(plan_path)) {
@@ -21,8 +298,23 @@ CliResult BatchArtifactLoader::load_batch_plan(const std::string& batch_id, Batc
 }
 
 CliResult BatchArtifactLoader::load_execution_state(const std::string& batch_id, BatchExecutionArtifact& execution) {
-    if (batch_id.empty()) {
-        return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Batch ID cannot be empty");
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (found) {
+        if (!store.has_execution_state()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Execution state not found for batch ID: " + batch_id);
+        }
+        return read_store(batch_id, [&] { store.read_execution_state(execution); });
     }
     
     std::string state_path = get_execution_state_path(batch_id);
@@ -38,8 +330,23 @@ CliResult BatchArtifactLoader::load_execution_state(const std::string& batch_id,
 }
 
 CliResult BatchArtifactLoader::load_policy_resolutions(const std::string& batch_id, BatchPolicyArtifact& policies) {
-    if (batch_id.empty()) {
-        return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Batch ID cannot be empty");
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (found) {
+        if (!store.has_policy_resolutions()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Policy resolutions not found for batch ID: " + batch_id);
+        }
+        return read_store(batch_id, [&] { store.read_policy_resolutions(policies); });
     }
     
     std::string policy_path = get_policy_resolution_path(batch_id);
@@ -55,8 +362,23 @@ CliResult BatchArtifactLoader::load_policy_resolutions(const std::string& batch_
 }
 
 CliResult BatchArtifactLoader::load_artifact_index(const std::string& batch_id, BatchArtifactIndex& index) {
-    if (batch_id.empty()) {
-        return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Batch ID cannot be empty");
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (found) {
+        if (!store.has_artifact_index()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Artifact index not found for batch ID: " + batch_id);
+        }
+        return read_store(batch_id, [&] { store.read_artifact_index(index); });
     }
     
     std::string index_path = get_artifact_index_path(batch_id);
@@ -71,28 +393,290 @@ CliResult BatchArtifactLoader::load_artifact_index(const std::string& batch_id,
     );
 }
 
+CliResult BatchArtifactLoader::load_job_state(const std::string& batch_id,
+                                              const std::string& job_id,
+                                              BatchExecutionArtifact& execution) {
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (!found) {
+        // Legacy storage: materialize all states and select the job
+        auto load_result = load_execution_state(batch_id, execution);
+        if (!load_result.success) {
+            return load_result;
+        }
+        auto it = std::find_if(execution.job_states.begin(), execution.job_states.end(),
+                               [&job_id](const JobExecutionState& state) { return state.job_id == job_id; });
+        std::vector<JobExecutionState> selected;
+        if (it != execution.job_states.end()) {
+            selected.push_back(std::move(*it));
+        }
+        execution.job_states = std::move(selected);
+        return CliResult::ok();
+    }
+    
+    if (!store.has_execution_state()) {
+        return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                               "Execution state not found for batch ID: " + batch_id);
+    }
+    return read_store(batch_id, [&] {
+        execution = BatchExecutionArtifact{};
+        execution.batch_id = std::string(store.batch_id());
+        execution.execution_complete = store.execution_complete();
+        if (auto state = store.find_job_state(job_id)) {
+            execution.job_states.push_back(std::move(*state));
+        }
+    });
+}
+
+CliResult BatchArtifactLoader::load_artifact_metadata(const std::string& batch_id,
+                                                      const std::string& artifact_id,
+                                                      ArtifactMetadata& artifact) {
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    
+    std::optional<ArtifactMetadata> metadata;
+    if (found) {
+        if (!store.has_artifact_index()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Artifact index not found for batch ID: " + batch_id);
+        }
+        auto read_result = read_store(batch_id, [&] { metadata = store.find_artifact(artifact_id); });
+        if (!read_result.success) {
+            return read_result;
+        }
+    } else {
+        // Legacy storage: scan the full index
+        BatchArtifactIndex index;
+        auto load_result = load_artifact_index(batch_id, index);
+        if (!load_result.success) {
+            return load_result;
+        }
+        for (auto& candidate : index.artifacts) {
+            if (candidate.artifact_id == artifact_id) {
+                metadata = std::move(candidate);
+                break;
+            }
+        }
+    }
+    
+    if (!metadata) {
+        return CliResult::error(CliErrorCode::ERROR_ARTIFACT_NOT_FOUND, 
+                               "Artifact not found: " + artifact_id + " in batch: " + batch_id);
+    }
+    artifact = std::move(*metadata);
+    return CliResult::ok();
+}
+
+CliResult BatchArtifactLoader::query_jobs(const std::string& batch_id,
+                                          const std::string& job_type,
+                                          BatchJobSummaries& jobs) {
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (found) {
+        if (!store.has_plan()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Batch plan not found for ID: " + batch_id);
+        }
+        jobs.batch_id = std::string(store.batch_id());
+        return read_store(batch_id, [&] { store.find_plan_jobs(job_type, jobs.jobs); });
+    }
+    
+    // Legacy artifacts: load the whole plan and scan it
+    BatchPlanArtifact plan;
+    auto load_result = load_batch_plan(batch_id, plan);
+    if (!load_result.success) {
+        return load_result;
+    }
+    
+    std::map<std::string, size_t> dependents;
+    for (const auto& [job_id, deps] : plan.dependencies) {
+        std::vector<std::string> distinct = deps;
+        std::sort(distinct.begin(), distinct.end());
+        distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+        for (const auto& dependency : distinct) {
+            ++dependents[dependency];
+        }
+    }
+    
+    jobs.batch_id = plan.batch_id;
+    jobs.jobs.clear();
+    for (const std::string& job_id : plan.job_ids) {
+        const std::string& type = plan.job_types.at(job_id);
+        if (!job_type.empty() && type != job_type) {
+            continue;
+        }
+        auto dependent = dependents.find(job_id);
+        jobs.jobs.push_back(BatchJobSummary{
+            .job_id = job_id,
+            .job_type = type,
+            .execution_order = plan.execution_order.at(job_id),
+            .dependency_count = plan.dependencies.at(job_id).size(),
+            .dependent_count = dependent != dependents.end() ? dependent->second : 0
+        });
+    }
+    return CliResult::ok();
+}
+
+CliResult BatchArtifactLoader::query_job_states(const std::string& batch_id,
+                                                const std::string& final_state,
+                                                BatchExecutionArtifact& execution) {
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (found) {
+        if (!store.has_execution_state()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Execution state not found for batch ID: " + batch_id);
+        }
+        execution.batch_id = std::string(store.batch_id());
+        execution.execution_complete = store.execution_complete();
+        return read_store(batch_id, [&] { store.find_job_states(final_state, execution.job_states); });
+    }
+    
+    // Legacy artifacts: load every state and filter
+    auto load_result = load_execution_state(batch_id, execution);
+    if (!load_result.success) {
+        return load_result;
+    }
+    auto& states = execution.job_states;
+    if (!final_state.empty()) {
+        states.erase(std::remove_if(states.begin(), states.end(), [&final_state](const JobExecutionState& state) {
+            return state.final_state != final_state;
+        }), states.end());
+    }
+    std::sort(states.begin(), states.end(), [](const JobExecutionState& a, const JobExecutionState& b) {
+        return a.job_id < b.job_id;
+    });
+    return CliResult::ok();
+}
+
+CliResult BatchArtifactLoader::query_artifacts(const std::string& batch_id,
+                                               const std::string& artifact_type,
+                                               const std::string& job_id,
+                                               BatchArtifactIndex& index) {
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
+    }
+    
+    BatchArtifactStore store;
+    bool found = false;
+    auto store_result = open_store(batch_id, store, found);
+    if (!store_result.success) {
+        return store_result;
+    }
+    if (found) {
+        if (!store.has_artifact_index()) {
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
+                                   "Artifact index not found for batch ID: " + batch_id);
+        }
+        index.batch_id = std::string(store.batch_id());
+        return read_store(batch_id, [&] { store.find_artifacts(artifact_type, job_id, index.artifacts); });
+    }
+    
+    // Legacy artifacts: load the whole index and filter
+    auto load_result = load_artifact_index(batch_id, index);
+    if (!load_result.success) {
+        return load_result;
+    }
+    auto& artifacts = index.artifacts;
+    artifacts.erase(std::remove_if(artifacts.begin(), artifacts.end(), [&](const ArtifactMetadata& artifact) {
+        return (!artifact_type.empty() && artifact.artifact_type != artifact_type) ||
+               (!job_id.empty() && artifact.job_id != job_id);
+    }), artifacts.end());
+    std::sort(artifacts.begin(), artifacts.end(), [](const ArtifactMetadata& a, const ArtifactMetadata& b) {
+        if (a.job_id != b.job_id) {
+            return a.job_id < b.job_id;
+        }
+        if (a.artifact_type != b.artifact_type) {
+            return a.artifact_type < b.artifact_type;
+        }
+        return a.artifact_id < b.artifact_id;
+    });
+    return CliResult::ok();
+}
+
 CliResult BatchArtifactLoader::load_artifact_content(const std::string& batch_id, 
                                                    const std::string& artifact_id, 
                                                    std::string& content) {
-    if (batch_id.empty()) {
-        return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Batch ID cannot be empty");
+    ArtifactContentReader reader;
+    auto result = open_artifact_content(batch_id, artifact_id, reader);
+    if (!result.success) {
+        return result;
+    }
+    
+    content.clear();
+    content.reserve(static_cast<size_t>(reader.size()));
+    return reader.visit(0, reader.size(), [&content](std::string_view window) {
+        content.append(window);
+    });
+}
+
+CliResult BatchArtifactLoader::open_artifact_content(const std::string& batch_id,
+                                                     const std::string& artifact_id,
+                                                     ArtifactContentReader& reader) {
+    auto id_result = check_batch_id(batch_id);
+    if (!id_result.success) {
+        return id_result;
     }
     
     if (artifact_id.empty()) {
         return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Artifact ID cannot be empty");
     }
     
+    if (!is_safe_path_component(artifact_id)) {
+        return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Invalid artifact ID: " + artifact_id);
+    }
+    
     // First check if artifact index exists
     std::string index_path = get_artifact_index_path(batch_id);
-    if (!std::filesystem::exists(index_path)) {
+    if (!std::filesystem::exists(get_batch_store_path(batch_id)) && !std::filesystem::exists(index_path)) {
         return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, 
                                "Artifact index not found for batch ID: " + batch_id);
     }
     
-    return CliResult::error(
-        CliErrorCode::NX_EXEC_FAILED,
-        "Artifact content access not implemented"
-    );
+    auto result = ArtifactContentReader::open(get_artifact_content_path(batch_id, artifact_id), reader);
+    if (result.error_code == CliErrorCode::ERROR_ARTIFACT_NOT_FOUND) {
+        // Indexed but never materialized (e.g. fixture-only batches)
+        return CliResult::error(CliErrorCode::NX_EXEC_FAILED,
+                                "Artifact content not materialized: " + artifact_id + " in batch: " + batch_id);
+    }
+    return result;
 }
 
 void BatchArtifactLoader::sort_jobs_by_execution_order(std::vector<std::string>& job_ids, 
@@ -137,8 +721,7 @@ std::string BatchArtifactLoader::get_artifact_index_path(const std::string& batc
 }
 
 std::string BatchArtifactLoader::get_artifact_content_path(const std::string& batch_id, const std::string& artifact_id) {
-    // TODO: Use actual artifact storage conventions from existing phases
-    return "artifacts/content/" + batch_id + "/" + artifact_id;
+    return (storage_root() / "content" / batch_id / artifact_id).string();
 }
 
 } // namespace nx::cli
\ No newline at end of file
@@ -0,0 +1,696 @@
+#include "batch_artifact_store.h"
+#include "nx_binary_image.h"
+#include "nx_temp_file.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace nx::cli {
+
+namespace {
+
+using nx::binary_image::SectionRef;
+using nx::binary_image::StringRef;
+using nx::binary_image::append_section;
+
+constexpr char kMagic[8] = {'N', 'X', 'B', 'A', 'T', 'C', 'H', '\0'};
+constexpr uint32_t kFormatVersion = 2;
+
+// Section indices in the header section table
+enum Section : uint32_t {
+    kStrings = 0,
+    kPlanJobs,        // PlanJobRecord, sorted by job_id
+    kPlanOrder,       // uint32_t index into kPlanJobs, in plan order
+    kDependencies,    // StringRef, ranges referenced by PlanJobRecord
+    kJobStates,       // JobStateRecord, sorted by job_id
+    kPolicies,        // PolicyRecord, recorded order
+    kArtifacts,       // ArtifactRecord, sorted by artifact_id
+    // Secondary indexes: uint32_t record indices, grouped by the filter key
+    kPlanJobsByType,      // into kPlanJobs, by (job_type, job_id)
+    kJobStatesByState,    // into kJobStates, by (final_state, job_id)
+    kArtifactsByType,     // into kArtifacts, by (artifact_type, job_id, artifact_id)
+    kArtifactsByJob,      // into kArtifacts, by (job_id, artifact_type, artifact_id)
+    kSectionCount
+};
+
+enum HeaderFlag : uint32_t {
+    kHasPlan = 1u << 0,
+    kHasExecution = 1u << 1,
+    kHasPolicies = 1u << 2,
+    kHasArtifacts = 1u << 3,
+    kExecutionComplete = 1u << 4
+};
+
+// Records are laid out without implicit padding so images are byte-stable
+struct FileHeader {
+    char magic[8];
+    uint32_t byte_order_mark;
+    uint32_t format_version;
+    uint32_t flags;
+    uint32_t plan_job_count;
+    uint32_t dependency_count;
+    uint32_t job_state_count;
+    uint32_t policy_count;
+    uint32_t artifact_count;
+    StringRef batch_id;
+    StringRef plan_hash;
+    uint64_t declared_job_count;   // BatchPlanArtifact::job_count as recorded
+    SectionRef sections[kSectionCount];
+};
+
+struct PlanJobRecord {
+    StringRef job_id;
+    StringRef job_type;
+    uint64_t execution_order;
+    uint32_t dependencies_begin;
+    uint32_t dependencies_count;
+    uint32_t dependent_count;      // Plan jobs listing this job as a dependency
+    uint32_t reserved;
+};
+
+enum JobStateFlag : uint32_t {
+    kHasFailureClassification = 1u << 0,
+    kHasDuration = 1u << 1
+};
+
+struct JobStateRecord {
+    StringRef job_id;
+    StringRef job_type;
+    StringRef final_state;
+    StringRef failure_classification;
+    uint64_t execution_duration_ms;
+    uint32_t retry_count;
+    uint32_t flags;
+};
+
+struct PolicyRecord {
+    StringRef job_id;
+    StringRef policy_type;
+    StringRef policy_applied;
+    StringRef resolved_decision;
+    StringRef resolution_timestamp;
+};
+
+struct ArtifactRecord {
+    uint64_t size_bytes;
+    StringRef artifact_id;
+    StringRef artifact_type;
+    StringRef job_id;
+    StringRef created_timestamp;
+    StringRef content_hash;
+    uint32_t reserved[2];
+};
+
+static_assert(sizeof(FileHeader) == 64 + kSectionCount * sizeof(SectionRef));
+static_assert(sizeof(PlanJobRecord) == 40);
+static_assert(sizeof(JobStateRecord) == 48);
+static_assert(sizeof(PolicyRecord) == 40);
+static_assert(sizeof(ArtifactRecord) == 56);
+
+uint32_t checked_count(size_t count) {
+    if (count > UINT32_MAX) {
+        throw std::length_error("batch store section exceeds 2^32 records");
+    }
+    return static_cast<uint32_t>(count);
+}
+
+// Record indices 0..count-1 ordered by less(record_a, record_b), ties by index
+template <typename T, typename Less>
+std::vector<uint32_t> build_index(const std::vector<T>& records, Less less) {
+    std::vector<uint32_t> index(records.size());
+    for (uint32_t i = 0; i < index.size(); ++i) index[i] = i;
+    std::stable_sort(index.begin(), index.end(), [&records, &less](uint32_t a, uint32_t b) {
+        return less(records[a], records[b]);
+    });
+    return index;
+}
+
+} // anonymous namespace
+
+/**
+ * Backing storage of a store: mapped file or owned bytes
+ */
+struct BatchArtifactStore::Image {
+    nx::binary_image::MappedImage bytes;
+    const char* data = nullptr;
+    size_t size = 0;
+    FileHeader header{};
+
+    std::string_view string(const StringRef& ref) const {
+        auto value = nx::binary_image::string_at(data, header.sections[kStrings], ref);
+        if (!value) {
+            throw std::runtime_error("batch store string reference out of bounds");
+        }
+        return *value;
+    }
+
+    template <typename T>
+    const T* section(Section index) const {
+        return reinterpret_cast<const T*>(data + header.sections[index].offset);
+    }
+
+    // Validate fixed header and section table only - O(1) in batch size
+    bool validate_header(std::string& error) {
+        data = bytes.data();
+        size = bytes.size();
+        auto status = nx::binary_image::read_header(data, size, kMagic, kFormatVersion, header);
+        if (status != nx::binary_image::HeaderStatus::Ok) {
+            error = nx::binary_image::describe(status, header.format_version);
+            return false;
+        }
+        auto expect_count = [this](Section index, uint64_t count, size_t record_size) {
+            return header.sections[index].size == count * record_size;
+        };
+        if (!expect_count(kPlanJobs, header.plan_job_count, sizeof(PlanJobRecord)) ||
+            !expect_count(kPlanOrder, header.plan_job_count, sizeof(uint32_t)) ||
+            !expect_count(kDependencies, header.dependency_count, sizeof(StringRef)) ||
+            !expect_count(kJobStates, header.job_state_count, sizeof(JobStateRecord)) ||
+            !expect_count(kPolicies, header.policy_count, sizeof(PolicyRecord)) ||
+            !expect_count(kArtifacts, header.artifact_count, sizeof(ArtifactRecord)) ||
+            !expect_count(kPlanJobsByType, header.plan_job_count, sizeof(uint32_t)) ||
+            !expect_count(kJobStatesByState, header.job_state_count, sizeof(uint32_t)) ||
+            !expect_count(kArtifactsByType, header.artifact_count, sizeof(uint32_t)) ||
+            !expect_count(kArtifactsByJob, header.artifact_count, sizeof(uint32_t))) {
+            error = "section size mismatch";
+            return false;
+        }
+        return true;
+    }
+
+    // Binary search over a section sorted by the string at key(record)
+    template <typename T, typename Key>
+    const T* find(Section index, uint32_t count, std::string_view value, Key key) const {
+        const T* begin = section<T>(index);
+        const T* end = begin + count;
+        const T* it = std::lower_bound(begin, end, value, [this, &key](const T& record, std::string_view target) {
+            return string(key(record)) < target;
+        });
+        if (it == end || string(key(*it)) != value) {
+            return nullptr;
+        }
+        return it;
+    }
+
+    // Entries in [begin, end) of a secondary index whose record key equals value: O(log n)
+    template <typename T, typename Key>
+    std::pair<const uint32_t*, const uint32_t*> equal_range(const uint32_t* begin, const uint32_t* end,
+                                                            Section records, uint32_t count,
+                                                            std::string_view value, Key key) const {
+        const T* base = section<T>(records);
+        auto key_of = [&](uint32_t entry) {
+            if (entry >= count) {
+                throw std::runtime_error("batch store index entry out of bounds");
+            }
+            return string(key(base[entry]));
+        };
+        const uint32_t* lower = std::lower_bound(begin, end, value, [&](uint32_t entry, std::string_view target) {
+            return key_of(entry) < target;
+        });
+        const uint32_t* upper = std::upper_bound(lower, end, value, [&](std::string_view target, uint32_t entry) {
+            return target < key_of(entry);
+        });
+        return {lower, upper};
+    }
+
+    BatchJobSummary plan_job(const PlanJobRecord& record) const {
+        return BatchJobSummary{
+            .job_id = std::string(string(record.job_id)),
+            .job_type = std::string(string(record.job_type)),
+            .execution_order = static_cast<size_t>(record.execution_order),
+            .dependency_count = record.dependencies_count,
+            .dependent_count = record.dependent_count
+        };
+    }
+
+    JobExecutionState job_state(const JobStateRecord& record) const {
+        JobExecutionState state;
+        state.job_id = std::string(string(record.job_id));
+        state.job_type = std::string(string(record.job_type));
+        state.final_state = std::string(string(record.final_state));
+        state.retry_count = record.retry_count;
+        if (record.flags & kHasFailureClassification) {
+            state.failure_classification = std::string(string(record.failure_classification));
+        }
+        if (record.flags & kHasDuration) {
+            state.execution_duration_ms = static_cast<size_t>(record.execution_duration_ms);
+        }
+        return state;
+    }
+
+    ArtifactMetadata artifact(const ArtifactRecord& record) const {
+        return ArtifactMetadata{
+            .artifact_id = std::string(string(record.artifact_id)),
+            .artifact_type = std::string(string(record.artifact_type)),
+            .job_id = std::string(string(record.job_id)),
+            .size_bytes = static_cast<size_t>(record.size_bytes),
+            .created_timestamp = std::string(string(record.created_timestamp)),
+            .content_hash = std::string(string(record.content_hash))
+        };
+    }
+};
+
+std::string BatchArtifactStore::serialize(const BatchArtifactBundle& bundle) {
+    nx::binary_image::StringTableBuilder strings;
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.byte_order_mark = nx::binary_image::kByteOrderMark;
+    header.format_version = kFormatVersion;
+    header.batch_id = strings.add(bundle.batch_id);
+    header.plan_hash = strings.add("");
+    auto view = [&strings](const StringRef& ref) {
+        return std::string_view(strings.data()).substr(ref.offset, ref.length);
+    };
+
+    // Plan: records sorted by job_id, plan order kept as an index list
+    std::vector<PlanJobRecord> plan_jobs;
+    std::vector<uint32_t> plan_order;
+    std::vector<StringRef> dependencies;
+    if (bundle.plan) {
+        const auto& plan = *bundle.plan;
+        header.flags |= kHasPlan;
+        header.plan_hash = strings.add(plan.plan_hash);
+        header.declared_job_count = plan.job_count;
+
+        std::vector<uint32_t> by_id(plan.job_ids.size());
+        for (uint32_t i = 0; i < by_id.size(); ++i) by_id[i] = i;
+        std::stable_sort(by_id.begin(), by_id.end(), [&plan](uint32_t a, uint32_t b) {
+            return plan.job_ids[a] < plan.job_ids[b];
+        });
+
+        // Distinct dependents per job, counted once per dependent job
+        std::unordered_map<std::string_view, uint32_t> dependents;
+        for (const auto& [job_id, deps] : plan.dependencies) {
+            std::vector<std::string_view> distinct(deps.begin(), deps.end());
+            std::sort(distinct.begin(), distinct.end());
+            distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+            for (std::string_view dependency : distinct) {
+                ++dependents[dependency];
+            }
+        }
+
+        plan_order.resize(plan.job_ids.size());
+        plan_jobs.reserve(plan.job_ids.size());
+        for (uint32_t sorted_index = 0; sorted_index < by_id.size(); ++sorted_index) {
+            const std::string& job_id = plan.job_ids[by_id[sorted_index]];
+            plan_order[by_id[sorted_index]] = sorted_index;
+
+            PlanJobRecord record{};
+            record.job_id = strings.add(job_id);
+            auto type = plan.job_types.find(job_id);
+            record.job_type = strings.add(type != plan.job_types.end() ? type->second : "");
+            auto order = plan.execution_order.find(job_id);
+            record.execution_order = order != plan.execution_order.end() ? order->second : 0;
+            record.dependencies_begin = checked_count(dependencies.size());
+            auto deps = plan.dependencies.find(job_id);
+            if (deps != plan.dependencies.end()) {
+                for (const auto& dependency : deps->second) {
+                    dependencies.push_back(strings.add(dependency));
+                }
+                record.dependencies_count = checked_count(deps->second.size());
+            }
+            auto dependent = dependents.find(job_id);
+            record.dependent_count = dependent != dependents.end() ? dependent->second : 0;
+            plan_jobs.push_back(record);
+        }
+    }
+    header.plan_job_count = checked_count(plan_jobs.size());
+    auto plan_jobs_by_type = build_index(plan_jobs, [&view](const PlanJobRecord& a, const PlanJobRecord& b) {
+        return view(a.job_type) < view(b.job_type);
+    });
+    header.dependency_count = checked_count(dependencies.size());
+
+    std::vector<JobStateRecord> job_states;
+    if (bundle.execution) {
+        header.flags |= kHasExecution;
+        if (bundle.execution->execution_complete) header.flags |= kExecutionComplete;
+        job_states.reserve(bundle.execution->job_states.size());
+        for (const auto& state : bundle.execution->job_states) {
+            JobStateRecord record{};
+            record.job_id = strings.add(state.job_id);
+            record.job_type = strings.add(state.job_type);
+            record.final_state = strings.add(state.final_state);
+            record.retry_count = checked_count(state.retry_count);
+            if (state.failure_classification) {
+                record.flags |= kHasFailureClassification;
+                record.failure_classification = strings.add(*state.failure_classification);
+            }
+            if (state.execution_duration_ms) {
+                record.flags |= kHasDuration;
+                record.execution_duration_ms = *state.execution_duration_ms;
+            }
+            job_states.push_back(record);
+        }
+        std::stable_sort(job_states.begin(), job_states.end(), [&view](const JobStateRecord& a, const JobStateRecord& b) {
+            return view(a.job_id) < view(b.job_id);
+        });
+    }
+    header.job_state_count = checked_count(job_states.size());
+    auto job_states_by_state = build_index(job_states, [&view](const JobStateRecord& a, const JobStateRecord& b) {
+        return view(a.final_state) < view(b.final_state);
+    });
+
+    std::vector<PolicyRecord> policies;
+    if (bundle.policies) {
+        header.flags |= kHasPolicies;
+        policies.reserve(bundle.policies->policy_resolutions.size());
+        for (const auto& resolution : bundle.policies->policy_resolutions) {
+            policies.push_back(PolicyRecord{
+                .job_id = strings.add(resolution.job_id),
+                .policy_type = strings.add(resolution.policy_type),
+                .policy_applied = strings.add(resolution.policy_applied),
+                .resolved_decision = strings.add(resolution.resolved_decision),
+                .resolution_timestamp = strings.add(resolution.resolution_timestamp)
+            });
+        }
+    }
+    header.policy_count = checked_count(policies.size());
+
+    std::vector<ArtifactRecord> artifacts;
+    if (bundle.artifacts) {
+        header.flags |= kHasArtifacts;
+        artifacts.reserve(bundle.artifacts->artifacts.size());
+        for (const auto& artifact : bundle.artifacts->artifacts) {
+            ArtifactRecord record{};
+            record.size_bytes = artifact.size_bytes;
+            record.artifact_id = strings.add(artifact.artifact_id);
+            record.artifact_type = strings.add(artifact.artifact_type);
+            record.job_id = strings.add(artifact.job_id);
+            record.created_timestamp = strings.add(artifact.created_timestamp);
+            record.content_hash = strings.add(artifact.content_hash);
+            artifacts.push_back(record);
+        }
+        std::stable_sort(artifacts.begin(), artifacts.end(), [&view](const ArtifactRecord& a, const ArtifactRecord& b) {
+            return view(a.artifact_id) < view(b.artifact_id);
+        });
+    }
+    header.artifact_count = checked_count(artifacts.size());
+    // Records are in artifact_id order, so stable index sorts keep it as the last key
+    auto artifacts_by_type = build_index(artifacts, [&view](const ArtifactRecord& a, const ArtifactRecord& b) {
+        return std::pair(view(a.artifact_type), view(a.job_id)) < std::pair(view(b.artifact_type), view(b.job_id));
+    });
+    auto artifacts_by_job = build_index(artifacts, [&view](const ArtifactRecord& a, const ArtifactRecord& b) {
+        return std::pair(view(a.job_id), view(a.artifact_type)) < std::pair(view(b.job_id), view(b.artifact_type));
+    });
+
+    std::string image(sizeof(FileHeader), '\0');
+    append_section(image, header.sections[kStrings], strings.data().data(), strings.data().size());
+    append_section(image, header.sections[kPlanJobs], plan_jobs.data(), plan_jobs.size());
+    append_section(image, header.sections[kPlanOrder], plan_order.data(), plan_order.size());
+    append_section(image, header.sections[kDependencies], dependencies.data(), dependencies.size());
+    append_section(image, header.sections[kJobStates], job_states.data(), job_states.size());
+    append_section(image, header.sections[kPolicies], policies.data(), policies.size());
+    append_section(image, header.sections[kArtifacts], artifacts.data(), artifacts.size());
+    append_section(image, header.sections[kPlanJobsByType], plan_jobs_by_type.data(), plan_jobs_by_type.size());
+    append_section(image, header.sections[kJobStatesByState], job_states_by_state.data(), job_states_by_state.size());
+    append_section(image, header.sections[kArtifactsByType], artifacts_by_type.data(), artifacts_by_type.size());
+    append_section(image, header.sections[kArtifactsByJob], artifacts_by_job.data(), artifacts_by_job.size());
+    std::memcpy(image.data(), &header, sizeof(FileHeader));
+
+    return image;
+}
+
+CliResult BatchArtifactStore::write(const std::filesystem::path& path, const BatchArtifactBundle& bundle) {
+    std::string image;
+    try {
+        image = serialize(bundle);
+    } catch (const std::exception& e) {
+        return CliResult::error(CliErrorCode::NX_EXEC_FAILED, std::string("Cannot build batch store: ") + e.what());
+    }
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec) {
+            return CliResult::error(CliErrorCode::NX_EXEC_FAILED,
+                                    "Cannot create batch store directory: " + path.parent_path().string());
+        }
+    }
+
+    // Private temp name: concurrent writers of one batch must not share it
+    auto temp_path = nx::core::unique_temp_path(path);
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open() || !out.write(image.data(), static_cast<std::streamsize>(image.size())) || !out.flush()) {
+            out.close();
+            std::filesystem::remove(temp_path, ec);
+            return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Cannot write batch store: " + temp_path.string());
+        }
+    }
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Cannot write batch store: " + path.string());
+    }
+    return CliResult::ok();
+}
+
+CliResult BatchArtifactStore::open(const std::filesystem::path& path, BatchArtifactStore& store) {
+    auto image = std::make_shared<Image>();
+    switch (image->bytes.map_file(path)) {
+        case nx::binary_image::MappedImage::OpenStatus::Ok:
+            break;
+        case nx::binary_image::MappedImage::OpenStatus::NotFound:
+            return CliResult::error(CliErrorCode::ERROR_BATCH_NOT_FOUND, "Batch store not found: " + path.string());
+        case nx::binary_image::MappedImage::OpenStatus::Unreadable:
+            return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Cannot map batch store: " + path.string());
+    }
+
+    std::string error;
+    if (!image->validate_header(error)) {
+        return CliResult::error(CliErrorCode::NX_EXEC_FAILED, "Invalid batch store " + path.string() + ": " + error);
+    }
+    store = BatchArtifactStore(std::move(image));
+    return CliResult::ok();
+}
+
+std::string_view BatchArtifactStore::batch_id() const {
+    return image_->string(image_->header.batch_id);
+}
+
+bool BatchArtifactStore::has_plan() const noexcept {
+    return image_->header.flags & kHasPlan;
+}
+
+bool BatchArtifactStore::has_execution_state() const noexcept {
+    return image_->header.flags & kHasExecution;
+}
+
+bool BatchArtifactStore::has_policy_resolutions() const noexcept {
+    return image_->header.flags & kHasPolicies;
+}
+
+bool BatchArtifactStore::has_artifact_index() const noexcept {
+    return image_->header.flags & kHasArtifacts;
+}
+
+bool BatchArtifactStore::execution_complete() const noexcept {
+    return image_->header.flags & kExecutionComplete;
+}
+
+size_t BatchArtifactStore::plan_job_count() const noexcept {
+    return image_->header.plan_job_count;
+}
+
+size_t BatchArtifactStore::job_state_count() const noexcept {
+    return image_->header.job_state_count;
+}
+
+size_t BatchArtifactStore::artifact_count() const noexcept {
+    return image_->header.artifact_count;
+}
+
+void BatchArtifactStore::read_plan(BatchPlanArtifact& plan) const {
+    const Image& image = *image_;
+    const auto& header = image.header;
+    const PlanJobRecord* jobs = image.section<PlanJobRecord>(kPlanJobs);
+    const uint32_t* order = image.section<uint32_t>(kPlanOrder);
+    const StringRef* dependencies = image.section<StringRef>(kDependencies);
+
+    plan = BatchPlanArtifact{};
+    plan.batch_id = std::string(batch_id());
+    plan.plan_hash = std::string(image.string(header.plan_hash));
+    plan.job_count = static_cast<size_t>(header.declared_job_count);
+    plan.job_ids.reserve(header.plan_job_count);
+    for (uint32_t i = 0; i < header.plan_job_count; ++i) {
+        if (order[i] >= header.plan_job_count) {
+            throw std::runtime_error("batch store plan order out of bounds");
+        }
+        const PlanJobRecord& record = jobs[order[i]];
+        if (static_cast<uint64_t>(record.dependencies_begin) + record.dependencies_count > header.dependency_count) {
+            throw std::runtime_error("batch store dependency range out of bounds");
+        }
+        std::string job_id(image.string(record.job_id));
+        std::vector<std::string> deps;
+        deps.reserve(record.dependencies_count);
+        for (uint32_t d = 0; d < record.dependencies_count; ++d) {
+            deps.emplace_back(image.string(dependencies[record.dependencies_begin + d]));
+        }
+        plan.job_types[job_id] = std::string(image.string(record.job_type));
+        plan.execution_order[job_id] = static_cast<size_t>(record.execution_order);
+        plan.dependencies[job_id] = std::move(deps);
+        plan.job_ids.push_back(std::move(job_id));
+    }
+}
+
+void BatchArtifactStore::read_execution_state(BatchExecutionArtifact& execution) const {
+    const Image& image = *image_;
+    const JobStateRecord* states = image.section<JobStateRecord>(kJobStates);
+
+    execution = BatchExecutionArtifact{};
+    execution.batch_id = std::string(batch_id());
+    execution.execution_complete = execution_complete();
+    execution.job_states.reserve(image.header.job_state_count);
+    for (uint32_t i = 0; i < image.header.job_state_count; ++i) {
+        execution.job_states.push_back(image.job_state(states[i]));
+    }
+}
+
+void BatchArtifactStore::read_policy_resolutions(BatchPolicyArtifact& policies) const {
+    const Image& image = *image_;
+    const PolicyRecord* records = image.section<PolicyRecord>(kPolicies);
+
+    policies = BatchPolicyArtifact{};
+    policies.batch_id = std::string(batch_id());
+    policies.policy_resolutions.reserve(image.header.policy_count);
+    for (uint32_t i = 0; i < image.header.policy_count; ++i) {
+        const PolicyRecord& record = records[i];
+        policies.policy_resolutions.push_back(PolicyResolution{
+            .job_id = std::string(image.string(record.job_id)),
+            .policy_type = std::string(image.string(record.policy_type)),
+            .policy_applied = std::string(image.string(record.policy_applied)),
+            .resolved_decision = std::string(image.string(record.resolved_decision)),
+            .resolution_timestamp = std::string(image.string(record.resolution_timestamp))
+        });
+    }
+}
+
+void BatchArtifactStore::read_artifact_index(BatchArtifactIndex& index) const {
+    const Image& image = *image_;
+    const ArtifactRecord* records = image.section<ArtifactRecord>(kArtifacts);
+
+    index = BatchArtifactIndex{};
+    index.batch_id = std::string(batch_id());
+    index.artifacts.reserve(image.header.artifact_count);
+    for (uint32_t i = 0; i < image.header.artifact_count; ++i) {
+        index.artifacts.push_back(image.artifact(records[i]));
+    }
+}
+
+std::optional<JobExecutionState> BatchArtifactStore::find_job_state(std::string_view job_id) const {
+    const JobStateRecord* record = image_->find<JobStateRecord>(
+        kJobStates, image_->header.job_state_count, job_id,
+        [](const JobStateRecord& r) -> const StringRef& { return r.job_id; });
+    if (!record) {
+        return std::nullopt;
+    }
+    return image_->job_state(*record);
+}
+
+std::optional<ArtifactMetadata> BatchArtifactStore::find_artifact(std::string_view artifact_id) const {
+    const ArtifactRecord* record = image_->find<ArtifactRecord>(
+        kArtifacts, image_->header.artifact_count, artifact_id,
+        [](const ArtifactRecord& r) -> const StringRef& { return r.artifact_id; });
+    if (!record) {
+        return std::nullopt;
+    }
+    return image_->artifact(*record);
+}
+
+void BatchArtifactStore::find_plan_jobs(std::string_view job_type, std::vector<BatchJobSummary>& jobs) const {
+    const Image& image = *image_;
+    const uint32_t count = image.header.plan_job_count;
+    const PlanJobRecord* records = image.section<PlanJobRecord>(kPlanJobs);
+    jobs.clear();
+
+    if (job_type.empty()) {
+        const uint32_t* order = image.section<uint32_t>(kPlanOrder);
+        jobs.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (order[i] >= count) {
+                throw std::runtime_error("batch store plan order out of bounds");
+            }
+            jobs.push_back(image.plan_job(records[order[i]]));
+        }
+        return;
+    }
+
+    const uint32_t* index = image.section<uint32_t>(kPlanJobsByType);
+    auto [begin, end] = image.equal_range<PlanJobRecord>(
+        index, index + count, kPlanJobs, count, job_type,
+        [](const PlanJobRecord& r) -> const StringRef& { return r.job_type; });
+    jobs.reserve(static_cast<size_t>(end - begin));
+    for (const uint32_t* it = begin; it != end; ++it) {
+        if (*it >= count) {
+            throw std::runtime_error("batch store index entry out of bounds");
+        }
+        jobs.push_back(image.plan_job(records[*it]));
+    }
+}
+
+void BatchArtifactStore::find_job_states(std::string_view final_state, std::vector<JobExecutionState>& states) const {
+    const Image& image = *image_;
+    const uint32_t count = image.header.job_state_count;
+    const JobStateRecord* records = image.section<JobStateRecord>(kJobStates);
+    states.clear();
+
+    if (final_state.empty()) {
+        states.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            states.push_back(image.job_state(records[i]));
+        }
+        return;
+    }
+
+    const uint32_t* index = image.section<uint32_t>(kJobStatesByState);
+    auto [begin, end] = image.equal_range<JobStateRecord>(
+        index, index + count, kJobStates, count, final_state,
+        [](const JobStateRecord& r) -> const StringRef& { return r.final_state; });
+    states.reserve(static_cast<size_t>(end - begin));
+    for (const uint32_t* it = begin; it != end; ++it) {
+        if (*it >= count) {
+            throw std::runtime_error("batch store index entry out of bounds");
+        }
+        states.push_back(image.job_state(records[*it]));
+    }
+}
+
+void BatchArtifactStore::find_artifacts(std::string_view artifact_type, std::string_view job_id,
+                                        std::vector<ArtifactMetadata>& artifacts) const {
+    const Image& image = *image_;
+    const uint32_t count = image.header.artifact_count;
+    const ArtifactRecord* records = image.section<ArtifactRecord>(kArtifacts);
+    auto type_of = [](const ArtifactRecord& r) -> const StringRef& { return r.artifact_type; };
+    auto job_of = [](const ArtifactRecord& r) -> const StringRef& { return r.job_id; };
+
+    // Both indexes yield (job_id, artifact_type, artifact_id) order for their filter
+    const uint32_t* begin;
+    const uint32_t* end;
+    if (!job_id.empty()) {
+        const uint32_t* index = image.section<uint32_t>(kArtifactsByJob);
+        std::tie(begin, end) = image.equal_range<ArtifactRecord>(index, index + count, kArtifacts, count, job_id, job_of);
+        if (!artifact_type.empty()) {
+            // Within one job the index is grouped by type
+            std::tie(begin, end) = image.equal_range<ArtifactRecord>(begin, end, kArtifacts, count, artifact_type, type_of);
+        }
+    } else if (!artifact_type.empty()) {
+        const uint32_t* index = image.section<uint32_t>(kArtifactsByType);
+        std::tie(begin, end) = image.equal_range<ArtifactRecord>(index, index + count, kArtifacts, count, artifact_type, type_of);
+    } else {
+        begin = image.section<uint32_t>(kArtifactsByJob);
+        end = begin + count;
+    }
+
+    artifacts.clear();
+    artifacts.reserve(static_cast<size_t>(end - begin));
+    for (const uint32_t* it = begin; it != end; ++it) {
+        if (*it >= count) {
+            throw std::runtime_error("batch store index entry out of bounds");
+        }
+        artifacts.push_back(image.artifact(records[*it]));
+    }
+}
+
+} // namespace nx::cli
@@ -1,22 +1,24 @@
 #include "batch_command.h"
 #include "batch_argument_parser.h"
 #include "batch_introspection_command.h"
-#include <fstream>
+#include "json_writer.h"
+#include <algorithm>
 #include <iostream>
-#include <sstream>
+#include <iterator>
 #include <map>
+#include <thread>
 
 namespace nx::cli {
 
-CliResult BatchCommand::execute(const std::vector<std::string>& args) {
+CliResult BatchCommand::execute(const std::vector<std::string>& args, std::ostream& out) {
     if (args.empty() || args[0] == "--help" || args[0] == "-h") {
-        std::cout << "nx batch - Deterministic command list executor\\n\\n";
-        std::cout << "Operations:\\n";
-        std::cout << "  run         Execute batch file sequentially\\n";
-        std::cout << "  validate    Validate batch file without execution\\n";
-        std::cout << "  summarize   Static summary of batch file contents\\n";
-        std::cout << "  inspect     Read-only batch introspection (Phase 14A)\\n\\n";
-        std::cout << "Use 'nx batch <operation> --help' for operation-specific help\\n";
+        out << "nx batch - Deterministic command list executor\\n\\n";
+        out << "Operations:\\n";
+        out << "  run         Execute batch file sequentially\\n";
+        out << "  validate    Validate batch file without execution\\n";
+        out << "  summarize   Static summary of batch file contents\\n";
+        out << "  inspect     Read-only batch introspection (Phase 14A)\\n\\n";
+        out << "Use 'nx batch <operation> --help' for operation-specific help\\n";
         return CliResult::ok();
     }
     
@@ -29,7 +31,7 @@ CliResult BatchCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_run(request);
+        return handle_run(request, out);
         
     } else if (operation == "validate") {
         BatchValidateRequest request;
@@ -37,7 +39,7 @@ CliResult BatchCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_validate(request);
+        return handle_validate(request, out);
         
     } else if (operation == "summarize") {
         BatchSummaryRequest request;
@@ -45,11 +47,11 @@ CliResult BatchCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_summarize(request);
+        return handle_summarize(request, out);
         
     } else if (operation == "inspect") {
         // Phase 14A: Route to batch introspection command
-        return BatchIntrospectionCommand::execute(operation_args);
+        return BatchIntrospectionCommand::execute(operation_args, out);
         
     } else {
         return CliResult::error(
@@ -59,95 +61,177 @@ CliResult BatchCommand::execute(const std::vector<std::string>& args) {
     }
 }
 
-CliResult BatchCommand::handle_run(const BatchRunRequest& request) {
-    std::vector<std::string> commands;
-    auto file_result = read_batch_file(request.batch_file, commands);
-    if (!file_result.success) {
-        return file_result;
-    }
+CliResult BatchCommand::handle_run(const BatchRunRequest& request, std::ostream& out) {
+    size_t command_count = 0;
+    bool started = false;
     
-    // Validate all commands before execution
-    for (size_t i = 0; i < commands.size(); ++i) {
-        auto validation_result = validate_command_line(commands[i], static_cast<int>(i + 1));
-        if (!validation_result.success) {
-            return validation_result;
+    auto result = for_each_validated_chunk(request.batch_file, [&](const std::vector<BatchLine>& chunk) {
+        if (!started) {
+            print_run_header(out, request);
+            started = true;
+        }
+        for (const auto& line : chunk) {
+            print_run_command(out, request, ++command_count, line.text);
         }
+    });
+    if (!result.success) {
+        return result;
     }
     
-    print_run_output(request, commands);
+    if (!started) {
+        print_run_header(out, request);  // Empty file: plan with no commands
+    }
+    print_run_footer(out, request, command_count);
     return CliResult::ok();
 }
 
-CliResult BatchCommand::handle_validate(const BatchValidateRequest& request) {
-    std::vector<std::string> commands;
-    auto file_result = read_batch_file(request.batch_file, commands);
-    if (!file_result.success) {
-        return file_result;
+CliResult BatchCommand::handle_validate(const BatchValidateRequest& request, std::ostream& out) {
+    BatchFileReader reader;
+    auto open_result = reader.open(request.batch_file);
+    if (!open_result.success) {
+        return open_result;
     }
     
-    // Validate all commands
-    for (size_t i = 0; i < commands.size(); ++i) {
-        auto validation_result = validate_command_line(commands[i], static_cast<int>(i + 1));
-        if (!validation_result.success) {
-            return validation_result;
+    const size_t max_errors = request.flags.max_errors;
+    size_t command_count = 0;
+    std::vector<LineError> errors;
+    std::vector<BatchLine> chunk;
+    chunk.reserve(kValidateChunkLines);
+    
+    while (reader.next_chunk(chunk, kValidateChunkLines)) {
+        command_count += chunk.size();
+        size_t remaining = max_errors > 0 ? max_errors - errors.size() : 0;
+        auto chunk_errors = validate_chunk(chunk, remaining);
+        std::move(chunk_errors.begin(), chunk_errors.end(), std::back_inserter(errors));
+        if (max_errors > 0 && errors.size() >= max_errors) {
+            break;  // Early cutoff: remaining chunks are never read
         }
     }
     
-    print_validate_output(request, commands);
-    return CliResult::ok();
+    if (errors.empty()) {
+        print_validate_output(out, request, command_count);
+        return CliResult::ok();
+    }
+    
+    bool limit_reached = max_errors > 0 && errors.size() >= max_errors;
+    print_validate_errors(out, request, errors, limit_reached);
+    
+    std::string message;
+    for (const auto& error : errors) {
+        if (!message.empty()) message += "\n";
+        message += error.message;
+    }
+    if (limit_reached) {
+        message += "\nStopped after " + std::to_string(errors.size()) + " errors (--max-errors)";
+    }
+    return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, message);
 }
 
-CliResult BatchCommand::handle_summarize(const BatchSummaryRequest& request) {
-    std::vector<std::string> commands;
-    auto file_result = read_batch_file(request.batch_file, commands);
-    if (!file_result.success) {
-        return file_result;
-    }
+CliResult BatchCommand::handle_summarize(const BatchSummaryRequest& request, std::ostream& out) {
+    size_t command_count = 0;
+    std::map<std::string, int> component_counts;
     
-    // Validate all commands
-    for (size_t i = 0; i < commands.size(); ++i) {
-        auto validation_result = validate_command_line(commands[i], static_cast<int>(i + 1));
-        if (!validation_result.success) {
-            return validation_result;
+    auto result = for_each_validated_chunk(request.batch_file, [&](const std::vector<BatchLine>& chunk) {
+        command_count += chunk.size();
+        for (const auto& line : chunk) {
+            component_counts[std::string(command_component(line.text))]++;
         }
+    });
+    if (!result.success) {
+        return result;
     }
     
-    print_summary_output(request, commands);
+    print_summary_output(out, request, command_count, component_counts);
     return CliResult::ok();
 }
 
-CliResult BatchCommand::read_batch_file(const std::string& file_path, std::vector<std::string>& commands) {
-    std::ifstream file(file_path);
-    if (!file.is_open()) {
-        return CliResult::error(
-            CliErrorCode::NX_CLI_USAGE_ERROR,
-            "Cannot read batch file: " + file_path
-        );
+CliResult BatchCommand::for_each_validated_chunk(const std::string& file_path,
+                                                 const std::function<void(const std::vector<BatchLine>&)>& on_chunk) {
+    std::vector<BatchLine> chunk;
+    chunk.reserve(BatchFileReader::kDefaultChunkLines);
+    
+    // Pass 1: validate every line before anything is dispatched
+    {
+        BatchFileReader reader;
+        auto open_result = reader.open(file_path);
+        if (!open_result.success) {
+            return open_result;
+        }
+        while (reader.next_chunk(chunk)) {
+            for (const auto& line : chunk) {
+                auto validation_result = validate_command_line(line.text, line.line_number);
+                if (!validation_result.success) {
+                    return validation_result;
+                }
+            }
+        }
     }
     
-    commands.clear();
-    std::string line;
-    int line_number = 0;
+    // Pass 2: re-stream the now-validated file to the consumer
+    BatchFileReader reader;
+    auto open_result = reader.open(file_path);
+    if (!open_result.success) {
+        return open_result;
+    }
+    while (reader.next_chunk(chunk)) {
+        on_chunk(chunk);
+    }
     
-    while (std::getline(file, line)) {
-        line_number++;
-        
-        // Reject empty lines
-        if (line.empty()) {
-            return CliResult::error(
-                CliErrorCode::NX_CLI_USAGE_ERROR,
-                "Empty command at line " + std::to_string(line_number)
-            );
+    return CliResult::ok();
+}
+
+std::vector<BatchCommand::LineError> BatchCommand::validate_chunk(const std::vector<BatchLine>& chunk,
+                                                                  size_t max_errors) {
+    // Validate lines [begin, end) in order, keeping at most max_errors
+    auto validate_range = [&chunk, max_errors](size_t begin, size_t end, std::vector<LineError>& out) {
+        for (size_t i = begin; i < end; ++i) {
+            auto result = validate_command_line(chunk[i].text, chunk[i].line_number);
+            if (!result.success) {
+                out.push_back({chunk[i].line_number, std::move(result.message)});
+                if (max_errors > 0 && out.size() >= max_errors) {
+                    return;
+                }
+            }
         }
-        
-        commands.push_back(line);
+    };
+    
+    std::vector<LineError> errors;
+    size_t worker_count = std::max(1u, std::thread::hardware_concurrency());
+    if (chunk.size() < kParallelValidateThreshold || worker_count == 1) {
+        validate_range(0, chunk.size(), errors);
+        return errors;
     }
     
-    return CliResult::ok();
+    // Contiguous slices per worker; concatenating slice results in order keeps
+    // errors sorted by line. Each slice only needs its own first max_errors.
+    worker_count = std::min(worker_count, chunk.size() / (kParallelValidateThreshold / 2));
+    std::vector<std::vector<LineError>> slice_errors(worker_count);
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count - 1);
+    size_t slice_size = (chunk.size() + worker_count - 1) / worker_count;
+    for (size_t w = 1; w < worker_count; ++w) {
+        size_t begin = std::min(chunk.size(), w * slice_size);
+        size_t end = std::min(chunk.size(), begin + slice_size);
+        workers.emplace_back(validate_range, begin, end, std::ref(slice_errors[w]));
+    }
+    validate_range(0, std::min(chunk.size(), slice_size), slice_errors[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    
+    for (auto& slice : slice_errors) {
+        for (auto& error : slice) {
+            if (max_errors > 0 && errors.size() >= max_errors) {
+                return errors;
+            }
+            errors.push_back(std::move(error));
+        }
+    }
+    return errors;
 }
 
-CliResult BatchCommand::validate_command_line(const std::string& line, int line_number) {
-    // Reject empty lines (already filtered in read_batch_file)
+CliResult BatchCommand::validate_command_line(std::string_view line, int line_number) {
+    // Reject empty lines
     if (line.empty()) {
         return CliResult::error(
             CliErrorCode::NX_CLI_USAGE_ERROR,
@@ -164,20 +248,18 @@ CliResult BatchCommand::validate_command_line(const std::string& line, int line_
     }
     
     // Check for forbidden shell operators
-    std::vector<std::string> forbidden = {"&&", "|", ";", "$", "${", "./nx"};
-    for (const auto& op : forbidden) {
-        if (line.find(op) != std::string::npos) {
+    static constexpr std::string_view forbidden[] = {"&&", "|", ";", "$", "${", "./nx"};
+    for (auto op : forbidden) {
+        if (line.find(op) != std::string_view::npos) {
             return CliResult::error(
                 CliErrorCode::NX_CLI_USAGE_ERROR,
-                "Forbidden operator '" + op + "' at line " + std::to_string(line_number)
+                "Forbidden operator '" + std::string(op) + "' at line " + std::to_string(line_number)
             );
         }
     }
     
     // Extract component name (word after "nx ")
-    std::istringstream iss(line);
-    std::string nx, component;
-    iss >> nx >> component;
+    std::string_view component = command_component(line);
     
     if (component.empty()) {
         return CliResult::error(
@@ -187,96 +269,144 @@ CliResult BatchCommand::validate_command_line(const std::string& line, int line_
     }
     
     // Validate known components (exclude batch to prevent recursion)
-    std::vector<std::string> known_components = {"convert", "metafix", "audio", "video"};
-    if (std::find(known_components.begin(), known_components.end(), component) == known_components.end()) {
+    static constexpr std::string_view known_components[] = {"convert", "metafix", "audio", "video"};
+    if (std::find(std::begin(known_components), std::end(known_components), component) == std::end(known_components)) {
         return CliResult::error(
             CliErrorCode::NX_CLI_USAGE_ERROR,
-            "Unknown component '" + component + "' at line " + std::to_string(line_number)
+            "Unknown component '" + std::string(component) + "' at line " + std::to_string(line_number)
         );
     }
     
     return CliResult::ok();
 }
 
-void BatchCommand::print_run_output(const BatchRunRequest& request, const std::vector<std::string>& commands) {
-    if (request.flags.json_output) {
-        std::cout << "{\n";
-        std::cout << "  \"operation\": \"run\",\n";
-        std::cout << "  \"file\": \"" << request.batch_file << "\",\n";
-        std::cout << "  \"dry_run\": " << (request.flags.dry_run ? "true" : "false") << ",\n";
-        std::cout << "  \"commands\": [\n";
-        
-        for (size_t i = 0; i < commands.size(); ++i) {
-            std::cout << "    { \"index\": " << (i + 1) << ", \"command\": \"" << commands[i] << "\" }";
-            if (i < commands.size() - 1) std::cout << ",";
-            std::cout << "\n";
+std::string_view BatchCommand::command_component(std::string_view line) {
+    // Second whitespace-separated word, as extracted by operator>>
+    auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r'; };
+    size_t pos = 0;
+    for (int word = 0; word < 2; ++word) {
+        while (pos < line.size() && is_space(line[pos])) ++pos;
+        size_t start = pos;
+        while (pos < line.size() && !is_space(line[pos])) ++pos;
+        if (word == 1) {
+            return line.substr(start, pos - start);
         }
-        
-        std::cout << "  ]\n";
-        std::cout << "}\n";
+    }
+    return {};
+}
+
+void BatchCommand::print_run_header(std::ostream& out, const BatchRunRequest& request) {
+    if (request.flags.json_output) {
+        std::string buffer;
+        JsonWriter json(buffer);
+        json.raw("{\n");
+        json.raw("  \"operation\": \"run\",\n");
+        json.raw("  \"file\": ").string(request.batch_file).raw(",\n");
+        json.raw("  \"dry_run\": ").boolean(request.flags.dry_run).raw(",\n");
+        json.raw("  \"commands\": [\n");
+        out << buffer;
     } else {
-        std::cout << "Batch execution plan:\n";
-        for (size_t i = 0; i < commands.size(); ++i) {
-            std::cout << (i + 1) << ". " << commands[i] << "\n";
-        }
+        out << "Batch execution plan:\n";
     }
 }
 
-void BatchCommand::print_validate_output(const BatchValidateRequest& request, const std::vector<std::string>& commands) {
+void BatchCommand::print_run_command(std::ostream& out, const BatchRunRequest& request, size_t index, std::string_view command) {
     if (request.flags.json_output) {
-        std::cout << "{\n";
-        std::cout << "  \"operation\": \"validate\",\n";
-        std::cout << "  \"file\": \"" << request.batch_file << "\",\n";
-        std::cout << "  \"valid\": true,\n";
-        std::cout << "  \"command_count\": " << commands.size() << "\n";
-        std::cout << "}\n";
+        // Commands are batch file text and may contain any character
+        std::string buffer;
+        JsonWriter json(buffer);
+        if (index > 1) json.raw(",\n");
+        json.raw("    { \"index\": ").number(index).raw(", \"command\": ").string(command).raw(" }");
+        out << buffer;
     } else {
-        std::cout << "Batch file validation: PASSED\n";
-        std::cout << "Commands: " << commands.size() << "\n";
-        std::cout << "File: " << request.batch_file << "\n";
+        out << index << ". " << command << "\n";
     }
 }
 
-void BatchCommand::print_summary_output(const BatchSummaryRequest& request, const std::vector<std::string>& commands) {
-    // Count commands per component
-    std::map<std::string, int> component_counts;
-    
-    for (const auto& command : commands) {
-        std::istringstream iss(command);
-        std::string nx, component;
-        iss >> nx >> component;
-        
-        if (!component.empty()) {
-            component_counts[component]++;
-        }
+void BatchCommand::print_run_footer(std::ostream& out, const BatchRunRequest& request, size_t command_count) {
+    if (!request.flags.json_output) {
+        return;
     }
-    
+    if (command_count > 0) out << "\n";
+    out << "  ]\n";
+    out << "}\n";
+}
+
+void BatchCommand::print_validate_output(std::ostream& out, const BatchValidateRequest& request, size_t command_count) {
+    if (request.flags.json_output) {
+        // Same writer as print_validate_errors, so the path escapes identically
+        std::string buffer;
+        JsonWriter json(buffer);
+        json.raw("{\n");
+        json.raw("  \"operation\": \"validate\",\n");
+        json.raw("  \"file\": ").string(request.batch_file).raw(",\n");
+        json.raw("  \"valid\": true,\n");
+        json.raw("  \"command_count\": ").number(command_count).raw("\n");
+        json.raw("}\n");
+        out << buffer;
+    } else {
+        out << "Batch file validation: PASSED\n";
+        out << "Commands: " << command_count << "\n";
+        out << "File: " << request.batch_file << "\n";
+    }
+}
+
+void BatchCommand::print_validate_errors(std::ostream& out, const BatchValidateRequest& request,
+                                         const std::vector<LineError>& errors, bool limit_reached) {
+    if (!request.flags.json_output) {
+        return;  // Text mode reports errors through the CliResult message
+    }
+    // Error messages quote batch file text, which may contain any character
+    std::string buffer;
+    JsonWriter json(buffer);
+    json.raw("{\n");
+    json.raw("  \"operation\": \"validate\",\n");
+    json.raw("  \"file\": ").string(request.batch_file).raw(",\n");
+    json.raw("  \"valid\": false,\n");
+    json.raw("  \"error_count\": ").number(errors.size()).raw(",\n");
+    json.raw("  \"max_errors_reached\": ").boolean(limit_reached).raw(",\n");
+    json.raw("  \"errors\": [\n");
+    for (size_t i = 0; i < errors.size(); ++i) {
+        if (i > 0) json.raw(",\n");
+        json.raw("    { \"line\": ").number(errors[i].line_number)
+            .raw(", \"message\": ").string(errors[i].message).raw(" }");
+    }
+    json.raw("\n  ]\n");
+    json.raw("}\n");
+    out << buffer;
+}
+
+void BatchCommand::print_summary_output(std::ostream& out, const BatchSummaryRequest& request, size_t command_count,
+                                        const std::map<std::string, int>& component_counts) {
     if (request.flags.json_output) {
-        std::cout << "{\n";
-        std::cout << "  \"operation\": \"summarize\",\n";
-        std::cout << "  \"file\": \"" << request.batch_file << "\",\n";
-        std::cout << "  \"total_commands\": " << commands.size() << ",\n";
-        std::cout << "  \"components\": {\n";
+        std::string buffer;
+        JsonWriter json(buffer);
+        json.raw("{\n");
+        json.raw("  \"operation\": \"summarize\",\n");
+        json.raw("  \"file\": ").string(request.batch_file).raw(",\n");
+        json.raw("  \"total_commands\": ").number(command_count).raw(",\n");
+        json.raw("  \"components\": {\n");
         
         bool first = true;
         for (const auto& [component, count] : component_counts) {
-            if (!first) std::cout << ",\n";
-            std::cout << "    \"" << component << "\": " << count;
+            if (!first) json.raw(",\n");
+            json.raw("    ").string(component).raw(": ").number(count);
             first = false;
         }
         
-        std::cout << "\n  }\n";
-        std::cout << "}\n";
+        json.raw("\n  }\n");
+        json.raw("}\n");
+        out << buffer;
     } else {
-        std::cout << "Batch file summary:\n";
-        std::cout << "File: " << request.batch_file << "\n";
-        std::cout << "Total commands: " << commands.size() << "\n";
-        std::cout << "Components:\n";
+        out << "Batch file summary:\n";
+        out << "File: " << request.batch_file << "\n";
+        out << "Total commands: " << command_count << "\n";
+        out << "Components:\n";
         
         for (const auto& [component, count] : component_counts) {
-            std::cout << "  " << component << ": " << count << "\n";
+            out << "  " << component << ": " << count << "\n";
         }
     }
 }
 
-} // namespace nx::cli
\ No newline at end of file
+} // namespace nx::cli
@@ -0,0 +1,112 @@
+#include "batch_file_reader.h"
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nx::cli {
+
+BatchFileReader::~BatchFileReader() {
+    close();
+}
+
+void BatchFileReader::close() {
+#if !defined(_WIN32)
+    if (mapped_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    offset_ = 0;
+    released_ = 0;
+    mapped_ = false;
+    if (stream_.is_open()) {
+        stream_.close();
+    }
+    storage_.clear();
+    line_number_ = 0;
+}
+
+CliResult BatchFileReader::open(const std::string& file_path) {
+    close();
+    auto unreadable = [&file_path]() {
+        return CliResult::error(CliErrorCode::NX_CLI_USAGE_ERROR, "Cannot read batch file: " + file_path);
+    };
+
+#if !defined(_WIN32)
+    int fd = ::open(file_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return unreadable();
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        return unreadable();
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ > 0) {
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            size_ = 0;
+            return unreadable();
+        }
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapping);
+        mapped_ = true;
+    }
+    ::close(fd);
+    return CliResult::ok();
+#else
+    stream_.open(file_path, std::ios::binary);
+    if (!stream_.is_open()) {
+        return unreadable();
+    }
+    return CliResult::ok();
+#endif
+}
+
+bool BatchFileReader::next_chunk(std::vector<BatchLine>& chunk, size_t max_lines) {
+    chunk.clear();
+
+#if !defined(_WIN32)
+    // Release pages fully behind the previous chunk
+    if (mapped_) {
+        static const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t release_end = offset_ / page_size * page_size;
+        if (release_end > released_) {
+            ::madvise(const_cast<char*>(data_) + released_, release_end - released_, MADV_DONTNEED);
+            released_ = release_end;
+        }
+    }
+#endif
+
+    if (!stream_.is_open()) {
+        while (chunk.size() < max_lines && offset_ < size_) {
+            const char* begin = data_ + offset_;
+            const char* newline = static_cast<const char*>(std::memchr(begin, '\n', size_ - offset_));
+            size_t length = newline != nullptr ? static_cast<size_t>(newline - begin) : size_ - offset_;
+            chunk.push_back(BatchLine{std::string_view(begin, length), ++line_number_});
+            offset_ += length + (newline != nullptr ? 1 : 0);
+        }
+        return !chunk.empty();
+    }
+
+    // Buffered fallback: storage is reused across chunks
+    storage_.resize(max_lines);
+    size_t count = 0;
+    while (count < max_lines && std::getline(stream_, storage_[count])) {
+        ++count;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        chunk.push_back(BatchLine{storage_[i], ++line_number_});
+    }
+    return !chunk.empty();
+}
+
+} // namespace nx::cli
@@ -0,0 +1,97 @@
+#include "cli_serve.h"
+#include "error/CliError.h"
+#include "json_writer.h"
+#include "nx_batchflow_json.h"
+#include <istream>
+#include <ostream>
+
+namespace nx::cli {
+
+namespace {
+
+// id token is kept verbatim so it is echoed exactly as sent
+bool is_valid_id(std::string_view token) {
+    if (token == "null" || token.front() == '"') {
+        return true;
+    }
+    size_t digits = token.front() == '-' ? 1 : 0;
+    return digits < token.size() &&
+           token.find_first_not_of("0123456789", digits) == std::string_view::npos;
+}
+
+} // namespace
+
+std::optional<std::string> parse_serve_request(std::string_view line, ServeRequest& request) {
+    request = ServeRequest{};
+    try {
+        nx::batchflow::JsonReader reader(line);
+        bool has_args = false;
+        reader.begin_object();
+        std::string_view key;
+        while (reader.next_key(key)) {
+            if (key == "id") {
+                size_t start = reader.offset();
+                reader.skip_value();
+                std::string_view token = line.substr(start, reader.offset() - start);
+                token.remove_prefix(token.find_first_not_of(" \t\r\n"));
+                if (!is_valid_id(token)) {
+                    return "'id' must be an integer, string or null";
+                }
+                request.id_json.assign(token);
+            } else if (key == "args") {
+                request.args.clear();
+                reader.begin_array();
+                while (reader.next_element()) {
+                    request.args.emplace_back(reader.read_string());
+                }
+                has_args = true;
+            } else {
+                return "unknown key '" + std::string(key) + "'";
+            }
+        }
+        reader.expect_end();
+        if (!has_args) {
+            return "missing 'args'";
+        }
+    } catch (const nx::batchflow::JsonParseError& e) {
+        return std::string(e.what());
+    }
+    return std::nullopt;
+}
+
+std::string format_serve_response(std::string_view id_json, const CliExecutionResult& result) {
+    std::string response;
+    response.reserve(64 + result.stdout_text.size() + result.stderr_text.size());
+    // Unicode escaping covers everything below 0x20, so a response never spans more than one line
+    JsonWriter json(response);
+    json.raw("{\"id\":").raw(id_json);
+    json.raw(",\"exit_code\":").number(result.exit_code);
+    json.raw(",\"stdout\":").string(result.stdout_text);
+    json.raw(",\"stderr\":").string(result.stderr_text);
+    json.raw('}');
+    return response;
+}
+
+int serve(std::istream& in, std::ostream& out) {
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;  // Blank keep-alive lines get no response
+        }
+
+        ServeRequest request;
+        CliExecutionResult result;
+        if (auto error = parse_serve_request(line, request)) {
+            result.exit_code = error::CliErrorMapper::to_exit_code(error::CliError::InvalidCommand);
+            result.stderr_text = "Invalid serve request: " + *error + "\n";
+        } else {
+            result = execute_command(request.args);
+        }
+
+        out << format_serve_response(request.id_json, result) << '\n';
+        out.flush();
+    }
+    return 0;
+}
+
+} // namespace nx::cli
@@ -11,7 +11,7 @@ MonitorStatusDto::MonitorStatusDto(const nx::monitor::SystemStatus& status)
     , current_state(status.healthy ? "active" : "inactive")
     , active_jobs_count(status.active_jobs)
     , completed_jobs_count(status.completed_jobs)
-    , failed_jobs_count(0)
+    , failed_jobs_count(status.failed_jobs)
 {
 }
 
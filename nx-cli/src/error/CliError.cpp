@@ -1,4 +1,5 @@
 #include "CliError.h"
+#include "cli_types.h"
 
 namespace nx::cli::error {
 
@@ -6,6 +7,26 @@ CliError CliErrorMapper::from_monitor_error(const nx::monitor::MonitorError& err
     return CliError::InternalError;
 }
 
+CliError CliErrorMapper::from_cli_error_code(CliErrorCode code) {
+    switch (code) {
+        case CliErrorCode::NONE:
+            return CliError::Success;
+        case CliErrorCode::NX_CLI_USAGE_ERROR:
+        case CliErrorCode::NX_CLI_ENUM_ERROR:
+            return CliError::InvalidCommand;
+        case CliErrorCode::NX_ENGINE_REJECTED:
+        case CliErrorCode::ERROR_EXECUTION_INCOMPLETE:
+            return CliError::EngineUnavailable;
+        case CliErrorCode::ERROR_BATCH_NOT_FOUND:
+        case CliErrorCode::ERROR_JOB_NOT_FOUND:
+        case CliErrorCode::ERROR_ARTIFACT_NOT_FOUND:
+            return CliError::ArtifactNotFound;
+        case CliErrorCode::NX_EXEC_FAILED:
+            return CliError::InternalError;
+    }
+    return CliError::InternalError;
+}
+
 int CliErrorMapper::to_exit_code(CliError error) {
     switch (error) {
         case CliError::Success:
@@ -4,6 +4,10 @@ namespace nx::monitor {
     class MonitorError;
 }
 
+namespace nx::cli {
+    enum class CliErrorCode;
+}
+
 namespace nx::cli::error {
 
 enum class CliError {
@@ -20,6 +24,7 @@ enum class CliError {
 class CliErrorMapper {
 public:
     static CliError from_monitor_error(const nx::monitor::MonitorError& error);
+    static CliError from_cli_error_code(CliErrorCode code);
     static int to_exit_code(CliError error);
 };
 
@@ -0,0 +1,86 @@
+#include "fd_output_stream.h"
+#include <cerrno>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace nx::cli {
+
+namespace {
+
+constexpr size_t kBufferSize = 64 * 1024;
+
+} // namespace
+
+FdOutputStream::FdOutputStream(int fd)
+    : std::ostream(nullptr)
+    , buffer_(fd) {
+    rdbuf(&buffer_);
+}
+
+FdOutputStream::~FdOutputStream() {
+    flush();
+}
+
+FdOutputStream::Buffer::Buffer(int fd)
+    : fd_(fd)
+    , storage_(kBufferSize) {
+    setp(storage_.data(), storage_.data() + storage_.size());
+}
+
+FdOutputStream::Buffer::int_type FdOutputStream::Buffer::overflow(int_type ch) {
+    if (!drain()) {
+        return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize FdOutputStream::Buffer::xsputn(const char* data, std::streamsize size) {
+    // Large writes bypass the buffer instead of being copied through it
+    if (static_cast<size_t>(size) >= storage_.size()) {
+        if (!drain() || !write_all(data, static_cast<size_t>(size))) {
+            return 0;
+        }
+        return size;
+    }
+    return std::streambuf::xsputn(data, size);
+}
+
+int FdOutputStream::Buffer::sync() {
+    return drain() ? 0 : -1;
+}
+
+bool FdOutputStream::Buffer::drain() {
+    size_t pending = static_cast<size_t>(pptr() - pbase());
+    bool ok = write_all(pbase(), pending);
+    setp(storage_.data(), storage_.data() + storage_.size());
+    return ok;
+}
+
+bool FdOutputStream::Buffer::write_all(const char* data, size_t size) {
+    while (size > 0) {
+#if defined(_WIN32)
+        int written = ::_write(fd_, data, static_cast<unsigned>(size));
+#else
+        ssize_t written = ::write(fd_, data, size);
+#endif
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+} // namespace nx::cli
@@ -1,5 +1,8 @@
 #include "CliApp.h"
 #include "cli_execution.h"
+#include "cli_serve.h"
+#include "fd_output_stream.h"
+#include <cstdio>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -12,11 +15,13 @@ int main(int argc, char* argv[]) {
         args.emplace_back(argv[i]);
     }
     
-    auto result = nx::cli::execute_command(args);
-    
-    // Write captured output
-    std::cout << result.stdout_text;
-    std::cerr << result.stderr_text;
+    // Long-lived NDJSON session: one process serves many requests
+    if (args.size() == 1 && args[0] == "serve") {
+        return nx::cli::serve(std::cin, std::cout);
+    }
     
-    return result.exit_code;
+    // Stream output directly instead of buffering it; the descriptor-backed
+    // sink also lets artifact content bypass user space
+    nx::cli::FdOutputStream stdout_sink(fileno(stdout));
+    return nx::cli::execute_command(args, stdout_sink, std::cerr);
 }
\ No newline at end of file
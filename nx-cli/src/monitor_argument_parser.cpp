@@ -41,7 +41,7 @@ MonitorParseResult MonitorArgumentParser::parse_jobs_args(const std::vector<std:
 }
 
 MonitorParseResult MonitorArgumentParser::parse_job_args(const std::vector<std::string>& args, MonitorJobRequest& request) {
-    std::vector<std::string> allowed_flags = {"--id", "--json"};
+    std::vector<std::string> allowed_flags = {"--id", "--session", "--json"};
     
     auto validation_result = validate_no_unknown_flags(args, allowed_flags);
     if (!validation_result.success) {
@@ -62,6 +62,13 @@ MonitorParseResult MonitorArgumentParser::parse_job_args(const std::vector<std::
     }
     
     request.job_id = job_id;
+    request.session_id = get_flag_value(args, "--session");
+    if (has_flag(args, "--session") && request.session_id.empty()) {
+        return MonitorParseResult::error(
+            CliErrorCode::NX_CLI_USAGE_ERROR,
+            "Missing value for flag: --session"
+        );
+    }
     request.flags.json_output = has_flag(args, "--json");
     
     return MonitorParseResult::ok();
@@ -103,6 +110,35 @@ MonitorParseResult MonitorArgumentParser::parse_version_args(const std::vector<s
     return MonitorParseResult::ok();
 }
 
+MonitorParseResult MonitorArgumentParser::parse_stats_args(const std::vector<std::string>& args, MonitorStatsRequest& request) {
+    std::vector<std::string> allowed_flags = {"--json"};
+    
+    auto validation_result = validate_no_unknown_flags(args, allowed_flags);
+    if (!validation_result.success) {
+        return validation_result;
+    }
+    
+    auto duplicate_result = validate_no_duplicates(args);
+    if (!duplicate_result.success) {
+        return duplicate_result;
+    }
+    
+    request.flags.json_output = has_flag(args, "--json");
+    
+    return MonitorParseResult::ok();
+}
+
+MonitorParseResult MonitorArgumentParser::parse_metrics_args(const std::vector<std::string>& args, MonitorMetricsRequest& /* request */) {
+    if (!args.empty()) {
+        return MonitorParseResult::error(
+            CliErrorCode::NX_CLI_USAGE_ERROR,
+            "monitor metrics takes no arguments (output is OpenMetrics text)"
+        );
+    }
+    
+    return MonitorParseResult::ok();
+}
+
 bool MonitorArgumentParser::has_flag(const std::vector<std::string>& args, const std::string& flag) {
     return std::find(args.begin(), args.end(), flag) != args.end();
 }
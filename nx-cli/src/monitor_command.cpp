@@ -1,20 +1,82 @@
 #include "monitor_command.h"
 #include "monitor_argument_parser.h"
+#include "json_writer.h"
+#include "adapters/MonitorQueryAdapter.h"
+#include "dto/MonitorStatusDto.h"
+#include "serialize/MonitorStatusJsonSerializer.h"
+#include "serialize/MonitorStatusTextSerializer.h"
+#include "nx/monitor/OpenMetricsExporter.h"
+#include "nx/monitor/RemoteMonitorEngine.h"
+#include <cstdio>
 #include <iostream>
+#include <memory>
+#include <string_view>
 
 namespace nx::cli {
 
-CliResult MonitorCommand::execute(const std::vector<std::string>& args) {
+namespace {
+
+// Fixed three-decimal rendering keeps rates locale-independent
+std::string format_rate(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return buffer;
+}
+
+void write_latency_json(JsonWriter& json, const nx::monitor::LatencyStats& latency) {
+    json.raw("{ ");
+    json.raw("\"count\": ").number(latency.count);
+    json.raw(", \"sum\": ").number(latency.sum_us);
+    json.raw(", \"min\": ").number(latency.min_us);
+    json.raw(", \"p50\": ").number(latency.p50_us);
+    json.raw(", \"p90\": ").number(latency.p90_us);
+    json.raw(", \"p99\": ").number(latency.p99_us);
+    json.raw(", \"p999\": ").number(latency.p999_us);
+    json.raw(", \"max\": ").number(latency.max_us);
+    json.raw(", \"buckets\": [");
+    for (size_t i = 0; i < latency.buckets.size(); ++i) {
+        if (i > 0) json.raw(", ");
+        json.raw('[').number(latency.buckets[i].upper_bound_us).raw(", ")
+            .number(latency.buckets[i].count).raw(']');
+    }
+    json.raw("] }");
+}
+
+// Job state lives in the process executing sessions, never in nx-cli itself:
+// read it over that process's exporter socket, or refuse without one
+template <typename Handler>
+CliResult with_live_source(Handler&& handler) {
+    auto source = nx::monitor::RemoteMonitorEngine::from_environment();
+    if (!source) {
+        return CliResult::error(
+            CliErrorCode::NX_ENGINE_REJECTED,
+            std::string("No live monitor source attached: set ") + nx::monitor::kMonitorSocketEnv +
+                " to the exporter socket of the process running sessions"
+        );
+    }
+    try {
+        return handler(*source);
+    } catch (const nx::monitor::MonitorSourceError& e) {
+        return CliResult::error(CliErrorCode::NX_ENGINE_REJECTED, e.what());
+    }
+}
+
+} // namespace
+
+CliResult MonitorCommand::execute(const std::vector<std::string>& args, std::ostream& out) {
     if (args.empty() || args[0] == "--help" || args[0] == "-h") {
-        std::cout << "nx monitor - Read-only system observation\n\n";
-        std::cout << "Operations:\n";
-        std::cout << "  status      Global system status snapshot\n";
-        std::cout << "  jobs        List known jobs (summary only)\n";
-        std::cout << "  job         Single job snapshot\n";
-        std::cout << "  engines     List registered engines\n";
-        std::cout << "  version     Static version and build metadata\n\n";
-        std::cout << "IMPORTANT: Read-only observation only, no control operations\n";
-        std::cout << "Use 'nx monitor <operation> --help' for operation-specific help\n";
+        out << "nx monitor - Read-only system observation\n\n";
+        out << "Operations:\n";
+        out << "  status      Global system status snapshot\n";
+        out << "  jobs        List known jobs (summary only)\n";
+        out << "  job         Single job snapshot\n";
+        out << "  engines     List registered engines\n";
+        out << "  version     Static version and build metadata\n";
+        out << "  stats       Per-engine latency percentiles and throughput\n";
+        out << "  metrics     OpenMetrics text exposition for scrapers\n\n";
+        out << "Live state is read from the exporter socket named by " << nx::monitor::kMonitorSocketEnv << "\n";
+        out << "IMPORTANT: Read-only observation only, no control operations\n";
+        out << "Use 'nx monitor <operation> --help' for operation-specific help\n";
         return CliResult::ok();
     }
     
@@ -27,7 +89,7 @@ CliResult MonitorCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_status(request);
+        return handle_status(request, out);
         
     } else if (operation == "jobs") {
         MonitorJobsRequest request;
@@ -35,7 +97,7 @@ CliResult MonitorCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_jobs(request);
+        return handle_jobs(request, out);
         
     } else if (operation == "job") {
         MonitorJobRequest request;
@@ -43,7 +105,7 @@ CliResult MonitorCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_job(request);
+        return handle_job(request, out);
         
     } else if (operation == "engines") {
         MonitorEnginesRequest request;
@@ -51,7 +113,7 @@ CliResult MonitorCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_engines(request);
+        return handle_engines(request, out);
         
     } else if (operation == "version") {
         MonitorVersionRequest request;
@@ -59,45 +121,113 @@ CliResult MonitorCommand::execute(const std::vector<std::string>& args) {
         if (!parse_result.success) {
             return CliResult::error(parse_result.error_code, parse_result.message);
         }
-        return handle_version(request);
+        return handle_version(request, out);
+        
+    } else if (operation == "stats") {
+        MonitorStatsRequest request;
+        auto parse_result = MonitorArgumentParser::parse_stats_args(operation_args, request);
+        if (!parse_result.success) {
+            return CliResult::error(parse_result.error_code, parse_result.message);
+        }
+        return handle_stats(request, out);
+        
+    } else if (operation == "metrics") {
+        MonitorMetricsRequest request;
+        auto parse_result = MonitorArgumentParser::parse_metrics_args(operation_args, request);
+        if (!parse_result.success) {
+            return CliResult::error(parse_result.error_code, parse_result.message);
+        }
+        return handle_metrics(request, out);
         
     } else {
         return CliResult::error(
             CliErrorCode::NX_CLI_USAGE_ERROR,
-            "Unknown monitor operation: " + operation + ". Available: status, jobs, job, engines, version"
+            "Unknown monitor operation: " + operation + ". Available: status, jobs, job, engines, version, stats, metrics"
         );
     }
 }
 
-CliResult MonitorCommand::handle_status(const MonitorStatusRequest& /* request */) {
-    std::cout << "nx monitor: request accepted\n";
-    
-    return CliResult::error(
-        CliErrorCode::NX_ENGINE_REJECTED,
-        "MonitorEngine status not yet implemented"
-    );
+CliResult MonitorCommand::handle_status(const MonitorStatusRequest& request, std::ostream& out) {
+    return with_live_source([&](const nx::monitor::MonitorEngine& engine) {
+        auto status = adapters::MonitorQueryAdapter::query_status(engine);
+        dto::MonitorStatusDto dto(status);
+        
+        if (request.flags.json_output) {
+            out << serialize::MonitorStatusJsonSerializer::serialize(dto) << "\n";
+        } else {
+            out << serialize::MonitorStatusTextSerializer::serialize(dto);
+        }
+        return CliResult::ok();
+    });
 }
 
-CliResult MonitorCommand::handle_jobs(const MonitorJobsRequest& /* request */) {
-    std::cout << "nx monitor: request accepted\n";
-    
-    return CliResult::error(
-        CliErrorCode::NX_ENGINE_REJECTED,
-        "MonitorEngine jobs not yet implemented"
-    );
+CliResult MonitorCommand::handle_jobs(const MonitorJobsRequest& request, std::ostream& out) {
+    return with_live_source([&](const nx::monitor::MonitorEngine& engine) {
+        auto jobs = engine.jobs();
+        
+        if (request.flags.json_output) {
+            std::string buffer;
+            JsonWriter json(buffer);
+            json.raw("{\n  \"jobs\": [");
+            for (size_t i = 0; i < jobs.size(); ++i) {
+                json.raw(i == 0 ? "\n" : ",\n");
+                json.raw("    { \"job_id\": ").string(jobs[i].job_id)
+                    .raw(", \"session_id\": ").string(jobs[i].session_id)
+                    .raw(", \"engine\": ").string(jobs[i].engine)
+                    .raw(", \"state\": ").string(jobs[i].state).raw(" }");
+            }
+            json.raw(jobs.empty() ? "]\n}\n" : "\n  ]\n}\n");
+            out << buffer;
+        } else {
+            for (const auto& job : jobs) {
+                out << job.session_id << " " << job.job_id << " " << job.engine << " " << job.state << "\n";
+            }
+        }
+        return CliResult::ok();
+    });
 }
 
-CliResult MonitorCommand::handle_job(const MonitorJobRequest& /* request */) {
-    std::cout << "nx monitor: request accepted\n";
-    
-    return CliResult::error(
-        CliErrorCode::NX_ENGINE_REJECTED,
-        "MonitorEngine job not yet implemented"
-    );
+CliResult MonitorCommand::handle_job(const MonitorJobRequest& request, std::ostream& out) {
+    return with_live_source([&](const nx::monitor::MonitorEngine& engine) {
+        auto job = request.session_id.empty()
+            ? engine.job(request.job_id)
+            : engine.job_in_session(request.job_id, request.session_id);
+        if (!job) {
+            std::string where = request.session_id.empty() ? "" : " in session " + request.session_id;
+            return CliResult::error(CliErrorCode::ERROR_JOB_NOT_FOUND, "Job not found: " + request.job_id + where);
+        }
+        
+        if (request.flags.json_output) {
+            std::string buffer;
+            JsonWriter json(buffer);
+            json.raw("{\n");
+            json.raw("  \"job_id\": ").string(job->job_id).raw(",\n");
+            json.raw("  \"session_id\": ").string(job->session_id).raw(",\n");
+            json.raw("  \"engine\": ").string(job->engine).raw(",\n");
+            json.raw("  \"state\": ").string(job->state).raw(",\n");
+            json.raw("  \"created_at\": ").string(job->created_at).raw(",\n");
+            json.raw("  \"completed_at\": ");
+            if (job->completed_at) {
+                json.string(*job->completed_at);
+            } else {
+                json.null();
+            }
+            json.raw("\n}\n");
+            out << buffer;
+        } else {
+            out << "job_id=" << job->job_id << "\n";
+            out << "session_id=" << job->session_id << "\n";
+            out << "engine=" << job->engine << "\n";
+            out << "state=" << job->state << "\n";
+            out << "created_at=" << job->created_at << "\n";
+            out << "completed_at=" << job->completed_at.value_or("") << "\n";
+        }
+        return CliResult::ok();
+    });
 }
 
-CliResult MonitorCommand::handle_engines(const MonitorEnginesRequest& /* request */) {
-    std::cout << "nx monitor: request accepted\n";
+CliResult MonitorCommand::handle_engines(const MonitorEnginesRequest& /* request */, std::ostream& out) {
+    out << "nx monitor: request accepted\n";
     
     return CliResult::error(
         CliErrorCode::NX_ENGINE_REJECTED,
@@ -105,8 +235,8 @@ CliResult MonitorCommand::handle_engines(const MonitorEnginesRequest& /* request
     );
 }
 
-CliResult MonitorCommand::handle_version(const MonitorVersionRequest& /* request */) {
-    std::cout << "nx monitor: request accepted\n";
+CliResult MonitorCommand::handle_version(const MonitorVersionRequest& /* request */, std::ostream& out) {
+    out << "nx monitor: request accepted\n";
     
     return CliResult::error(
         CliErrorCode::NX_ENGINE_REJECTED,
@@ -114,4 +244,79 @@ CliResult MonitorCommand::handle_version(const MonitorVersionRequest& /* request
     );
 }
 
+CliResult MonitorCommand::handle_stats(const MonitorStatsRequest& request, std::ostream& out) {
+    return with_live_source([&](const nx::monitor::MonitorEngine& engine) {
+        auto stats = engine.stats();
+        
+        if (request.flags.json_output) {
+            std::string buffer;
+            JsonWriter json(buffer);
+            json.raw("{\n");
+            json.raw("  \"window_seconds\": ").raw(format_rate(stats.window_seconds)).raw(",\n");
+            json.raw("  \"jobs_finished\": ").number(stats.jobs_finished).raw(",\n");
+            json.raw("  \"jobs_per_second\": ").raw(format_rate(stats.jobs_per_second)).raw(",\n");
+            json.raw("  \"latency_unit\": \"us\",\n");
+            json.raw("  \"engines\": [");
+            for (size_t i = 0; i < stats.engines.size(); ++i) {
+                const auto& engine_stats = stats.engines[i];
+                json.raw(i == 0 ? "\n" : ",\n");
+                json.raw("    {\n");
+                json.raw("      \"engine\": ").string(engine_stats.engine).raw(",\n");
+                json.raw("      \"completed\": ").number(engine_stats.completed).raw(",\n");
+                json.raw("      \"failed\": ").number(engine_stats.failed).raw(",\n");
+                json.raw("      \"jobs_per_second\": ").raw(format_rate(engine_stats.jobs_per_second)).raw(",\n");
+                json.raw("      \"latency\": ");
+                write_latency_json(json, engine_stats.latency);
+                json.raw("\n");
+                json.raw("    }");
+            }
+            json.raw(stats.engines.empty() ? "]" : "\n  ]");
+            if (!stats.profile_zones.empty()) {
+                json.raw(",\n  \"profile_samples_dropped\": ").number(stats.profile_samples_dropped);
+                json.raw(",\n  \"profile\": [");
+                for (size_t i = 0; i < stats.profile_zones.size(); ++i) {
+                    const auto& zone = stats.profile_zones[i];
+                    json.raw(i == 0 ? "\n" : ",\n");
+                    json.raw("    { \"zone\": ").string(zone.zone)
+                        .raw(", \"count\": ").number(zone.count)
+                        .raw(", \"total_ns\": ").number(zone.total_ns)
+                        .raw(", \"max_ns\": ").number(zone.max_ns).raw(" }");
+                }
+                json.raw("\n  ]");
+            }
+            json.raw("\n}\n");
+            out << buffer;
+        } else {
+            out << "window_seconds=" << format_rate(stats.window_seconds) << "\n";
+            out << "jobs_finished=" << stats.jobs_finished << "\n";
+            out << "jobs_per_second=" << format_rate(stats.jobs_per_second) << "\n";
+            for (const auto& engine_stats : stats.engines) {
+                const auto& latency = engine_stats.latency;
+                out << engine_stats.engine << ": completed=" << engine_stats.completed
+                    << " failed=" << engine_stats.failed
+                    << " jobs_per_second=" << format_rate(engine_stats.jobs_per_second)
+                    << " count=" << latency.count
+                    << " p50_us=" << latency.p50_us
+                    << " p90_us=" << latency.p90_us
+                    << " p99_us=" << latency.p99_us
+                    << " p999_us=" << latency.p999_us
+                    << " max_us=" << latency.max_us << "\n";
+            }
+            for (const auto& zone : stats.profile_zones) {
+                out << "profile " << zone.zone << ": count=" << zone.count
+                    << " total_ns=" << zone.total_ns
+                    << " max_ns=" << zone.max_ns << "\n";
+            }
+        }
+        return CliResult::ok();
+    });
+}
+
+CliResult MonitorCommand::handle_metrics(const MonitorMetricsRequest& /* request */, std::ostream& out) {
+    return with_live_source([&](const nx::monitor::RemoteMonitorEngine& engine) {
+        out << engine.metrics_text();
+        return CliResult::ok();
+    });
+}
+
 } // namespace nx::cli
\ No newline at end of file
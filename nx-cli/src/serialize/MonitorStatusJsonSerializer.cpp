@@ -1,24 +1,25 @@
 #include "MonitorStatusJsonSerializer.h"
 #include "../dto/MonitorStatusDto.h"
-#include <sstream>
+#include "json_writer.h"
 
 namespace nx::cli::serialize {
 
 std::string MonitorStatusJsonSerializer::serialize(const dto::MonitorStatusDto& dto) {
-    std::ostringstream json;
+    std::string buffer;
+    JsonWriter json(buffer);
     
-    json << "{";
-    json << "\"engine_id\":\"" << dto.engine_id << "\",";
-    json << "\"engine_version\":\"" << dto.engine_version << "\",";
-    json << "\"startup_time\":" << dto.startup_time.time_since_epoch().count() << ",";
-    json << "\"is_active\":" << (dto.is_active ? "true" : "false") << ",";
-    json << "\"current_state\":\"" << dto.current_state << "\",";
-    json << "\"active_jobs_count\":" << dto.active_jobs_count << ",";
-    json << "\"completed_jobs_count\":" << dto.completed_jobs_count << ",";
-    json << "\"failed_jobs_count\":" << dto.failed_jobs_count;
-    json << "}";
+    json.raw("{");
+    json.raw("\"engine_id\":").string(dto.engine_id).raw(",");
+    json.raw("\"engine_version\":").string(dto.engine_version).raw(",");
+    json.raw("\"startup_time\":").number(dto.startup_time.time_since_epoch().count()).raw(",");
+    json.raw("\"is_active\":").boolean(dto.is_active).raw(",");
+    json.raw("\"current_state\":").string(dto.current_state).raw(",");
+    json.raw("\"active_jobs_count\":").number(dto.active_jobs_count).raw(",");
+    json.raw("\"completed_jobs_count\":").number(dto.completed_jobs_count).raw(",");
+    json.raw("\"failed_jobs_count\":").number(dto.failed_jobs_count);
+    json.raw("}");
     
-    return json.str();
+    return buffer;
 }
 
-} // namespace nx::cli::serialize
\ No newline at end of file
+} // namespace nx::cli::serialize
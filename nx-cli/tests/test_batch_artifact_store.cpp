@@ -0,0 +1,541 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Test includes
+#include "../include/batch_artifact_store.h"
+#include "../include/batch_introspection_command.h"
+#include "../include/cli_execution.h"
+#include "../include/cli_types.h"
+#include "../include/fd_output_stream.h"
+
+using namespace nx::cli;
+
+namespace {
+
+// Same content as tests/fixtures/artifacts/*/test_batch_001*.json
+BatchArtifactBundle fixture_bundle() {
+    BatchArtifactBundle bundle;
+    bundle.batch_id = "test_batch_001";
+
+    BatchPlanArtifact plan;
+    plan.batch_id = "test_batch_001";
+    plan.plan_hash = "sha256:abc123def456";
+    plan.job_count = 3;
+    plan.job_ids = {"job_001", "job_002", "job_003"};
+    plan.job_types = {{"job_001", "convert"}, {"job_002", "validate"}, {"job_003", "archive"}};
+    plan.dependencies = {{"job_001", {}}, {"job_002", {"job_001"}}, {"job_003", {"job_001", "job_002"}}};
+    plan.execution_order = {{"job_001", 1}, {"job_002", 2}, {"job_003", 3}};
+    bundle.plan = plan;
+
+    BatchExecutionArtifact execution;
+    execution.batch_id = "test_batch_001";
+    execution.execution_complete = true;
+    execution.job_states = {
+        {"job_003", "archive", "failed", 2, "timeout", std::nullopt},
+        {"job_001", "convert", "success", 0, std::nullopt, 1500},
+        {"job_002", "validate", "success", 1, std::nullopt, 800},
+    };
+    bundle.execution = execution;
+
+    BatchPolicyArtifact policies;
+    policies.batch_id = "test_batch_001";
+    policies.policy_resolutions = {
+        {"job_001", "retry", "standard_retry_policy",
+         "{\"max_attempts\": 3, \"backoff_strategy\": \"exponential\"}", "2024-01-15T10:30:00Z"},
+        {"job_002", "execution", "timeout_policy",
+         "{\"timeout_seconds\": 300}", "2024-01-15T10:30:02Z"},
+    };
+    bundle.policies = policies;
+
+    BatchArtifactIndex index;
+    index.batch_id = "test_batch_001";
+    index.artifacts = {
+        {"validation_001", "validation", "job_001", 512, "2024-01-15T10:30:01Z", "sha256:def456"},
+        {"report_001", "report", "job_001", 1024, "2024-01-15T10:30:00Z", "sha256:abc123"},
+        {"log_003", "log", "job_003", 4096, "2024-01-15T10:30:03Z", "sha256:jkl012"},
+    };
+    bundle.artifacts = index;
+    return bundle;
+}
+
+std::filesystem::path make_root() {
+    auto root = std::filesystem::temp_directory_path() /
+                ("nx_batch_store_test_" + std::to_string(::getpid()));
+    std::filesystem::remove_all(root);
+    BatchArtifactLoader::set_storage_root(root);
+    return root;
+}
+
+std::string run(const std::vector<std::string>& args, CliResult& result) {
+    std::ostringstream out;
+    result = BatchIntrospectionCommand::execute(args, out);
+    return out.str();
+}
+
+} // namespace
+
+void test_store_round_trip() {
+    std::cout << "Testing batch store round trip...\n";
+    auto root = make_root();
+    auto bundle = fixture_bundle();
+    auto path = BatchArtifactLoader::get_batch_store_path(bundle.batch_id);
+    assert(path == root / "batches" / "test_batch_001.nxbatch");
+    assert(BatchArtifactStore::write(path, bundle).success);
+
+    BatchArtifactStore store;
+    assert(BatchArtifactStore::open(path, store).success);
+    assert(store.batch_id() == "test_batch_001");
+    assert(store.has_plan() && store.has_execution_state());
+    assert(store.has_policy_resolutions() && store.has_artifact_index());
+    assert(store.execution_complete());
+    assert(store.plan_job_count() == 3 && store.job_state_count() == 3 && store.artifact_count() == 3);
+
+    BatchPlanArtifact plan;
+    store.read_plan(plan);
+    assert(plan.job_ids == bundle.plan->job_ids);   // Plan order preserved
+    assert(plan.dependencies == bundle.plan->dependencies);
+    assert(plan.job_types == bundle.plan->job_types);
+    assert(plan.execution_order == bundle.plan->execution_order);
+    assert(plan.plan_hash == "sha256:abc123def456" && plan.job_count == 3);
+
+    BatchExecutionArtifact execution;
+    store.read_execution_state(execution);
+    assert(execution.job_states.size() == 3);
+    assert(execution.job_states[0].job_id == "job_001");   // job_id order
+    assert(execution.job_states[2].failure_classification == "timeout");
+    assert(!execution.job_states[2].execution_duration_ms.has_value());
+
+    BatchPolicyArtifact policies;
+    store.read_policy_resolutions(policies);
+    assert(policies.policy_resolutions.size() == 2);
+    assert(policies.policy_resolutions[0].resolved_decision == bundle.policies->policy_resolutions[0].resolved_decision);
+
+    // Point lookups
+    auto job = store.find_job_state("job_002");
+    assert(job && job->retry_count == 1 && job->execution_duration_ms == 800u);
+    assert(!store.find_job_state("job_004"));
+    assert(!store.find_job_state(""));
+    auto artifact = store.find_artifact("report_001");
+    assert(artifact && artifact->size_bytes == 1024 && artifact->job_id == "job_001");
+    assert(!store.find_artifact("report_002"));
+
+    // Serialization is deterministic
+    assert(BatchArtifactStore::serialize(bundle) == BatchArtifactStore::serialize(bundle));
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Store round-trips every section\n";
+}
+
+void test_store_write_uses_private_temp_files() {
+    std::cout << "Testing concurrent and failing store writes...\n";
+    auto root = make_root();
+    auto bundle = fixture_bundle();
+    auto path = BatchArtifactLoader::get_batch_store_path(bundle.batch_id);
+
+    // Each writer renames only its own complete image into place
+    std::vector<std::thread> writers;
+    std::atomic<size_t> failures{0};
+    for (int i = 0; i < 4; ++i) {
+        writers.emplace_back([&] {
+            for (int round = 0; round < 20; ++round) {
+                if (!BatchArtifactStore::write(path, bundle).success) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    assert(failures == 0);
+    BatchArtifactStore store;
+    assert(BatchArtifactStore::open(path, store).success);
+    assert(store.plan_job_count() == 3);
+
+    // Rename onto a directory fails and removes the temp image
+    auto blocked = root / "batches" / "blocked.nxbatch";
+    std::filesystem::create_directories(blocked / "child");
+    auto result = BatchArtifactStore::write(blocked, bundle);
+    assert(result.error_code == CliErrorCode::NX_EXEC_FAILED);
+
+    for (const auto& entry : std::filesystem::directory_iterator(root / "batches")) {
+        assert(entry.path().filename().string().find(".tmp") == std::string::npos);
+    }
+
+    // Parent directory that cannot be created is reported by name
+    std::ofstream(root / "not_a_dir") << "x";
+    result = BatchArtifactStore::write(root / "not_a_dir" / "batch.nxbatch", bundle);
+    assert(result.error_code == CliErrorCode::NX_EXEC_FAILED);
+    assert(result.message.find("not_a_dir") != std::string::npos);
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Store writes never share or leak temp files\n";
+}
+
+void test_introspection_reads_store() {
+    std::cout << "Testing batch inspect over the store...\n";
+    auto root = make_root();
+    assert(BatchArtifactStore::write(BatchArtifactLoader::get_batch_store_path("test_batch_001"),
+                                     fixture_bundle()).success);
+    CliResult result;
+
+    std::string jobs = run({"jobs", "test_batch_001"}, result);
+    assert(result.success);
+    assert(jobs ==
+           "{\n"
+           "  \"batch_id\": \"test_batch_001\",\n"
+           "  \"jobs\": [\n"
+           "    {\n"
+           "      \"job_id\": \"job_001\",\n"
+           "      \"job_type\": \"convert\",\n"
+           "      \"execution_order\": 1,\n"
+           "      \"dependency_count\": 0,\n"
+           "      \"dependent_count\": 2\n"
+           "    },\n"
+           "    {\n"
+           "      \"job_id\": \"job_002\",\n"
+           "      \"job_type\": \"validate\",\n"
+           "      \"execution_order\": 2,\n"
+           "      \"dependency_count\": 1,\n"
+           "      \"dependent_count\": 1\n"
+           "    },\n"
+           "    {\n"
+           "      \"job_id\": \"job_003\",\n"
+           "      \"job_type\": \"archive\",\n"
+           "      \"execution_order\": 3,\n"
+           "      \"dependency_count\": 2,\n"
+           "      \"dependent_count\": 0\n"
+           "    }\n"
+           "  ]\n"
+           "}\n");   // golden/inspect_jobs_basic.json
+
+    std::string plan = run({"plan", "test_batch_001"}, result);
+    assert(result.success);
+    assert(plan.find("\"edges\": [[\"job_001\", \"job_002\"], [\"job_001\", \"job_003\"], [\"job_002\", \"job_003\"]]") !=
+           std::string::npos);
+
+    std::string job = run({"job", "test_batch_001", "job_003"}, result);
+    assert(result.success);
+    assert(job.find("\"failure_classification\": \"timeout\"") != std::string::npos);
+    run({"job", "test_batch_001", "job_999"}, result);
+    assert(result.error_code == CliErrorCode::ERROR_JOB_NOT_FOUND);
+
+    std::string status = run({"status", "test_batch_001", "--filter-state", "failed"}, result);
+    assert(result.success);
+    assert(status.find("job_003") != std::string::npos && status.find("job_001") == std::string::npos);
+
+    std::string artifacts = run({"artifacts", "test_batch_001", "--job-id", "job_001"}, result);
+    assert(result.success);
+    assert(artifacts.find("report_001") < artifacts.find("validation_001"));
+    assert(artifacts.find("log_003") == std::string::npos);
+
+    run({"artifact", "test_batch_001", "missing"}, result);
+    assert(result.error_code == CliErrorCode::ERROR_ARTIFACT_NOT_FOUND);
+
+    run({"jobs", "unknown_batch"}, result);
+    assert(result.error_code == CliErrorCode::ERROR_BATCH_NOT_FOUND);
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Introspection commands answer from the store\n";
+}
+
+void test_partial_and_corrupt_stores() {
+    std::cout << "Testing partial and corrupt stores...\n";
+    auto root = make_root();
+    CliResult result;
+
+    // Plan only: execution queries report the missing artifact
+    BatchArtifactBundle plan_only = fixture_bundle();
+    plan_only.execution.reset();
+    assert(BatchArtifactStore::write(BatchArtifactLoader::get_batch_store_path("plan_only"), plan_only).success);
+    run({"status", "plan_only"}, result);
+    assert(result.error_code == CliErrorCode::ERROR_BATCH_NOT_FOUND);
+
+    // Incomplete execution
+    BatchArtifactBundle running = fixture_bundle();
+    running.execution->execution_complete = false;
+    assert(BatchArtifactStore::write(BatchArtifactLoader::get_batch_store_path("running"), running).success);
+    run({"job", "running", "job_001"}, result);
+    assert(result.error_code == CliErrorCode::ERROR_EXECUTION_INCOMPLETE);
+
+    // Truncated and foreign files are rejected at open
+    std::string image = BatchArtifactStore::serialize(fixture_bundle());
+    {
+        std::ofstream file(BatchArtifactLoader::get_batch_store_path("truncated"), std::ios::binary);
+        file.write(image.data(), 40);
+    }
+    run({"jobs", "truncated"}, result);
+    assert(result.error_code == CliErrorCode::NX_EXEC_FAILED);
+    {
+        std::ofstream file(BatchArtifactLoader::get_batch_store_path("foreign"), std::ios::binary);
+        file << std::string(image.size(), 'x');
+    }
+    run({"jobs", "foreign"}, result);
+    assert(result.error_code == CliErrorCode::NX_EXEC_FAILED);
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Missing sections and corrupt images are reported\n";
+}
+
+void test_large_batch_point_lookup() {
+    std::cout << "Testing point lookup in a large batch...\n";
+    auto root = make_root();
+
+    constexpr size_t kJobs = 200000;
+    BatchArtifactBundle bundle;
+    bundle.batch_id = "large";
+    BatchExecutionArtifact execution;
+    execution.batch_id = "large";
+    execution.execution_complete = true;
+    execution.job_states.reserve(kJobs);
+    for (size_t i = 0; i < kJobs; ++i) {
+        execution.job_states.push_back({"job_" + std::to_string(i), "convert", "success", 0, std::nullopt, i});
+    }
+    bundle.execution = std::move(execution);
+    assert(BatchArtifactStore::write(BatchArtifactLoader::get_batch_store_path("large"), bundle).success);
+
+    auto start = std::chrono::steady_clock::now();
+    CliResult result;
+    std::string job = run({"job", "large", "job_123456"}, result);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(result.success);
+    assert(job.find("\"job_id\": \"job_123456\"") != std::string::npos);
+    // Opening and searching touch O(log n) records, never the whole section
+    assert(elapsed < std::chrono::milliseconds(100));
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Single-job lookup is independent of batch size\n";
+}
+
+void test_secondary_indexes() {
+    std::cout << "Testing secondary index queries...\n";
+    auto root = make_root();
+    auto bundle = fixture_bundle();
+    bundle.artifacts->artifacts.push_back({"log_001", "log", "job_001", 64, "2024-01-15T10:30:04Z", "sha256:mno345"});
+    auto path = BatchArtifactLoader::get_batch_store_path(bundle.batch_id);
+    assert(BatchArtifactStore::write(path, bundle).success);
+    BatchArtifactStore store;
+    assert(BatchArtifactStore::open(path, store).success);
+
+    std::vector<BatchJobSummary> jobs;
+    store.find_plan_jobs("", jobs);
+    assert(jobs.size() == 3 && jobs[0].job_id == "job_001" && jobs[2].job_id == "job_003");   // Plan order
+    assert(jobs[0].dependent_count == 2 && jobs[1].dependent_count == 1 && jobs[2].dependent_count == 0);
+    assert(jobs[2].dependency_count == 2 && jobs[2].execution_order == 3);
+    store.find_plan_jobs("validate", jobs);
+    assert(jobs.size() == 1 && jobs[0].job_id == "job_002" && jobs[0].job_type == "validate");
+    store.find_plan_jobs("transcode", jobs);
+    assert(jobs.empty());
+
+    std::vector<JobExecutionState> states;
+    store.find_job_states("success", states);
+    assert(states.size() == 2 && states[0].job_id == "job_001" && states[1].job_id == "job_002");
+    store.find_job_states("skipped", states);
+    assert(states.empty());
+
+    std::vector<ArtifactMetadata> artifacts;
+    store.find_artifacts("", "", artifacts);   // (job_id, artifact_type, artifact_id) order
+    assert(artifacts.size() == 4);
+    assert(artifacts[0].artifact_id == "log_001" && artifacts[1].artifact_id == "report_001");
+    assert(artifacts[2].artifact_id == "validation_001" && artifacts[3].artifact_id == "log_003");
+    store.find_artifacts("log", "", artifacts);
+    assert(artifacts.size() == 2 && artifacts[0].job_id == "job_001" && artifacts[1].job_id == "job_003");
+    store.find_artifacts("", "job_001", artifacts);
+    assert(artifacts.size() == 3 && artifacts[0].artifact_type == "log" && artifacts[2].artifact_type == "validation");
+    store.find_artifacts("report", "job_001", artifacts);
+    assert(artifacts.size() == 1 && artifacts[0].artifact_id == "report_001");
+    store.find_artifacts("report", "job_003", artifacts);
+    assert(artifacts.empty());
+
+    // CLI output over the indexes
+    CliResult result;
+    std::string listed = run({"jobs", "test_batch_001", "--filter-type", "archive"}, result);
+    assert(result.success);
+    assert(listed.find("\"job_id\": \"job_003\"") != std::string::npos && listed.find("job_001") == std::string::npos);
+    std::string both = run({"artifacts", "test_batch_001", "--job-id", "job_001", "--artifact-type", "log"}, result);
+    assert(result.success);
+    assert(both.find("log_001") != std::string::npos && both.find("report_001") == std::string::npos);
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Filters are answered from the secondary indexes\n";
+}
+
+void test_large_batch_filtered_query() {
+    std::cout << "Testing filtered queries in a large batch...\n";
+    auto root = make_root();
+
+    constexpr size_t kJobs = 200000;
+    BatchArtifactBundle bundle;
+    bundle.batch_id = "large";
+    BatchExecutionArtifact execution;
+    execution.batch_id = "large";
+    execution.execution_complete = true;
+    execution.job_states.reserve(kJobs);
+    for (size_t i = 0; i < kJobs; ++i) {
+        bool failed = i % 50000 == 7;
+        execution.job_states.push_back({"job_" + std::to_string(i), "convert", failed ? "failed" : "success",
+                                        0, std::nullopt, i});
+    }
+    bundle.execution = std::move(execution);
+    assert(BatchArtifactStore::write(BatchArtifactLoader::get_batch_store_path("large"), bundle).success);
+
+    auto start = std::chrono::steady_clock::now();
+    CliResult result;
+    std::string status = run({"status", "large", "--filter-state", "failed"}, result);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(result.success);
+    assert(status.find("\"job_id\": \"job_100007\"") < status.find("\"job_id\": \"job_150007\""));
+    assert(status.find("\"job_id\": \"job_0\"") == std::string::npos);
+    // Only the four matching records are read, not 200k states
+    assert(elapsed < std::chrono::milliseconds(100));
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Filtered status is proportional to the result\n";
+}
+
+void test_ranged_artifact_content() {
+    std::cout << "Testing ranged artifact content reads...\n";
+    auto root = make_root();
+    assert(BatchArtifactStore::write(BatchArtifactLoader::get_batch_store_path("test_batch_001"),
+                                     fixture_bundle()).success);
+    CliResult result;
+
+    // Indexed but not materialized
+    run({"artifact", "test_batch_001", "report_001"}, result);
+    assert(result.error_code == CliErrorCode::NX_EXEC_FAILED);
+
+    // Larger than one window so ranges cross mapping boundaries
+    std::string content(ArtifactContentReader::kWindowSize + 4096 + 17, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>('a' + i % 26);
+    }
+    content[5] = '"';
+    content[6] = '\n';
+    content[8] = '\x01';   // Control bytes, e.g. ANSI colour codes in timeline logs
+    content[9] = '\x1b';
+    auto content_path = std::filesystem::path(BatchArtifactLoader::get_artifact_content_path("test_batch_001", "report_001"));
+    std::filesystem::create_directories(content_path.parent_path());
+    {
+        std::ofstream file(content_path, std::ios::binary);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    std::string whole = run({"artifact", "test_batch_001", "report_001"}, result);
+    assert(result.success && whole == content);   // Raw output has no trailing newline
+
+    uint64_t offset = ArtifactContentReader::kWindowSize - 10;
+    std::string range = run({"artifact", "test_batch_001", "report_001",
+                             "--offset", std::to_string(offset), "--length", "100"}, result);
+    assert(result.success && range == content.substr(offset, 100));
+
+    std::string tail = run({"artifact", "test_batch_001", "report_001",
+                            "--offset", std::to_string(content.size() - 3), "--length", "100"}, result);
+    assert(result.success && tail == content.substr(content.size() - 3));
+
+    std::string capped = run({"artifact", "test_batch_001", "report_001", "--offset", "1", "--max-size", "4"}, result);
+    assert(result.success && capped == content.substr(1, 4));
+
+    std::string json = run({"artifact", "test_batch_001", "report_001",
+                            "--format", "json", "--offset", "3", "--length", "7"}, result);
+    assert(result.success);
+    assert(json ==
+           "{\n"
+           "  \"batch_id\": \"test_batch_001\",\n"
+           "  \"artifact_id\": \"report_001\",\n"
+           "  \"size_bytes\": " + std::to_string(content.size()) + ",\n"
+           "  \"offset\": 3,\n"
+           "  \"length\": 7,\n"
+           "  \"content\": \"de\\\"\\nh\\u0001\\u001b\"\n"
+           "}\n");
+
+    // Direct reader access: pread/sendfile path into a descriptor
+    ArtifactContentReader reader;
+    assert(BatchArtifactLoader::open_artifact_content("test_batch_001", "report_001", reader).success);
+    assert(reader.size() == content.size());
+    auto sink_path = root / "sink.bin";
+    int sink = ::open(sink_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert(sink >= 0);
+    assert(reader.send_to(sink, 7, content.size()).success);
+    ::close(sink);
+    std::ifstream sunk(sink_path, std::ios::binary);
+    std::string sunk_content((std::istreambuf_iterator<char>(sunk)), std::istreambuf_iterator<char>());
+    assert(sunk_content == content.substr(7));
+
+    // std::cout with a replaced rdbuf is an ordinary stream: nothing bypasses the capture
+    {
+        std::ostringstream captured;
+        std::streambuf* original = std::cout.rdbuf(captured.rdbuf());
+        result = BatchIntrospectionCommand::execute({"artifact", "test_batch_001", "report_001", "--offset", "2",
+                                                     "--length", "40"});
+        std::cout.rdbuf(original);
+        assert(result.success && captured.str() == content.substr(2, 40));
+    }
+
+    // A descriptor-backed sink gets buffered text and kernel-copied content in order,
+    // through the same execute_command() path main() uses
+    int fd_sink_file = ::open(sink_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert(fd_sink_file >= 0);
+    {
+        FdOutputStream fd_sink(fd_sink_file);
+        std::ostringstream err;
+        fd_sink << "header:";
+        int exit_code = execute_command({"batch", "inspect", "artifact", "test_batch_001", "report_001"},
+                                        fd_sink, err);
+        assert(exit_code == 0 && err.str().empty());
+    }
+    ::close(fd_sink_file);
+    std::ifstream fd_sunk(sink_path, std::ios::binary);
+    std::string fd_sunk_content((std::istreambuf_iterator<char>(fd_sunk)), std::istreambuf_iterator<char>());
+    assert(fd_sunk_content == "header:" + content);
+
+    std::string loaded;
+    assert(BatchArtifactLoader::load_artifact_content("test_batch_001", "report_001", loaded).success);
+    assert(loaded == content);
+
+    // Bad ranges and flags
+    run({"artifact", "test_batch_001", "report_001", "--offset", std::to_string(content.size() + 1)}, result);
+    assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    run({"artifact", "test_batch_001", "report_001", "--length", "-1"}, result);
+    assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    run({"artifact", "test_batch_001", "report_001", "--offset"}, result);
+    assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    assert(BatchArtifactLoader::open_artifact_content("test_batch_001", "../batches", reader).error_code ==
+           CliErrorCode::NX_CLI_USAGE_ERROR);
+
+    // Batch ids are path components too: a store or content outside the root is never reached
+    assert(BatchArtifactStore::write(root / "outside.nxbatch", fixture_bundle()).success);
+    run({"jobs", "../outside"}, result);
+    assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    assert(BatchArtifactLoader::open_artifact_content("../content/test_batch_001", "report_001", reader).error_code ==
+           CliErrorCode::NX_CLI_USAGE_ERROR);
+    run({"artifact", "..", "report_001"}, result);
+    assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+
+    std::filesystem::remove_all(root);
+    std::cout << "✓ Artifact content streams by byte range\n";
+}
+
+int main() {
+    std::cout << "=== Batch Artifact Store Tests ===\n\n";
+
+    test_store_round_trip();
+    test_store_write_uses_private_temp_files();
+    test_introspection_reads_store();
+    test_partial_and_corrupt_stores();
+    test_large_batch_point_lookup();
+    test_secondary_indexes();
+    test_large_batch_filtered_query();
+    test_ranged_artifact_content();
+
+    std::cout << "\n✅ All batch artifact store tests passed\n";
+    return 0;
+}
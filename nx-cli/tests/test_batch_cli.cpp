@@ -1,9 +1,12 @@
 #include "batch_argument_parser.h"
 #include "batch_command.h"
+#include "batch_file_reader.h"
 #include <iostream>
 #include <cassert>
 #include <fstream>
 #include <filesystem>
+#include <sstream>
+#include <thread>
 
 namespace nx::cli {
 
@@ -82,6 +85,24 @@ void test_batch_validate_parsing() {
         assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
     }
     
+    // Error cap
+    {
+        std::vector<std::string> args = {"--file", "test.batch", "--max-errors", "5"};
+        BatchValidateRequest request;
+        auto result = BatchArgumentParser::parse_validate_args(args, request);
+        assert(result.success);
+        assert(request.flags.max_errors == 5);
+    }
+    
+    // Reject zero, negative and non-numeric caps
+    for (const std::string value : {"0", "-1", "abc", "99999999999999999999999"}) {
+        std::vector<std::string> args = {"--file", "test.batch", "--max-errors", value};
+        BatchValidateRequest request;
+        auto result = BatchArgumentParser::parse_validate_args(args, request);
+        assert(!result.success);
+        assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    }
+    
     std::cout << "✓ Batch validate parsing tests passed\n";
 }
 
@@ -355,6 +376,243 @@ void test_strict_rejection() {
     std::cout << "✓ Strict rejection tests passed\n";
 }
 
+void test_batch_file_reader_line_splitting() {
+    std::cout << "Testing streaming batch file reader...\n";
+    
+    std::string test_file = "test_reader.batch";
+    {
+        std::ofstream file(test_file, std::ios::binary);
+        file << "nx convert a\r\n\nnx audio b\nnx video c";  // CRLF kept, no final newline
+    }
+    
+    BatchFileReader reader;
+    assert(reader.open(test_file).success);
+    std::vector<BatchLine> chunk;
+    assert(reader.next_chunk(chunk, 2));
+    assert(chunk.size() == 2);
+    assert(chunk[0].text == "nx convert a\r" && chunk[0].line_number == 1);
+    assert(chunk[1].text.empty() && chunk[1].line_number == 2);
+    assert(reader.next_chunk(chunk, 2));
+    assert(chunk.size() == 2);
+    assert(chunk[1].text == "nx video c" && chunk[1].line_number == 4);
+    assert(!reader.next_chunk(chunk, 2));
+    assert(chunk.empty());
+    
+    {
+        std::ofstream file(test_file, std::ios::trunc);
+        file << "nx convert a\n";  // Trailing newline adds no line
+    }
+    assert(reader.open(test_file).success);
+    assert(reader.next_chunk(chunk));
+    assert(chunk.size() == 1);
+    assert(!reader.next_chunk(chunk));
+    
+    std::filesystem::remove(test_file);
+    assert(!reader.open(test_file).success);
+    std::cout << "✓ Reader splits lines like std::getline\n";
+}
+
+// Run batch operation with stdout captured
+static CliResult run_captured(const std::vector<std::string>& args, std::string& output) {
+    std::ostringstream captured;
+    auto result = BatchCommand::execute(args, captured);
+    output = captured.str();
+    return result;
+}
+
+void test_multi_chunk_run_streams_plan() {
+    std::cout << "Testing multi-chunk batch run...\n";
+    
+    const size_t command_count = BatchFileReader::kDefaultChunkLines * 2 + 7;
+    std::string test_file = "test_large.batch";
+    {
+        std::ofstream file(test_file);
+        for (size_t i = 0; i < command_count; ++i) {
+            file << "nx convert transcode --input " << i << ".mov\n";
+        }
+    }
+    
+    std::string output;
+    auto result = run_captured({"run", "--file", test_file, "--json"}, output);
+    assert(result.success);
+    assert(output.find("{ \"index\": " + std::to_string(command_count) + ",") != std::string::npos);
+    assert(output.ends_with("\" }\n  ]\n}\n"));
+    
+    result = run_captured({"summarize", "--file", test_file}, output);
+    assert(result.success);
+    assert(output.find("Total commands: " + std::to_string(command_count)) != std::string::npos);
+    
+    // Invalid line in the last chunk: nothing from earlier chunks is dispatched
+    {
+        std::ofstream file(test_file, std::ios::app);
+        file << "nx unknown op\n";
+    }
+    result = run_captured({"run", "--file", test_file, "--json"}, output);
+    assert(!result.success);
+    assert(result.message.ends_with("line " + std::to_string(command_count + 1)));
+    assert(output.empty());
+    result = run_captured({"summarize", "--file", test_file, "--json"}, output);
+    assert(!result.success);
+    assert(output.empty());
+    
+    // Within a single chunk nothing is dispatched before validation fails
+    {
+        std::ofstream file(test_file, std::ios::trunc);
+        file << "nx convert transcode --input a.mov\n";
+        file << "nx unknown op\n";
+    }
+    result = run_captured({"run", "--file", test_file}, output);
+    assert(!result.success);
+    assert(output.empty());
+    
+    // Path and command text are escaped like validate's output
+    std::string quoted_file = "test_run_\"quoted\"\\name.batch";
+    {
+        std::ofstream file(quoted_file, std::ios::trunc);
+        file << "nx convert --title \"a\\b\"\n";
+    }
+    result = run_captured({"run", "--file", quoted_file, "--json"}, output);
+    assert(result.success);
+    assert(output.find("\"file\": \"test_run_\\\"quoted\\\"\\\\name.batch\",") != std::string::npos);
+    assert(output.find("\"command\": \"nx convert --title \\\"a\\\\b\\\"\" }") != std::string::npos);
+    result = run_captured({"summarize", "--file", quoted_file, "--json"}, output);
+    assert(result.success);
+    assert(output.find("\"file\": \"test_run_\\\"quoted\\\"\\\\name.batch\",") != std::string::npos);
+    std::filesystem::remove(quoted_file);
+    
+    std::filesystem::remove(test_file);
+    std::cout << "✓ Large batch files are validated in full before planning\n";
+}
+
+void test_validate_reports_all_errors_in_line_order() {
+    std::cout << "Testing parallel validation error collection...\n";
+    
+    // Enough lines for several chunks, each split across workers
+    std::string test_file = "test_validate_errors.batch";
+    const int line_count = 150000;
+    std::vector<int> bad_lines;
+    {
+        std::ofstream file(test_file);
+        for (int line = 1; line <= line_count; ++line) {
+            if (line % 9973 == 0) {
+                file << "nx unknown op \"" << line << "\"\n";
+                bad_lines.push_back(line);
+            } else if (line % 30011 == 0) {
+                file << "\n";
+                bad_lines.push_back(line);
+            } else {
+                file << "nx convert transcode --input " << line << ".mov\n";
+            }
+        }
+    }
+    
+    BatchValidateRequest request;
+    request.batch_file = test_file;
+    request.flags.json_output = false;
+    
+    auto result = BatchCommand::handle_validate(request);
+    assert(!result.success);
+    assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    
+    // One message line per error, sorted by line number
+    std::istringstream messages(result.message);
+    std::string message;
+    size_t index = 0;
+    while (std::getline(messages, message)) {
+        assert(index < bad_lines.size());
+        assert(message.ends_with("line " + std::to_string(bad_lines[index])));
+        ++index;
+    }
+    assert(index == bad_lines.size());
+    
+    // JSON report carries the same errors, escaped
+    std::string output;
+    request.flags.json_output = true;
+    result = run_captured({"validate", "--file", test_file, "--json"}, output);
+    assert(!result.success);
+    assert(output.find("\"error_count\": " + std::to_string(bad_lines.size())) != std::string::npos);
+    assert(output.find("\"max_errors_reached\": false") != std::string::npos);
+    assert(output.find("{ \"line\": 9973, \"message\": \"Unknown component 'unknown' at line 9973\" }") != std::string::npos);
+    
+    // Cap keeps only the first errors by line number
+    result = run_captured({"validate", "--file", test_file, "--json", "--max-errors", "3"}, output);
+    assert(!result.success);
+    assert(output.find("\"error_count\": 3") != std::string::npos);
+    assert(output.find("\"max_errors_reached\": true") != std::string::npos);
+    assert(output.find("\"line\": " + std::to_string(bad_lines[2])) != std::string::npos);
+    assert(output.find("\"line\": " + std::to_string(bad_lines[3])) == std::string::npos);
+    
+    // File path is escaped like every other string in the report
+    std::string quoted_file = "test_validate_\"quoted\"\\name.batch";
+    std::filesystem::copy_file(test_file, quoted_file, std::filesystem::copy_options::overwrite_existing);
+    result = run_captured({"validate", "--file", quoted_file, "--json"}, output);
+    assert(!result.success);
+    assert(output.find("\"file\": \"test_validate_\\\"quoted\\\"\\\\name.batch\",") != std::string::npos);
+    
+    // ...and on success too
+    {
+        std::ofstream file(quoted_file, std::ios::trunc);
+        file << "nx convert transcode --input a.mov\n";
+    }
+    result = run_captured({"validate", "--file", quoted_file, "--json"}, output);
+    assert(result.success);
+    assert(output.find("\"file\": \"test_validate_\\\"quoted\\\"\\\\name.batch\",") != std::string::npos);
+    assert(output.find("\"valid\": true,\n  \"command_count\": 1\n") != std::string::npos);
+    std::filesystem::remove(quoted_file);
+    
+    std::filesystem::remove(test_file);
+    std::cout << "✓ All validation errors are reported in line order\n";
+}
+
+void test_concurrent_commands_use_own_sinks() {
+    std::cout << "Testing concurrent batch commands...\n";
+    
+    const int thread_count = 4;
+    std::vector<std::string> files;
+    std::vector<std::string> expected(thread_count);
+    for (int t = 0; t < thread_count; ++t) {
+        files.push_back("test_concurrent_" + std::to_string(t) + ".batch");
+        std::ofstream file(files.back());
+        for (int line = 0; line < 500 + t * 100; ++line) {
+            file << "nx audio measure --input " << t << "_" << line << ".wav\n";
+        }
+    }
+    for (int t = 0; t < thread_count; ++t) {
+        assert(run_captured({"run", "--file", files[t], "--json"}, expected[t]).success);
+    }
+    
+    // Global stdout must stay untouched while commands write to their sinks
+    std::ostringstream global_stdout;
+    std::streambuf* original = std::cout.rdbuf(global_stdout.rdbuf());
+    
+    std::vector<std::string> outputs(thread_count);
+    std::vector<int> succeeded(thread_count, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (int repeat = 0; repeat < 20; ++repeat) {
+                std::string output;
+                succeeded[t] += run_captured({"run", "--file", files[t], "--json"}, output).success;
+                if (repeat == 0) outputs[t] = output;
+                else if (output != outputs[t]) succeeded[t] = -1000;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    std::cout.rdbuf(original);
+    assert(global_stdout.str().empty());
+    for (int t = 0; t < thread_count; ++t) {
+        assert(succeeded[t] == 20);
+        assert(outputs[t] == expected[t]);
+        std::filesystem::remove(files[t]);
+    }
+    
+    std::cout << "✓ Concurrent commands write only to their own sinks\n";
+}
+
 } // namespace nx::cli
 
 int main() {
@@ -374,6 +632,10 @@ int main() {
     nx::cli::test_empty_batch_file();
     nx::cli::test_order_preservation();
     nx::cli::test_strict_rejection();
+    nx::cli::test_batch_file_reader_line_splitting();
+    nx::cli::test_multi_chunk_run_streams_plan();
+    nx::cli::test_validate_reports_all_errors_in_line_order();
+    nx::cli::test_concurrent_commands_use_own_sinks();
     
     std::cout << "\n✅ All nx batch CLI tests passed!\n";
     return 0;
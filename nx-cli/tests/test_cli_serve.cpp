@@ -0,0 +1,220 @@
+#include "cli_serve.h"
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace nx::cli {
+
+void test_serve_request_parsing() {
+    std::cout << "Testing serve request parsing...\n";
+    
+    // Full request
+    {
+        ServeRequest request;
+        auto error = parse_serve_request(R"({"id": 42, "args": ["monitor", "status", "--json"]})", request);
+        assert(!error);
+        assert(request.id_json == "42");
+        assert((request.args == std::vector<std::string>{"monitor", "status", "--json"}));
+    }
+    
+    // String id echoed verbatim, escapes decoded
+    {
+        ServeRequest request;
+        auto error = parse_serve_request(R"({"args":["a\"b","c\\d","é😀"],"id":"q-1"})", request);
+        assert(!error);
+        assert(request.id_json == "\"q-1\"");
+        assert(request.args[0] == "a\"b");
+        assert(request.args[1] == "c\\d");
+        assert(request.args[2] == "\xC3\xA9\xF0\x9F\x98\x80");
+    }
+    
+    // Whitespace around the id is not part of the echoed token
+    {
+        ServeRequest request;
+        assert(!parse_serve_request("{\"id\":\t -7 ,\"args\":[]}", request));
+        assert(request.id_json == "-7");
+    }
+    
+    // id is optional
+    {
+        ServeRequest request;
+        assert(!parse_serve_request(R"({"args": []})", request));
+        assert(request.id_json == "null");
+        assert(request.args.empty());
+    }
+    
+    // Malformed requests
+    for (const char* line : {"", "[]", R"({"id": 1})", R"({"args": ["a", 1]})", R"({"args": [], "cwd": "/"})",
+                             R"({"args": []} x)", R"({"args": ["unterminated]})", R"({"id": 1.5, "args": []})",
+                             R"({"args": ["\ud83d"]})", R"({"id": true, "args": []})", R"({"id": [1], "args": []})",
+                             R"({"id": -, "args": []})"}) {
+        ServeRequest request;
+        assert(parse_serve_request(line, request));
+    }
+    
+    std::cout << "✓ Serve request parsing tests passed\n";
+}
+
+void test_serve_responses_match_one_shot_execution() {
+    std::cout << "Testing serve session responses...\n";
+    
+    std::vector<std::vector<std::string>> commands = {
+        {"monitor", "status", "--json"},
+        {"monitor", "status"},
+        {"unknown", "command"},
+    };
+    
+    std::ostringstream requests;
+    for (size_t i = 0; i < commands.size(); ++i) {
+        requests << "{\"id\": " << i << ", \"args\": [";
+        for (size_t j = 0; j < commands[i].size(); ++j) {
+            if (j > 0) requests << ", ";
+            requests << "\"" << commands[i][j] << "\"";
+        }
+        requests << "]}\n";
+        requests << "\n";  // Blank lines are ignored
+    }
+    requests << "not json\n";
+    
+    std::istringstream in(requests.str());
+    std::ostringstream out;
+    assert(serve(in, out) == 0);
+    
+    // One response line per request, in request order, equal to one-shot runs
+    std::istringstream responses(out.str());
+    std::string line;
+    for (size_t i = 0; i < commands.size(); ++i) {
+        assert(std::getline(responses, line));
+        assert(line == format_serve_response(std::to_string(i), execute_command(commands[i])));
+    }
+    
+    assert(std::getline(responses, line));
+    assert(line.starts_with("{\"id\":null,\"exit_code\":64,\"stdout\":\"\",\"stderr\":\"Invalid serve request: "));
+    assert(!std::getline(responses, line));
+    
+    std::cout << "✓ Serve responses match one-shot execution\n";
+}
+
+void test_serve_response_encoding() {
+    std::cout << "Testing serve response encoding...\n";
+    
+    CliExecutionResult result{3, "{\"a\": 1}\n\ttab", std::string("err\r\x01", 5)};
+    auto response = format_serve_response("\"x\"", result);
+    assert(response == R"({"id":"x","exit_code":3,"stdout":"{\"a\": 1}\n\ttab","stderr":"err\r\u0001"})");
+    assert(response.find('\n') == std::string::npos);
+    
+    std::cout << "✓ Serve response encoding tests passed\n";
+}
+
+void test_execute_command_is_reentrant() {
+    std::cout << "Testing concurrent execute_command...\n";
+    
+    std::vector<std::vector<std::string>> commands = {
+        {"monitor", "status", "--json"},
+        {"monitor", "status", "--text"},
+        {"batch", "jobs", "b1"},
+        {},
+    };
+    std::vector<CliExecutionResult> expected;
+    for (const auto& args : commands) {
+        expected.push_back(execute_command(args));
+    }
+    
+    // Global streams are never redirected, so a caller's own capture stays intact
+    std::ostringstream global_stdout;
+    std::streambuf* original = std::cout.rdbuf(global_stdout.rdbuf());
+    
+    std::vector<int> mismatches(commands.size(), 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < commands.size(); ++i) {
+        threads.emplace_back([&, i] {
+            for (int repeat = 0; repeat < 50; ++repeat) {
+                auto result = execute_command(commands[i]);
+                mismatches[i] += result.exit_code != expected[i].exit_code ||
+                                 result.stdout_text != expected[i].stdout_text ||
+                                 result.stderr_text != expected[i].stderr_text;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    std::cout.rdbuf(original);
+    assert(global_stdout.str().empty());
+    for (int count : mismatches) {
+        assert(count == 0);
+    }
+    
+    // Streaming overload writes to the caller's sinks
+    std::ostringstream out;
+    std::ostringstream err;
+    int exit_code = execute_command(commands[0], out, err);
+    assert(exit_code == expected[0].exit_code);
+    assert(out.str() == expected[0].stdout_text);
+    assert(err.str() == expected[0].stderr_text);
+    
+    std::cout << "✓ execute_command is reentrant and leaves global streams alone\n";
+}
+
+void test_execute_command_routes_component_handlers() {
+    std::cout << "Testing execute_command component routing...\n";
+    
+    // Handler output goes to out only
+    {
+        std::ostringstream out;
+        std::ostringstream err;
+        assert(execute_command({"batch", "--help"}, out, err) == 0);
+        assert(out.str().starts_with("nx batch"));
+        assert(err.str().empty());
+    }
+    {
+        std::ostringstream out;
+        std::ostringstream err;
+        assert(execute_command({"monitor", "--help"}, out, err) == 0);
+        assert(out.str().starts_with("nx monitor"));
+        assert(err.str().empty());
+    }
+    
+    // Handler failures are reported on err only, with a mapped exit code
+    {
+        std::ostringstream out;
+        std::ostringstream err;
+        assert(execute_command({"batch", "bogus"}, out, err) == 64);
+        assert(out.str().empty());
+        assert(err.str().starts_with("Error: Unknown batch operation: bogus"));
+    }
+    {
+        std::ostringstream out;
+        std::ostringstream err;
+        assert(execute_command({"monitor", "job", "--json"}, out, err) == 64);
+        assert(out.str().empty());
+        assert(err.str().starts_with("Error: "));
+    }
+    {
+        std::ostringstream out;
+        std::ostringstream err;
+        assert(execute_command({"convert"}, out, err) == 64);
+        assert(out.str().empty());
+        assert(err.str().starts_with("Error: Unknown command group: convert"));
+        assert(err.str().find("Available: batch, monitor") != std::string::npos);  // From CommandRegistry
+    }
+    
+    std::cout << "✓ execute_command routes batch and monitor with both sinks\n";
+}
+
+} // namespace nx::cli
+
+int main() {
+    std::cout << "=== nx-cli serve Tests ===\n\n";
+    
+    nx::cli::test_serve_request_parsing();
+    nx::cli::test_serve_responses_match_one_shot_execution();
+    nx::cli::test_serve_response_encoding();
+    nx::cli::test_execute_command_is_reentrant();
+    nx::cli::test_execute_command_routes_component_handlers();
+    
+    std::cout << "\n✅ All nx-cli serve tests passed!\n";
+    return 0;
+}
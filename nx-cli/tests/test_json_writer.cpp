@@ -0,0 +1,128 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+
+// Test includes
+#include "../include/json_writer.h"
+
+using namespace nx::cli;
+
+namespace {
+
+// Byte-at-a-time reference escapers (the formats the CLI has always emitted)
+std::string reference_unicode(std::string_view input) {
+    static constexpr char hex[] = "0123456789abcdef";
+    std::string output;
+    for (char c : input) {
+        switch (c) {
+            case '"':  output += "\\\""; break;
+            case '\\': output += "\\\\"; break;
+            case '\n': output += "\\n"; break;
+            case '\r': output += "\\r"; break;
+            case '\t': output += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    output += "\\u00";
+                    output += hex[(c >> 4) & 0xF];
+                    output += hex[c & 0xF];
+                } else {
+                    output += c;
+                }
+        }
+    }
+    return output;
+}
+
+std::string reference_legacy(std::string_view input) {
+    std::string output;
+    for (char c : input) {
+        switch (c) {
+            case '"':  output += "\\\""; break;
+            case '\\': output += "\\\\"; break;
+            case '\b': output += "\\b"; break;
+            case '\f': output += "\\f"; break;
+            case '\n': output += "\\n"; break;
+            case '\r': output += "\\r"; break;
+            case '\t': output += "\\t"; break;
+            default:   output += c; break;
+        }
+    }
+    return output;
+}
+
+std::string escaped(std::string_view input, JsonEscape escape) {
+    std::string output;
+    append_json_escaped(output, input, escape);
+    return output;
+}
+
+} // namespace
+
+void test_escape_matches_reference() {
+    std::cout << "Testing escaping against the byte-wise reference...\n";
+
+    assert(escaped("", JsonEscape::Unicode).empty());
+    assert(escaped("plain ascii", JsonEscape::Unicode) == "plain ascii");
+    assert(escaped("a\"b\\c\nd", JsonEscape::Unicode) == "a\\\"b\\\\c\\nd");
+    assert(escaped(std::string("\x01\x1f\b\f", 4), JsonEscape::Unicode) == "\\u0001\\u001f\\u0008\\u000c");
+    assert(escaped(std::string("\x01\b\f", 3), JsonEscape::Legacy) == std::string("\x01\\b\\f"));
+    assert(escaped("h\xc3\xa9llo \x7f", JsonEscape::Unicode) == "h\xc3\xa9llo \x7f");   // UTF-8 and DEL verbatim
+
+    // Every byte value at every position of blocks around the 16/32-byte strides
+    for (size_t length : {1u, 15u, 16u, 17u, 31u, 32u, 33u, 64u, 100u}) {
+        for (size_t position = 0; position < length; ++position) {
+            for (int value = 0; value < 256; ++value) {
+                std::string input(length, 'x');
+                input[position] = static_cast<char>(value);
+                assert(escaped(input, JsonEscape::Unicode) == reference_unicode(input));
+                assert(escaped(input, JsonEscape::Legacy) == reference_legacy(input));
+            }
+        }
+    }
+
+    // Random mixes, dense and sparse in special bytes
+    std::mt19937 rng(12345);
+    for (int round = 0; round < 2000; ++round) {
+        std::string input(rng() % 300, '\0');
+        bool dense = round % 2 == 0;
+        for (char& c : input) {
+            c = dense ? static_cast<char>(rng() % 256) : (rng() % 40 == 0 ? '"' : static_cast<char>('a' + rng() % 26));
+        }
+        assert(escaped(input, JsonEscape::Unicode) == reference_unicode(input));
+        assert(escaped(input, JsonEscape::Legacy) == reference_legacy(input));
+    }
+    std::cout << "✓ Vectorized escaping is byte-identical to the reference\n";
+}
+
+void test_writer_primitives() {
+    std::cout << "Testing writer primitives...\n";
+    std::string buffer;
+    JsonWriter json(buffer);
+    json.raw("{\"id\": ").string("a\"b").raw(", \"n\": ").number(uint64_t{18446744073709551615u})
+        .raw(", \"m\": ").number(-42).raw(", \"ok\": ").boolean(true).raw(", \"x\": ").null().raw('}');
+    assert(buffer == "{\"id\": \"a\\\"b\", \"n\": 18446744073709551615, \"m\": -42, \"ok\": true, \"x\": null}");
+
+    // Reusing the buffer keeps its capacity
+    size_t capacity = buffer.capacity();
+    buffer.clear();
+    json.escaped("tab\there");
+    assert(buffer == "tab\\there" && buffer.capacity() == capacity);
+
+    std::string legacy;
+    JsonWriter legacy_json(legacy, JsonEscape::Legacy);
+    legacy_json.string(std::string("\b\x01", 2));
+    assert(legacy == std::string("\"\\b\x01\"", 5));
+    std::cout << "✓ Writer appends fields in place\n";
+}
+
+int main() {
+    std::cout << "=== JSON Writer Tests ===\n\n";
+
+    test_escape_matches_reference();
+    test_writer_primitives();
+
+    std::cout << "\n✅ All JSON writer tests passed\n";
+    return 0;
+}
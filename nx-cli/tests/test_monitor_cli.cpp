@@ -1,10 +1,51 @@
 #include "monitor_argument_parser.h"
 #include "monitor_command.h"
+#include "nx/monitor/MetricsRegistry.h"
+#include "nx/monitor/OpenMetricsExporter.h"
+#include "nx/monitor/RealMonitorEngine.h"
 #include <iostream>
+#include <sstream>
 #include <cassert>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
 
 namespace nx::cli {
 
+namespace {
+
+// Stands in for a session-running process: exports registry on a socket
+// and points NX_MONITOR_SOCKET at it for the lifetime of the object
+class LiveSource {
+public:
+    explicit LiveSource(const nx::monitor::MetricsRegistry& registry)
+        : engine_(registry)
+        , exporter_(engine_, options()) {
+        ::setenv(nx::monitor::kMonitorSocketEnv, socket_path().c_str(), 1);
+    }
+    
+    ~LiveSource() {
+        ::unsetenv(nx::monitor::kMonitorSocketEnv);
+    }
+    
+private:
+    nx::monitor::RealMonitorEngine engine_;
+    nx::monitor::OpenMetricsExporter exporter_;
+    
+    static std::filesystem::path socket_path() {
+        return std::filesystem::temp_directory_path() / ("nx_monitor_cli_" + std::to_string(::getpid()) + ".sock");
+    }
+    
+    static nx::monitor::OpenMetricsExportOptions options() {
+        nx::monitor::OpenMetricsExportOptions options;
+        options.socket_path = socket_path();
+        return options;
+    }
+};
+
+} // namespace
+
 void test_monitor_status_parsing() {
     std::cout << "Testing monitor status argument parsing...\n";
     
@@ -232,19 +273,22 @@ void test_duplicate_flag_rejection() {
 void test_engine_not_implemented_responses() {
     std::cout << "Testing engine not implemented responses...\n";
     
-    // All operations should return NX_ENGINE_REJECTED in Phase 4
+    // Live-source operations answer; engines/version are still Phase 4 stubs
+    nx::monitor::MetricsRegistry registry;
+    LiveSource live(registry);
+    
     {
         MonitorStatusRequest request;
-        auto result = MonitorCommand::handle_status(request);
-        assert(!result.success);
-        assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+        std::ostringstream out;
+        auto result = MonitorCommand::handle_status(request, out);
+        assert(result.success);
     }
     
     {
         MonitorJobsRequest request;
-        auto result = MonitorCommand::handle_jobs(request);
-        assert(!result.success);
-        assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+        std::ostringstream out;
+        auto result = MonitorCommand::handle_jobs(request, out);
+        assert(result.success);
     }
     
     {
@@ -252,7 +296,7 @@ void test_engine_not_implemented_responses() {
         request.job_id = "test-job";
         auto result = MonitorCommand::handle_job(request);
         assert(!result.success);
-        assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+        assert(result.error_code == CliErrorCode::ERROR_JOB_NOT_FOUND);
     }
     
     {
@@ -275,21 +319,25 @@ void test_engine_not_implemented_responses() {
 void test_read_only_enforcement() {
     std::cout << "Testing read-only enforcement...\n";
     
-    // Verify no operation can mutate state (all return engine rejected)
-    // This ensures Phase 4 compliance - no execution, only observation contracts
+    // Observation never records anything: repeated queries leave the registry unchanged
+    nx::monitor::MetricsRegistry registry;
+    LiveSource live(registry);
+    auto before = registry.snapshot();
     
+    std::ostringstream out;
     MonitorStatusRequest status_req;
-    auto status_result = MonitorCommand::handle_status(status_req);
-    assert(status_result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
-    
+    MonitorCommand::handle_status(status_req, out);
     MonitorJobsRequest jobs_req;
-    auto jobs_result = MonitorCommand::handle_jobs(jobs_req);
-    assert(jobs_result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
-    
+    MonitorCommand::handle_jobs(jobs_req, out);
     MonitorJobRequest job_req;
     job_req.job_id = "test";
-    auto job_result = MonitorCommand::handle_job(job_req);
-    assert(job_result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+    MonitorCommand::handle_job(job_req, out);
+    
+    auto after = registry.snapshot();
+    assert(after.running() == before.running());
+    assert(after.completed() == before.completed());
+    assert(after.failed() == before.failed());
+    assert(!registry.job("test").has_value());
     
     MonitorEnginesRequest engines_req;
     auto engines_result = MonitorCommand::handle_engines(engines_req);
@@ -305,43 +353,264 @@ void test_read_only_enforcement() {
 void test_deterministic_output_order() {
     std::cout << "Testing deterministic output order...\n";
     
-    // Test that operations produce consistent output (no randomization)
-    // Multiple calls should produce identical results
+    nx::monitor::MetricsRegistry registry;
+    registry.record_transition("session_1", "job_b", 0, nx::monitor::MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_a", 1, nx::monitor::MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_a", 1, nx::monitor::MonitoredJobState::Completed);
+    LiveSource live(registry);
     
-    MonitorStatusRequest request1, request2;
-    request1.flags.json_output = true;
-    request2.flags.json_output = true;
+    MonitorJobsRequest request;
+    request.flags.json_output = true;
+    std::ostringstream first, second;
+    auto result1 = MonitorCommand::handle_jobs(request, first);
+    auto result2 = MonitorCommand::handle_jobs(request, second);
     
-    // Both should fail identically (Phase 4 behavior)
-    auto result1 = MonitorCommand::handle_status(request1);
-    auto result2 = MonitorCommand::handle_status(request2);
-    
-    assert(result1.success == result2.success);
-    assert(result1.error_code == result2.error_code);
+    assert(result1.success && result2.success);
+    assert(first.str() == second.str());
+    assert(first.str().find("\"job_a\"") < first.str().find("\"job_b\""));
     
     std::cout << "✓ Deterministic output order tests passed\n";
 }
 
+void test_live_source_operations() {
+    std::cout << "Testing live-source status/jobs/job...\n";
+    
+    nx::monitor::MetricsRegistry registry;
+    registry.record_transition("session_1", "job_1", 0, nx::monitor::MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_1", 0, nx::monitor::MonitoredJobState::Completed);
+    registry.record_transition("session_1", "job_2", 1, nx::monitor::MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_2", 1, nx::monitor::MonitoredJobState::Failed);
+    registry.record_transition("session_1", "job_3", 0, nx::monitor::MonitoredJobState::Running);
+    LiveSource live(registry);
+    
+    {
+        MonitorStatusRequest request;
+        std::ostringstream out;
+        auto result = MonitorCommand::handle_status(request, out);
+        assert(result.success);
+        assert(out.str().find("active_jobs_count=1\n") != std::string::npos);
+        assert(out.str().find("completed_jobs_count=1\n") != std::string::npos);
+        assert(out.str().find("failed_jobs_count=1\n") != std::string::npos);
+    }
+    
+    {
+        MonitorJobsRequest request;
+        std::ostringstream out;
+        auto result = MonitorCommand::handle_jobs(request, out);
+        assert(result.success);
+        std::string expected =
+            "session_1 job_1 " + std::string(nx::monitor::MetricsRegistry::engine_name(0)) + " completed\n" +
+            "session_1 job_2 " + std::string(nx::monitor::MetricsRegistry::engine_name(1)) + " failed\n" +
+            "session_1 job_3 " + std::string(nx::monitor::MetricsRegistry::engine_name(0)) + " running\n";
+        assert(out.str() == expected);
+    }
+    
+    {
+        MonitorJobRequest request;
+        request.job_id = "job_3";
+        request.flags.json_output = true;
+        std::ostringstream out;
+        auto result = MonitorCommand::handle_job(request, out);
+        assert(result.success);
+        assert(out.str().find("\"state\": \"running\"") != std::string::npos);
+        assert(out.str().find("\"completed_at\": null") != std::string::npos);
+    }
+    
+    std::cout << "✓ Live-source operations tests passed\n";
+}
+
+void test_no_live_source_rejected() {
+    std::cout << "Testing operations without a live source...\n";
+    
+    // Jobs recorded in this process are not a live source: nx-cli never executes sessions
+    auto& registry = nx::monitor::MetricsRegistry::global();
+    registry.reset();
+    registry.record_transition("session_1", "job_1", 0, nx::monitor::MonitoredJobState::Running);
+    ::unsetenv(nx::monitor::kMonitorSocketEnv);
+    
+    const std::vector<std::vector<std::string>> operations = {
+        {"status"}, {"jobs"}, {"job", "--id", "job_1"}, {"stats"}, {"metrics"}
+    };
+    for (const auto& args : operations) {
+        std::ostringstream out;
+        auto result = MonitorCommand::execute(args, out);
+        assert(!result.success);
+        assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+        assert(result.message.find(nx::monitor::kMonitorSocketEnv) != std::string::npos);
+        assert(out.str().empty());
+    }
+    
+    // A socket nobody serves is rejected the same way
+    auto missing = std::filesystem::temp_directory_path() / ("nx_monitor_cli_missing_" + std::to_string(::getpid()));
+    ::setenv(nx::monitor::kMonitorSocketEnv, missing.c_str(), 1);
+    {
+        std::ostringstream out;
+        auto result = MonitorCommand::execute({"status"}, out);
+        assert(!result.success);
+        assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+        assert(result.message.find(missing.string()) != std::string::npos);
+        assert(out.str().empty());
+    }
+    ::unsetenv(nx::monitor::kMonitorSocketEnv);
+    
+    registry.reset();
+    std::cout << "✓ Missing live source rejected\n";
+}
+
+void test_job_session_selection() {
+    std::cout << "Testing job lookup by session...\n";
+    
+    {
+        std::vector<std::string> args = {"--id", "job_1", "--session"};
+        MonitorJobRequest request;
+        auto result = MonitorArgumentParser::parse_job_args(args, request);
+        assert(!result.success);
+        assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    }
+    
+    nx::monitor::MetricsRegistry registry;
+    registry.record_transition("session_a", "job_1", 0, nx::monitor::MonitoredJobState::Running);
+    registry.record_transition("session_a", "job_1", 0, nx::monitor::MonitoredJobState::Completed);
+    registry.record_transition("session_b", "job_1", 1, nx::monitor::MonitoredJobState::Running);
+    LiveSource live(registry);
+    
+    {
+        std::ostringstream out;
+        auto result = MonitorCommand::execute({"jobs", "--json"}, out);
+        assert(result.success);
+        assert(out.str().find("\"session_id\": \"session_a\"") < out.str().find("\"session_id\": \"session_b\""));
+    }
+    
+    {
+        std::ostringstream out;
+        auto result = MonitorCommand::execute({"job", "--id", "job_1", "--session", "session_a"}, out);
+        assert(result.success);
+        assert(out.str().find("session_id=session_a\n") != std::string::npos);
+        assert(out.str().find("state=completed\n") != std::string::npos);
+    }
+    
+    {
+        // Without --session the most recently started job answers
+        std::ostringstream out;
+        auto result = MonitorCommand::execute({"job", "--id", "job_1", "--json"}, out);
+        assert(result.success);
+        assert(out.str().find("\"session_id\": \"session_b\"") != std::string::npos);
+        assert(out.str().find("\"completed_at\": null") != std::string::npos);
+    }
+    
+    {
+        auto result = MonitorCommand::execute({"job", "--id", "job_1", "--session", "session_c"});
+        assert(!result.success);
+        assert(result.error_code == CliErrorCode::ERROR_JOB_NOT_FOUND);
+    }
+    
+    std::cout << "✓ Job lookup by session tests passed\n";
+}
+
+void test_stats_operation() {
+    std::cout << "Testing monitor stats...\n";
+    
+    {
+        std::vector<std::string> args = {"--json"};
+        MonitorStatsRequest request;
+        auto result = MonitorArgumentParser::parse_stats_args(args, request);
+        assert(result.success);
+        assert(request.flags.json_output);
+    }
+    
+    {
+        std::vector<std::string> args = {"--watch"};
+        MonitorStatsRequest request;
+        auto result = MonitorArgumentParser::parse_stats_args(args, request);
+        assert(!result.success);
+        assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    }
+    
+    nx::monitor::MetricsRegistry registry;
+    registry.record_transition("session_1", "job_1", 0, nx::monitor::MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_1", 0, nx::monitor::MonitoredJobState::Completed);
+    LiveSource live(registry);
+    
+    {
+        std::vector<std::string> args = {"stats", "--json"};
+        std::ostringstream out;
+        auto result = MonitorCommand::execute(args, out);
+        assert(result.success);
+        const std::string json = out.str();
+        assert(json.find("\"jobs_finished\": 1,") != std::string::npos);
+        assert(json.find("\"latency_unit\": \"us\"") != std::string::npos);
+        assert(json.find("\"engine\": \"" + std::string(nx::monitor::MetricsRegistry::engine_name(0)) + "\"") !=
+               std::string::npos);
+        assert(json.find("\"latency\": { \"count\": 1,") != std::string::npos);
+        assert(json.find("Unattributed") == std::string::npos);
+    }
+    
+    {
+        MonitorStatsRequest request;
+        std::ostringstream out;
+        auto result = MonitorCommand::handle_stats(request, out);
+        assert(result.success);
+        assert(out.str().find("jobs_finished=1\n") != std::string::npos);
+    }
+    
+    std::cout << "✓ Monitor stats tests passed\n";
+}
+
+void test_metrics_operation() {
+    std::cout << "Testing monitor metrics...\n";
+    
+    {
+        std::vector<std::string> args = {"metrics", "--json"};
+        auto result = MonitorCommand::execute(args);
+        assert(!result.success);
+        assert(result.error_code == CliErrorCode::NX_CLI_USAGE_ERROR);
+    }
+    
+    nx::monitor::MetricsRegistry registry;
+    LiveSource live(registry);
+    
+    {
+        std::vector<std::string> args = {"metrics"};
+        std::ostringstream out;
+        auto result = MonitorCommand::execute(args, out);
+        assert(result.success);
+        assert(out.str().find("# TYPE nx_job_latency_seconds histogram\n") != std::string::npos);
+        assert(out.str().size() >= 6 && out.str().substr(out.str().size() - 6) == "# EOF\n");
+    }
+    
+    std::cout << "✓ Monitor metrics tests passed\n";
+}
+
 void test_operation_routing() {
     std::cout << "Testing operation routing...\n";
     
+    nx::monitor::MetricsRegistry registry;
+    LiveSource live(registry);
+    
     // Valid operations should route correctly
     {
         std::vector<std::string> args = {"status"};
-        auto result = MonitorCommand::execute(args);
-        assert(!result.success);
-        assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+        std::ostringstream out;
+        auto result = MonitorCommand::execute(args, out);
+        assert(result.success);
     }
     
     {
         std::vector<std::string> args = {"jobs"};
+        std::ostringstream out;
+        auto result = MonitorCommand::execute(args, out);
+        assert(result.success);
+    }
+    
+    {
+        std::vector<std::string> args = {"job", "--id", "test"};
         auto result = MonitorCommand::execute(args);
         assert(!result.success);
-        assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
+        assert(result.error_code == CliErrorCode::ERROR_JOB_NOT_FOUND);
     }
     
     {
-        std::vector<std::string> args = {"job", "--id", "test"};
+        std::vector<std::string> args = {"engines"};
         auto result = MonitorCommand::execute(args);
         assert(!result.success);
         assert(result.error_code == CliErrorCode::NX_ENGINE_REJECTED);
@@ -359,9 +628,13 @@ void test_operation_routing() {
 }
 
 void test_no_placeholder_output() {
+    nx::monitor::MetricsRegistry registry;
+    LiveSource live(registry);
     MonitorStatusRequest request;
-    auto result = MonitorCommand::handle_status(request);
-    assert(!result.success);
+    std::ostringstream out;
+    auto result = MonitorCommand::handle_status(request, out);
+    assert(result.success);
+    assert(out.str().find("request accepted") == std::string::npos);
 }
 
 } // namespace nx::cli
@@ -380,6 +653,11 @@ int main() {
     nx::cli::test_engine_not_implemented_responses();
     nx::cli::test_read_only_enforcement();
     nx::cli::test_deterministic_output_order();
+    nx::cli::test_live_source_operations();
+    nx::cli::test_no_live_source_rejected();
+    nx::cli::test_job_session_selection();
+    nx::cli::test_stats_operation();
+    nx::cli::test_metrics_operation();
     nx::cli::test_operation_routing();
     nx::cli::test_no_placeholder_output();
     
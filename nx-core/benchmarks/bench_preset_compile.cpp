@@ -0,0 +1,114 @@
+#include "../include/nx_batchflow_preset_compiler.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <thread>
+
+using namespace nx::batchflow;
+
+// Wall-clock timing is acceptable here: benchmarks are outside the deterministic core
+
+// Generate a layered preset: each job depends on up to two jobs of the previous layer
+static BatchFlowPreset generate_preset(size_t job_count) {
+    BatchFlowPreset preset(PresetVersion::current(), "Generated benchmark preset",
+                           "Synthetic preset for preset-to-graph latency");
+    const size_t width = 64;
+
+    for (size_t i = 0; i < job_count; ++i) {
+        std::string name = "job_" + std::to_string(i);
+        std::string params = "{\"input\":\"media/source_" + std::to_string(i) +
+                             ".mp4\",\"codec\":\"h264\",\"crf\":18}";
+        std::vector<std::string> inputs;
+        if (i >= width) {
+            inputs.push_back("artifact_" + std::to_string(i - width));
+            preset.add_dependency(PresetDependency("job_" + std::to_string(i - width), name));
+            if (i % width != 0) {
+                inputs.push_back("artifact_" + std::to_string(i - width - 1));
+                preset.add_dependency(PresetDependency("job_" + std::to_string(i - width - 1), name));
+            }
+        }
+        preset.add_job(PresetJobDefinition(name, "nx_convert_pro", "transcode", std::move(params),
+                                           std::move(inputs), {"artifact_" + std::to_string(i)}));
+    }
+
+    return preset;
+}
+
+// Per-element construction: JobDefinition, add_node, name->JobId map, add_dependency
+static JobGraph build_incrementally(const BatchFlowPreset& preset) {
+    JobGraph graph;
+    std::map<std::string, JobId> ids;
+    for (const auto& [name, job] : preset.jobs()) {
+        std::vector<ArtifactId> inputs, outputs;
+        for (const auto& a : job.input_artifacts) inputs.emplace_back(a);
+        for (const auto& a : job.output_artifacts) outputs.emplace_back(a);
+        JobNode node = JobNode::from_definition(JobDefinition(job.engine_identifier, job.api_operation,
+                                                              job.parameters_blob, std::move(inputs),
+                                                              std::move(outputs)));
+        ids.emplace(name, node.id());
+        graph.add_node(std::move(node));
+    }
+    for (const auto& dep : preset.dependencies()) {
+        graph.add_dependency(JobDependency(ids.at(dep.from_job), ids.at(dep.to_job)));
+    }
+    graph.finalize();
+    return graph;
+}
+
+template <typename Fn>
+static double best_seconds(int iterations, Fn&& fn) {
+    double best = 0.0;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (i == 0 || elapsed.count() < best) {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    size_t job_count = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 100000;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    auto preset = generate_preset(job_count);
+
+    size_t incremental_nodes = 0;
+    double incremental_seconds = best_seconds(iterations, [&]() {
+        incremental_nodes = build_incrementally(preset).node_count();
+    });
+
+    // Validation is memoized per preset, so time it on unvalidated copies
+    std::vector<BatchFlowPreset> fresh(static_cast<size_t>(iterations), preset);
+    size_t next_fresh = 0;
+    double validate_seconds = best_seconds(iterations, [&]() {
+        fresh[next_fresh++].is_valid();
+    });
+
+    size_t serial_nodes = 0;
+    double serial_seconds = best_seconds(iterations, [&]() {
+        serial_nodes = compile_preset(preset, PresetCompileOptions{1, 0}).node_count();
+    });
+
+    size_t parallel_nodes = 0;
+    double parallel_seconds = best_seconds(iterations, [&]() {
+        parallel_nodes = compile_preset(preset).node_count();
+    });
+
+    if (incremental_nodes != job_count || serial_nodes != job_count || parallel_nodes != job_count) {
+        std::cerr << "Benchmark self-check failed\n";
+        return 1;
+    }
+
+    std::cout << "jobs:                 " << job_count << "\n"
+              << "dependencies:         " << preset.dependencies().size() << "\n"
+              << "threads:              " << std::thread::hardware_concurrency() << "\n"
+              << "incremental build:    " << incremental_seconds * 1000.0 << " ms\n"
+              << "validation (once):    " << validate_seconds * 1000.0 << " ms\n"
+              << "compile_preset (1t):  " << serial_seconds * 1000.0 << " ms (validated preset)\n"
+              << "compile_preset (all): " << parallel_seconds * 1000.0 << " ms (validated preset)\n";
+    return 0;
+}
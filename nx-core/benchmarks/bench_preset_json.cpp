@@ -0,0 +1,79 @@
+#include "../include/nx_batchflow_preset.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace nx::batchflow;
+
+// Wall-clock timing is acceptable here: benchmarks are outside the deterministic core
+
+// Generate a chain-structured preset with realistic field sizes
+static BatchFlowPreset generate_preset(size_t job_count) {
+    BatchFlowPreset preset(PresetVersion::current(), "Generated benchmark preset",
+                           "Synthetic preset for JSON throughput measurement");
+
+    for (size_t i = 0; i < job_count; ++i) {
+        std::string name = "job_" + std::to_string(i);
+        std::string params = "{\"input\":\"media/source_" + std::to_string(i) +
+                             ".mp4\",\"codec\":\"h264\",\"crf\":18,\"preset\":\"slow\","
+                             "\"filters\":[\"scale=1920:1080\",\"fps=30\"]}";
+        std::vector<std::string> inputs;
+        if (i > 0) {
+            inputs.push_back("artifact_" + std::to_string(i - 1));
+        }
+        preset.add_job(PresetJobDefinition(name, "nx_convert_pro", "transcode", std::move(params),
+                                           std::move(inputs), {"artifact_" + std::to_string(i)}));
+        if (i > 0) {
+            preset.add_dependency(PresetDependency("job_" + std::to_string(i - 1), name));
+        }
+        if (i % 10 == 0) {
+            preset.add_retry_policy(PresetRetryPolicy(name, 3, 2, {"Failed"}));
+        }
+    }
+
+    return preset;
+}
+
+template <typename Fn>
+static double best_seconds(int iterations, Fn&& fn) {
+    double best = 0.0;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (i == 0 || elapsed.count() < best) {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    size_t job_count = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 100000;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    auto preset = generate_preset(job_count);
+    std::string json = preset.to_json();
+    double megabytes = static_cast<double>(json.size()) / (1024.0 * 1024.0);
+
+    size_t parsed_jobs = 0;
+    double parse_seconds = best_seconds(iterations, [&]() {
+        parsed_jobs = BatchFlowPreset::from_json(json).jobs().size();
+    });
+
+    size_t written_bytes = 0;
+    double write_seconds = best_seconds(iterations, [&]() {
+        written_bytes = preset.to_json().size();
+    });
+
+    if (parsed_jobs != job_count || written_bytes != json.size()) {
+        std::cerr << "Benchmark self-check failed\n";
+        return 1;
+    }
+
+    std::cout << "jobs:        " << job_count << "\n"
+              << "json size:   " << megabytes << " MB\n"
+              << "parse:       " << megabytes / parse_seconds << " MB/s (" << parse_seconds * 1000.0 << " ms)\n"
+              << "serialize:   " << megabytes / write_seconds << " MB/s (" << write_seconds * 1000.0 << " ms)\n";
+    return 0;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "nx_batchflow_preset.h"
+#include "nx_batchflow_dag.h"
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nx::batchflow {
+
+/// CompiledPresetError reports unreadable, truncated or incompatible compiled presets
+class CompiledPresetError : public std::runtime_error {
+public:
+    explicit CompiledPresetError(const std::string& message)
+        : std::runtime_error("Compiled preset error: " + message) {}
+};
+
+/// Read-only view of one compiled job
+/// Views reference the compiled image and are valid while the CompiledPreset lives
+struct CompiledJobView {
+    std::string_view job_name;
+    std::string_view engine_identifier;
+    std::string_view api_operation;
+    std::string_view parameters_blob;
+    std::string_view job_id;                        // Precomputed JobId digest (hex)
+    std::vector<std::string_view> input_artifacts;  // Declared order
+    std::vector<std::string_view> output_artifacts; // Declared order
+};
+
+/// Read-only range over a CSR adjacency row (dense job indices)
+class CompiledEdgeRange {
+public:
+    CompiledEdgeRange(const uint32_t* begin, const uint32_t* end) : begin_(begin), end_(end) {}
+
+    const uint32_t* begin() const noexcept { return begin_; }
+    const uint32_t* end() const noexcept { return end_; }
+    size_t size() const noexcept { return static_cast<size_t>(end_ - begin_); }
+    bool empty() const noexcept { return begin_ == end_; }
+    uint32_t operator[](size_t i) const noexcept { return begin_[i]; }
+
+private:
+    const uint32_t* begin_;
+    const uint32_t* end_;
+};
+
+/// CompiledPreset is an immutable, memory-mapped binary image of a BatchFlowPreset
+///
+/// The image holds:
+/// - a string table for all names, blobs and artifacts
+/// - jobs sorted by name (dense index = position), each with its JobId digest
+/// - upstream and downstream dependency adjacency in CSR form
+/// - retry policies by job index
+/// - the validation result captured at compile time
+///
+/// Dependencies and retry policies that reference unknown jobs have no dense
+/// index; they are omitted from the image and remain visible only through
+/// validation_errors().
+///
+/// open() maps the file and checks only the fixed header and section bounds, so
+/// loading costs near-constant time regardless of preset size. Individual
+/// records are bounds-checked on access.
+///
+/// Recompile rules: the image records the preset schema version, the binary
+/// format version and a digest of the preset source text (the source file
+/// bytes for compile_file(), canonical JSON otherwise). A recompile is needed
+/// when the format version differs, when the schema version is not compatible
+/// with PresetVersion::current(), or when the source digest changes. The check
+/// reads only the image header and hashes the source bytes; it never parses
+/// the preset.
+class CompiledPreset {
+public:
+    /// Binary layout version - bump on any layout or field meaning change
+    static constexpr uint32_t kFormatVersion = 2;
+
+    /// Compile preset into binary image bytes
+    static std::string compile(const BatchFlowPreset& preset);
+
+    /// Compile preset and write image to path (atomic replace)
+    static void compile_to_file(const BatchFlowPreset& preset, const std::filesystem::path& path);
+
+    /// Parse preset JSON file, compile it and write image to path (atomic replace)
+    /// The image records the digest of the source file bytes
+    static void compile_file(const std::filesystem::path& source_path, const std::filesystem::path& path);
+
+    /// Map compiled image from file
+    /// Throws CompiledPresetError on unreadable or incompatible images
+    static CompiledPreset open(const std::filesystem::path& path);
+
+    /// Load compiled image from in-memory bytes (copied)
+    static CompiledPreset from_bytes(std::string bytes);
+
+    /// Check whether the compiled image at path must be rebuilt from source_path
+    /// True when either file is missing or unreadable, the image is format/schema
+    /// incompatible, or the source bytes changed since compile_file()
+    static bool needs_recompile(const std::filesystem::path& path, const std::filesystem::path& source_path);
+
+    /// Digest of preset source text, as recorded in compiled images
+    static std::string source_digest(const std::string& source_text);
+
+    /// Preset metadata
+    PresetVersion version() const;
+    std::string_view name() const;
+    std::string_view description() const;
+    std::string_view recorded_source_digest() const;
+
+    /// Schema version compatible with PresetVersion::current()
+    bool is_compatible() const { return version().is_compatible_with(PresetVersion::current()); }
+
+    /// Validation result captured at compile time
+    bool is_valid() const;
+    std::vector<std::string_view> validation_errors() const;
+
+    /// Job access by dense index (jobs are ordered by name)
+    size_t job_count() const;
+    CompiledJobView job(size_t index) const;
+    std::string_view job_name(size_t index) const;
+    JobId job_id(size_t index) const;
+
+    /// Binary search by job name
+    std::optional<size_t> find_job(std::string_view job_name) const;
+
+    /// Dependency adjacency (dense indices)
+    size_t dependency_count() const;
+    CompiledEdgeRange dependencies_of(size_t index) const;
+    CompiledEdgeRange dependents_of(size_t index) const;
+
+    /// Retry policy for job, if declared
+    std::optional<PresetRetryPolicy> retry_policy(size_t index) const;
+
+    /// Rebuild the source preset
+    BatchFlowPreset to_preset() const;
+
+    /// Build finalized JobGraph using precomputed JobIds (no rehashing)
+    JobGraph to_job_graph() const;
+
+private:
+    struct Image;
+    std::shared_ptr<const Image> image_;
+
+    static std::string compile(const BatchFlowPreset& preset, const std::string& source_digest);
+
+    explicit CompiledPreset(std::shared_ptr<const Image> image) : image_(std::move(image)) {}
+};
+
+} // namespace nx::batchflow
@@ -6,6 +6,13 @@
 #include <map>
 #include <memory>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+#include <iterator>
 
 namespace nx::batchflow {
 
@@ -78,13 +85,67 @@ private:
     std::string parameters_blob_; // Canonicalized engine parameters
 };
 
+/// Hash functor for unordered JobId lookups (hash strings are already uniform)
+struct JobIdStdHash {
+    size_t operator()(const JobId& id) const noexcept { return std::hash<std::string>{}(id.hash()); }
+};
+
+/// DenseEdge is a dependency between node positions, used for bulk construction
+struct DenseEdge {
+    uint32_t from;  // Position of job that must complete first
+    uint32_t to;    // Position of dependent job
+};
+
+/// GraphFinalizeOptions selects optional passes run by JobGraph::finalize()
+struct GraphFinalizeOptions {
+    /// Add producer -> consumer edges for jobs added with add_job_definition():
+    /// a job consuming an artifact depends on the job producing it. Inputs with
+    /// no producer in the graph are external and add no edge.
+    bool infer_artifact_dependencies = false;
+    
+    /// Drop repeated edges between the same pair of jobs, keeping the first
+    bool deduplicate_edges = false;
+    
+    /// Keep only edges not implied by another path (transitive reduction)
+    /// Implies deduplicate_edges
+    bool reduce_transitive_edges = false;
+    
+    /// Inference plus reduction: minimal edge set derived from artifacts
+    static GraphFinalizeOptions inferred() {
+        GraphFinalizeOptions options;
+        options.infer_artifact_dependencies = true;
+        options.reduce_transitive_edges = true;
+        return options;
+    }
+};
+
+/// GraphFinalizeReport counts edges removed by the optional finalize passes
+struct GraphFinalizeReport {
+    size_t inferred_edges = 0;            // Edges added from artifact ids
+    size_t duplicate_edges_removed = 0;   // Repeats of an existing edge
+    size_t transitive_edges_removed = 0;  // Edges implied by another path
+    
+    size_t edges_removed() const noexcept { return duplicate_edges_removed + transitive_edges_removed; }
+};
+
 /// JobGraph represents a complete, immutable DAG of job nodes and dependencies
 /// Must be fully constructed before any execution, cannot be modified after construction
+///
+/// Finalization interns every JobId to a dense index and stores adjacency in
+/// CSR form (offsets + targets), so finalize() and the cycle check run in
+/// O(V + E). Dependency endpoints that are not graph nodes keep their own
+/// dense index so lookups on them behave as before.
 class JobGraph {
 public:
     /// Create empty job graph
     JobGraph() = default;
     
+    /// Build finalized graph in one step from nodes and position-based edges
+    /// Skips JobId interning and per-edge lookups; storage is sized up front
+    /// Throws std::invalid_argument if an edge position is out of range,
+    /// std::runtime_error if the edges contain a cycle
+    static JobGraph from_dense_edges(std::vector<JobNode> nodes, const std::vector<DenseEdge>& edges);
+    
     /// Add job node to graph (only during construction phase)
     /// Preferred: Use add_job_definition() to ensure JobId correctness
     /// Throws if graph is already finalized
@@ -104,6 +165,8 @@ public:
         }
         JobNode node = JobNode::from_definition(definition);
         add_node(std::move(node));
+        node_artifacts_.resize(nodes_.size());
+        node_artifacts_.back() = NodeArtifacts{definition.input_artifacts, definition.output_artifacts};
     }
     
     /// Add dependency between existing nodes (only during construction phase)
@@ -118,16 +181,15 @@ public:
     /// Finalize graph construction - makes graph immutable and validates acyclic property
     /// Must be called before graph can be used for execution
     /// Throws if graph contains cycles
-    void finalize() {
-        if (finalized_) {
-            return; // Already finalized
-        }
-        if (has_cycle()) {
-            throw std::runtime_error("Graph contains cycles");
-        }
-        build_lookup_structures();
-        finalized_ = true;
-    }
+    void finalize() { finalize(GraphFinalizeOptions{}); }
+    
+    /// Finalize with optional inference, deduplication and reduction passes
+    /// dependencies() afterwards lists the effective edge set: explicit edges
+    /// first, then inferred edges, minus any edges removed by the passes
+    /// Returns edge counts per pass (all zero if already finalized)
+    /// Throws if graph contains cycles or an artifact has more than one producer;
+    /// the graph is left unchanged on failure
+    GraphFinalizeReport finalize(const GraphFinalizeOptions& options);
     
     /// Check if graph is finalized (immutable)
     bool is_finalized() const noexcept { return finalized_; }
@@ -148,11 +210,7 @@ public:
         if (!finalized_) {
             throw std::runtime_error("Graph must be finalized before accessing dependencies");
         }
-        auto it = dependency_map_.find(job_id);
-        if (it != dependency_map_.end()) {
-            return it->second;
-        }
-        return std::vector<JobId>{}; // No dependencies
+        return lookup_.ids_in_row(nodes_, lookup_.upstream, job_id);
     }
     
     /// Get dependents of a specific job (only available after finalization)
@@ -163,9 +221,9 @@ public:
         if (!finalized_) {
             throw std::runtime_error("Graph must be finalized before accessing nodes");
         }
-        auto it = node_index_.find(job_id);
-        if (it != node_index_.end()) {
-            return &nodes_[it->second];
+        auto index = lookup_.find(job_id);
+        if (index && *index < nodes_.size()) {
+            return &nodes_[*index];
         }
         return nullptr; // Node not found
     }
@@ -184,66 +242,356 @@ public:
     std::string to_string() const;
 
 private:
+    /// Adjacency rows over dense indices (CSR)
+    struct Adjacency {
+        std::vector<uint32_t> offsets;  // Size index_count + 1
+        std::vector<uint32_t> targets;  // Row order = dependency insertion order
+    };
+    
+    /// Dense index and adjacency built at finalization
+    /// Indices [0, nodes) are node positions; higher indices are external endpoints
+    struct Lookup {
+        std::unordered_map<JobId, uint32_t, JobIdStdHash> index;
+        std::vector<JobId> external_ids;
+        Adjacency upstream;    // Row i: dependencies of i
+        Adjacency downstream;  // Row i: dependents of i
+        
+        size_t index_count(size_t node_count) const { return node_count + external_ids.size(); }
+        
+        std::optional<uint32_t> find(const JobId& id) const {
+            auto it = index.find(id);
+            if (it == index.end()) return std::nullopt;
+            return it->second;
+        }
+        
+        std::vector<JobId> ids_in_row(const std::vector<JobNode>& nodes, const Adjacency& adjacency,
+                                      const JobId& id) const {
+            std::vector<JobId> ids;
+            auto row = find(id);
+            if (!row) return ids;
+            ids.reserve(adjacency.offsets[*row + 1] - adjacency.offsets[*row]);
+            for (uint32_t i = adjacency.offsets[*row]; i < adjacency.offsets[*row + 1]; ++i) {
+                uint32_t target = adjacency.targets[i];
+                ids.push_back(target < nodes.size() ? nodes[target].id() : external_ids[target - nodes.size()]);
+            }
+            return ids;
+        }
+        
+        bool is_acyclic() const {
+            return topological_order(downstream).size() == downstream.offsets.size() - 1;
+        }
+    };
+    
+    /// Artifacts declared for a node (empty for nodes added with add_node)
+    struct NodeArtifacts {
+        std::vector<ArtifactId> inputs;
+        std::vector<ArtifactId> outputs;
+    };
+    
     std::vector<JobNode> nodes_;
     std::vector<JobDependency> dependencies_;
-    std::map<JobId, size_t> node_index_;
-    std::map<JobId, std::vector<JobId>> dependency_map_;
-    std::map<JobId, std::vector<JobId>> dependent_map_;
+    std::vector<NodeArtifacts> node_artifacts_;  // Parallel to nodes_, may be shorter
+    Lookup lookup_;
     bool finalized_ = false;
     
-    /// Internal deterministic cycle detection using ordered traversal
-    bool has_cycle() const {
-        // Simple cycle detection using DFS
-        std::map<JobId, int> state; // 0=unvisited, 1=visiting, 2=visited
-        
-        for (const auto& node : nodes_) {
-            state[node.id()] = 0;
+    /// Producer -> consumer edges from artifact ids, via one ArtifactId -> producer index
+    std::vector<JobDependency> infer_artifact_dependencies() const {
+        std::unordered_map<std::string, size_t> producers;
+        for (size_t i = 0; i < node_artifacts_.size(); ++i) {
+            for (const auto& output : node_artifacts_[i].outputs) {
+                auto [it, inserted] = producers.try_emplace(output.id(), i);
+                if (!inserted && nodes_[it->second].id() != nodes_[i].id()) {
+                    throw std::runtime_error("Artifact '" + output.id() + "' is produced by more than one job");
+                }
+            }
         }
         
-        for (const auto& node : nodes_) {
-            if (state[node.id()] == 0) {
-                if (dfs_has_cycle(node.id(), state)) {
-                    return true;
+        std::vector<JobDependency> inferred;
+        for (size_t i = 0; i < node_artifacts_.size(); ++i) {
+            for (const auto& input : node_artifacts_[i].inputs) {
+                auto it = producers.find(input.id());
+                if (it != producers.end()) {
+                    inferred.emplace_back(nodes_[it->second].id(), nodes_[i].id());
                 }
             }
         }
-        return false;
+        return inferred;
     }
     
-    /// DFS helper for cycle detection
-    bool dfs_has_cycle(const JobId& job_id, std::map<JobId, int>& state) const {
-        state[job_id] = 1; // Mark as visiting
-        
-        // Check all dependencies (outgoing edges)
-        for (const auto& dep : dependencies_) {
-            if (dep.from() == job_id) {
-                const JobId& target = dep.to();
-                if (state[target] == 1) {
-                    return true; // Back edge found - cycle detected
-                }
-                if (state[target] == 0 && dfs_has_cycle(target, state)) {
-                    return true;
+    /// Topological order by Kahn's algorithm; shorter than the index count on a cycle
+    static std::vector<uint32_t> topological_order(const Adjacency& downstream) {
+        const size_t count = downstream.offsets.size() - 1;
+        std::vector<uint32_t> in_degree(count, 0);
+        for (uint32_t target : downstream.targets) {
+            ++in_degree[target];
+        }
+        std::vector<uint32_t> order;
+        order.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (in_degree[i] == 0) order.push_back(i);
+        }
+        for (size_t head = 0; head < order.size(); ++head) {
+            uint32_t current = order[head];
+            for (uint32_t i = downstream.offsets[current]; i < downstream.offsets[current + 1]; ++i) {
+                if (--in_degree[downstream.targets[i]] == 0) {
+                    order.push_back(downstream.targets[i]);
                 }
             }
         }
+        return order;
+    }
+    
+    /// Memory budget for reachability bitsets during transitive reduction
+    static constexpr size_t kReductionBitsetBytes = size_t{32} << 20;
+    
+    /// Mark first occurrence of each (from, to) pair
+    static std::vector<bool> unique_edge_mask(const std::vector<DenseEdge>& edges) {
+        std::vector<bool> keep(edges.size(), false);
+        std::unordered_set<uint64_t> seen;
+        seen.reserve(edges.size());
+        for (size_t e = 0; e < edges.size(); ++e) {
+            keep[e] = seen.insert((uint64_t{edges[e].from} << 32) | edges[e].to).second;
+        }
+        return keep;
+    }
+    
+    /// Mark edges that survive transitive reduction of an acyclic, duplicate-free edge set
+    /// Per source, successors are visited in topological order; an edge is kept
+    /// only if its target is not already reachable through an earlier successor
+    static std::vector<bool> transitive_reduction_mask(const std::vector<DenseEdge>& edges,
+                                                       const std::vector<bool>& candidates,
+                                                       const Adjacency& downstream,
+                                                       const std::vector<uint32_t>& order) {
+        const size_t count = downstream.offsets.size() - 1;
+        std::vector<uint32_t> rank(count);
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            rank[order[i]] = i;
+        }
         
-        state[job_id] = 2; // Mark as visited
-        return false;
+        // Candidate edge indices per source, sorted by target rank
+        std::vector<uint32_t> row_offsets(count + 1, 0);
+        for (size_t e = 0; e < edges.size(); ++e) {
+            if (candidates[e]) ++row_offsets[edges[e].from + 1];
+        }
+        for (size_t i = 1; i <= count; ++i) {
+            row_offsets[i] += row_offsets[i - 1];
+        }
+        std::vector<uint32_t> row_edges(row_offsets.back());
+        std::vector<uint32_t> cursor(row_offsets.begin(), row_offsets.end() - 1);
+        for (uint32_t e = 0; e < edges.size(); ++e) {
+            if (candidates[e]) row_edges[cursor[edges[e].from]++] = e;
+        }
+        for (size_t source = 0; source < count; ++source) {
+            std::sort(row_edges.begin() + row_offsets[source], row_edges.begin() + row_offsets[source + 1],
+                      [&](uint32_t a, uint32_t b) { return rank[edges[a].to] < rank[edges[b].to]; });
+        }
+        
+        // reach[u] = descendants of u as bits indexed by topological rank, filled
+        // in reverse topological order. Rows cover one block of ranks at a time
+        // so memory stays within budget; each edge is decided in the pass whose
+        // block contains its target. A successor already covered by a
+        // lower-ranked successor is redundant.
+        std::vector<bool> keep(edges.size(), false);
+        if (count == 0) {
+            return keep;
+        }
+        size_t block = std::max<size_t>(64, (kReductionBitsetBytes * 8 / count) / 64 * 64);
+        block = std::min(block, (count + 63) / 64 * 64);
+        const size_t words = block / 64;
+        std::vector<uint64_t> reach(count * words);
+        
+        for (size_t low = 0; low < count; low += block) {
+            const size_t high = std::min(count, low + block);
+            std::fill(reach.begin(), reach.end(), 0);
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                uint64_t* covered = &reach[size_t{*it} * words];
+                for (uint32_t i = row_offsets[*it]; i < row_offsets[*it + 1]; ++i) {
+                    uint32_t target = edges[row_edges[i]].to;
+                    size_t target_rank = rank[target];
+                    if (target_rank >= high) {
+                        break; // Rows are rank-sorted; later targets reach only higher ranks
+                    }
+                    if (target_rank >= low) {
+                        size_t bit = target_rank - low;
+                        if (covered[bit / 64] & (uint64_t{1} << (bit % 64))) {
+                            continue;
+                        }
+                        keep[row_edges[i]] = true;
+                        covered[bit / 64] |= uint64_t{1} << (bit % 64);
+                    }
+                    const uint64_t* below = &reach[size_t{target} * words];
+                    for (size_t w = 0; w < words; ++w) {
+                        covered[w] |= below[w];
+                    }
+                }
+            }
+        }
+        return keep;
+    }
+    
+    /// Build both CSR directions from dense edges with a stable counting sort
+    static void build_adjacency(Lookup& lookup, size_t index_count, const std::vector<DenseEdge>& edges) {
+        auto fill = [&](Adjacency& adjacency, bool by_target) {
+            adjacency.offsets.assign(index_count + 1, 0);
+            adjacency.targets.resize(edges.size());
+            for (const auto& edge : edges) {
+                ++adjacency.offsets[(by_target ? edge.to : edge.from) + 1];
+            }
+            for (size_t i = 1; i <= index_count; ++i) {
+                adjacency.offsets[i] += adjacency.offsets[i - 1];
+            }
+            std::vector<uint32_t> cursor(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+            for (const auto& edge : edges) {
+                uint32_t row = by_target ? edge.to : edge.from;
+                adjacency.targets[cursor[row]++] = by_target ? edge.from : edge.to;
+            }
+        };
+        fill(lookup.upstream, true);
+        fill(lookup.downstream, false);
+    }
+    
+    /// Intern node ids (last duplicate wins) and dependency endpoints
+    static Lookup build_lookup(const std::vector<JobNode>& nodes, const std::vector<JobDependency>& dependencies) {
+        std::vector<DenseEdge> edges;
+        return build_lookup(nodes, dependencies, edges);
     }
     
-    /// Build internal lookup structures after finalization
-    void build_lookup_structures() {
-        // Build dependency map for efficient lookups
-        for (const auto& dep : dependencies_) {
-            dependency_map_[dep.to()].push_back(dep.from());
-            dependent_map_[dep.from()].push_back(dep.to());
+    /// As above, also returning the dense edge list parallel to dependencies
+    static Lookup build_lookup(const std::vector<JobNode>& nodes, const std::vector<JobDependency>& dependencies,
+                               std::vector<DenseEdge>& edges) {
+        Lookup lookup;
+        lookup.index.reserve(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            lookup.index[nodes[i].id()] = static_cast<uint32_t>(i);
         }
         
-        // Build node index for efficient node lookups
-        for (size_t i = 0; i < nodes_.size(); ++i) {
-            node_index_[nodes_[i].id()] = i;
+        auto intern = [&](const JobId& id) {
+            auto [it, inserted] = lookup.index.try_emplace(
+                id, static_cast<uint32_t>(nodes.size() + lookup.external_ids.size()));
+            if (inserted) {
+                lookup.external_ids.push_back(id);
+            }
+            return it->second;
+        };
+        
+        edges.clear();
+        edges.reserve(dependencies.size());
+        for (const auto& dep : dependencies) {
+            uint32_t from = intern(dep.from());
+            uint32_t to = intern(dep.to());
+            edges.push_back(DenseEdge{from, to});
         }
+        build_adjacency(lookup, lookup.index_count(nodes.size()), edges);
+        return lookup;
     }
 };
 
-} // namespace nx::batchflow
\ No newline at end of file
+/// Implementation of JobGraph accessors
+inline JobGraph JobGraph::from_dense_edges(std::vector<JobNode> nodes, const std::vector<DenseEdge>& edges) {
+    JobGraph graph;
+    graph.nodes_ = std::move(nodes);
+    const size_t node_count = graph.nodes_.size();
+    
+    // Positions sharing a JobId collapse onto the last one, as in finalize()
+    Lookup lookup;
+    lookup.index.reserve(node_count);
+    for (size_t i = 0; i < node_count; ++i) {
+        lookup.index[graph.nodes_[i].id()] = static_cast<uint32_t>(i);
+    }
+    std::vector<uint32_t> canonical(node_count);
+    for (size_t i = 0; i < node_count; ++i) {
+        canonical[i] = lookup.index.at(graph.nodes_[i].id());
+    }
+    
+    std::vector<DenseEdge> dense;
+    dense.reserve(edges.size());
+    graph.dependencies_.reserve(edges.size());
+    for (const auto& edge : edges) {
+        if (edge.from >= node_count || edge.to >= node_count) {
+            throw std::invalid_argument("Dependency edge references node position out of range");
+        }
+        dense.push_back(DenseEdge{canonical[edge.from], canonical[edge.to]});
+        graph.dependencies_.emplace_back(graph.nodes_[edge.from].id(), graph.nodes_[edge.to].id());
+    }
+    
+    build_adjacency(lookup, node_count, dense);
+    if (!lookup.is_acyclic()) {
+        throw std::runtime_error("Graph contains cycles");
+    }
+    graph.lookup_ = std::move(lookup);
+    graph.finalized_ = true;
+    return graph;
+}
+
+inline GraphFinalizeReport JobGraph::finalize(const GraphFinalizeOptions& options) {
+    NX_PROFILE_ZONE("JobGraph::finalize");
+    GraphFinalizeReport report;
+    if (finalized_) {
+        return report; // Already finalized
+    }
+    
+    std::vector<JobDependency> dependencies = dependencies_;
+    if (options.infer_artifact_dependencies) {
+        auto inferred = infer_artifact_dependencies();
+        report.inferred_edges = inferred.size();
+        dependencies.insert(dependencies.end(), std::make_move_iterator(inferred.begin()),
+                            std::make_move_iterator(inferred.end()));
+    }
+    
+    std::vector<DenseEdge> edges;
+    Lookup lookup = build_lookup(nodes_, dependencies, edges);
+    auto order = topological_order(lookup.downstream);
+    if (order.size() != lookup.downstream.offsets.size() - 1) {
+        throw std::runtime_error("Graph contains cycles");
+    }
+    
+    if (options.deduplicate_edges || options.reduce_transitive_edges) {
+        auto keep = unique_edge_mask(edges);
+        size_t unique_count = static_cast<size_t>(std::count(keep.begin(), keep.end(), true));
+        report.duplicate_edges_removed = edges.size() - unique_count;
+        if (options.reduce_transitive_edges) {
+            keep = transitive_reduction_mask(edges, keep, lookup.downstream, order);
+            report.transitive_edges_removed =
+                unique_count - static_cast<size_t>(std::count(keep.begin(), keep.end(), true));
+        }
+        
+        std::vector<JobDependency> reduced;
+        std::vector<DenseEdge> reduced_edges;
+        for (size_t i = 0; i < edges.size(); ++i) {
+            if (keep[i]) {
+                reduced.push_back(std::move(dependencies[i]));
+                reduced_edges.push_back(edges[i]);
+            }
+        }
+        dependencies = std::move(reduced);
+        build_adjacency(lookup, lookup.index_count(nodes_.size()), reduced_edges);
+    }
+    
+    dependencies_ = std::move(dependencies);
+    lookup_ = std::move(lookup);
+    finalized_ = true;
+    return report;
+}
+
+inline const std::vector<JobDependency>& JobGraph::dependencies() const {
+    if (!finalized_) {
+        throw std::runtime_error("Graph must be finalized before accessing dependencies");
+    }
+    return dependencies_;
+}
+
+inline std::vector<JobId> JobGraph::get_dependents(const JobId& job_id) const {
+    if (!finalized_) {
+        throw std::runtime_error("Graph must be finalized before accessing dependents");
+    }
+    return lookup_.ids_in_row(nodes_, lookup_.downstream, job_id);
+}
+
+inline bool JobGraph::is_acyclic() const {
+    if (finalized_) {
+        return true; // Checked by finalize()
+    }
+    return build_lookup(nodes_, dependencies_).is_acyclic();
+}
+
+} // namespace nx::batchflow
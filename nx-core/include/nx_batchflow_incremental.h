@@ -0,0 +1,210 @@
+#pragma once
+
+#include "nx_batchflow_preset.h"
+#include "nx_batchflow_dag.h"
+#include "nx_batchflow_scheduler.h"
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace nx::batchflow {
+
+/// IncrementalPlan is the minimal re-execution set between two graph revisions
+/// Pure data structure - all lists ordered by JobId for determinism
+struct IncrementalPlan {
+    std::vector<JobId> changed_jobs;                // New in revision, or upstream set changed
+    std::vector<JobId> reexecute_jobs;              // Changed jobs plus transitive downstream closure
+    std::vector<JobId> reused_jobs;                 // Revision jobs outside the closure
+    std::vector<JobId> removed_jobs;                // Jobs only present in the previous revision
+    std::map<JobId, JobStatus> carried_outcomes;    // Prior Completed status of every reused job
+
+    /// Check whether a revision job must run again
+    bool requires_reexecution(const JobId& job_id) const {
+        return std::binary_search(reexecute_jobs.begin(), reexecute_jobs.end(), job_id);
+    }
+
+    /// Seed a scheduler over the revised graph with carried outcomes
+    /// Uses clockless replay transitions, so only reexecute_jobs remain Pending
+    /// Scheduler must be freshly constructed (all jobs Pending)
+    void apply_to(BatchFlowScheduler& scheduler) const {
+        for (const auto& [job_id, status] : carried_outcomes) {
+            scheduler.replay_start_job(job_id, status.started_tick);
+            scheduler.replay_mark_completed(job_id, status.finished_tick);
+        }
+    }
+};
+
+/// IncrementalPlanner computes what must re-run after a preset or graph edit
+/// Pure functions - no state, no side effects
+///
+/// Node identity is content-hashed, so a JobId present in both revisions has
+/// identical engine, operation, parameters and artifacts. A job is changed when
+/// it is new, or when its set of upstream JobIds differs. Every job reachable
+/// downstream of a changed job is re-executed; all other jobs are reused.
+class IncrementalPlanner {
+public:
+    /// Plan re-execution between two finalized graphs
+    /// Without prior outcomes the plan is purely structural
+    /// With prior outcomes, reused jobs lacking a Completed outcome are also
+    /// re-executed (together with their downstream closure)
+    static IncrementalPlan plan(const JobGraph& previous,
+                                const JobGraph& revised,
+                                const std::map<JobId, JobStatus>* prior_outcomes = nullptr);
+
+    /// Names of preset jobs affected by an edit, including downstream closure
+    /// A job is affected when added, when its definition or retry policy
+    /// changed, when its incoming dependencies changed, or when it depends
+    /// (transitively) on an affected job in the revised preset
+    static std::set<std::string> affected_jobs(const BatchFlowPreset& previous,
+                                               const BatchFlowPreset& revised);
+
+private:
+    /// Sorted upstream JobIds of a job in a finalized graph
+    static std::vector<JobId> sorted_dependencies(const JobGraph& graph, const JobId& job_id) {
+        auto deps = graph.get_dependencies(job_id);
+        std::sort(deps.begin(), deps.end());
+        return deps;
+    }
+
+    /// Breadth-first downstream closure over the revised graph
+    static std::set<JobId> downstream_closure(const JobGraph& graph, const std::set<JobId>& seeds);
+};
+
+/// Implementation of IncrementalPlanner methods
+inline IncrementalPlan IncrementalPlanner::plan(const JobGraph& previous,
+                                                const JobGraph& revised,
+                                                const std::map<JobId, JobStatus>* prior_outcomes) {
+    IncrementalPlan plan;
+    std::set<JobId> seeds;
+
+    for (const auto& node : revised.nodes()) {
+        const JobId& job_id = node.id();
+        if (previous.get_node(job_id) == nullptr ||
+            sorted_dependencies(previous, job_id) != sorted_dependencies(revised, job_id)) {
+            plan.changed_jobs.push_back(job_id);
+            seeds.insert(job_id);
+            continue;
+        }
+
+        if (prior_outcomes != nullptr) {
+            auto it = prior_outcomes->find(job_id);
+            if (it == prior_outcomes->end() || it->second.state != JobState::Completed) {
+                seeds.insert(job_id);
+            }
+        }
+    }
+
+    for (const auto& node : previous.nodes()) {
+        if (revised.get_node(node.id()) == nullptr) {
+            plan.removed_jobs.push_back(node.id());
+        }
+    }
+
+    std::set<JobId> closure = downstream_closure(revised, seeds);
+
+    for (const auto& node : revised.nodes()) {
+        const JobId& job_id = node.id();
+        if (closure.count(job_id) > 0) {
+            plan.reexecute_jobs.push_back(job_id);
+            continue;
+        }
+        plan.reused_jobs.push_back(job_id);
+        if (prior_outcomes != nullptr) {
+            plan.carried_outcomes.emplace(job_id, prior_outcomes->at(job_id));
+        }
+    }
+
+    std::sort(plan.changed_jobs.begin(), plan.changed_jobs.end());
+    std::sort(plan.reexecute_jobs.begin(), plan.reexecute_jobs.end());
+    std::sort(plan.reused_jobs.begin(), plan.reused_jobs.end());
+    std::sort(plan.removed_jobs.begin(), plan.removed_jobs.end());
+
+    return plan;
+}
+
+inline std::set<JobId> IncrementalPlanner::downstream_closure(const JobGraph& graph,
+                                                              const std::set<JobId>& seeds) {
+    std::set<JobId> closure(seeds.begin(), seeds.end());
+    std::deque<JobId> frontier(seeds.begin(), seeds.end());
+
+    while (!frontier.empty()) {
+        JobId current = frontier.front();
+        frontier.pop_front();
+        for (const auto& dependent : graph.get_dependents(current)) {
+            if (closure.insert(dependent).second) {
+                frontier.push_back(dependent);
+            }
+        }
+    }
+
+    return closure;
+}
+
+inline std::set<std::string> IncrementalPlanner::affected_jobs(const BatchFlowPreset& previous,
+                                                              const BatchFlowPreset& revised) {
+    // Incoming edges per job, for both revisions
+    std::map<std::string, std::set<std::string>> previous_upstream;
+    std::map<std::string, std::set<std::string>> revised_upstream;
+    std::map<std::string, std::vector<std::string>> revised_downstream;
+
+    for (const auto& dep : previous.dependencies()) {
+        previous_upstream[dep.to_job].insert(dep.from_job);
+    }
+    for (const auto& dep : revised.dependencies()) {
+        revised_upstream[dep.to_job].insert(dep.from_job);
+        revised_downstream[dep.from_job].push_back(dep.to_job);
+    }
+
+    static const std::set<std::string> no_upstream;
+    auto upstream_of = [](const std::map<std::string, std::set<std::string>>& edges,
+                          const std::string& name) -> const std::set<std::string>& {
+        auto it = edges.find(name);
+        return it != edges.end() ? it->second : no_upstream;
+    };
+
+    std::set<std::string> affected;
+    std::deque<std::string> frontier;
+
+    for (const auto& [name, job] : revised.jobs()) {
+        auto prev_it = previous.jobs().find(name);
+        bool changed = prev_it == previous.jobs().end() || !(prev_it->second == job);
+
+        if (!changed) {
+            auto prev_policy = previous.retry_policies().find(name);
+            auto next_policy = revised.retry_policies().find(name);
+            bool prev_has = prev_policy != previous.retry_policies().end();
+            bool next_has = next_policy != revised.retry_policies().end();
+            changed = prev_has != next_has || (prev_has && !(prev_policy->second == next_policy->second));
+        }
+
+        if (!changed) {
+            changed = upstream_of(previous_upstream, name) != upstream_of(revised_upstream, name);
+        }
+
+        if (changed) {
+            affected.insert(name);
+            frontier.push_back(name);
+        }
+    }
+
+    while (!frontier.empty()) {
+        std::string current = frontier.front();
+        frontier.pop_front();
+        auto it = revised_downstream.find(current);
+        if (it == revised_downstream.end()) {
+            continue;
+        }
+        for (const auto& dependent : it->second) {
+            if (revised.jobs().count(dependent) > 0 && affected.insert(dependent).second) {
+                frontier.push_back(dependent);
+            }
+        }
+    }
+
+    return affected;
+}
+
+} // namespace nx::batchflow
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
+#include "nx_profile.h"
 
 namespace nx::batchflow {
 
@@ -126,6 +127,7 @@ inline JobId JobId::from_job_definition(const JobDefinition& definition) {
 
 /// Implementation of JobIdHasher methods
 inline JobId JobIdHasher::compute_job_id(const JobDefinition& definition) {
+    NX_PROFILE_ZONE("JobIdHasher::compute_job_id");
     // Create canonical string representation
     std::string canonical = canonicalize_job_definition(definition);
     
@@ -189,8 +191,10 @@ inline std::string JobIdHasher::sha256_hash(const std::string& input) {
         0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
     };
     
-    // Convert input to bytes
-    std::vector<uint8_t> data(input.begin(), input.end());
+    // Convert input to bytes (padding adds at most 72 bytes)
+    std::vector<uint8_t> data;
+    data.reserve(input.size() + 72);
+    data.assign(input.begin(), input.end());
     
     // Pre-processing: adding padding bits
     uint64_t original_length = data.size() * 8;
@@ -261,13 +265,16 @@ inline std::string JobIdHasher::sha256_hash(const std::string& input) {
         h[4] += e; h[5] += f; h[6] += g; h[7] += h_temp;
     }
     
-    // Convert hash to hex string
-    std::ostringstream result;
+    // Convert hash to lowercase hex string
+    static const char kHexDigits[] = "0123456789abcdef";
+    std::string result(64, '0');
     for (int i = 0; i < 8; ++i) {
-        result << std::hex << std::setfill('0') << std::setw(8) << h[i];
+        for (int nibble = 0; nibble < 8; ++nibble) {
+            result[i * 8 + nibble] = kHexDigits[(h[i] >> (28 - nibble * 4)) & 0xF];
+        }
     }
     
-    return result.str();
+    return result;
 }
 
 } // namespace nx::batchflow
\ No newline at end of file
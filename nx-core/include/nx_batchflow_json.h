@@ -0,0 +1,413 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nx::batchflow {
+
+/// JsonParseError reports malformed JSON with the byte offset of the failure
+class JsonParseError : public std::runtime_error {
+public:
+    JsonParseError(const std::string& message, size_t offset)
+        : std::runtime_error("JSON parse error at offset " + std::to_string(offset) + ": " + message)
+        , offset_(offset) {}
+
+    /// Byte offset into the input where parsing failed
+    size_t offset() const noexcept { return offset_; }
+
+private:
+    size_t offset_;
+};
+
+/// String escaping dialects
+/// All escape '"' and '\\' and use the short forms \n, \r and \t; bytes >= 0x80
+/// are copied verbatim (UTF-8 passes through)
+/// - Canonical: \b and \f short, other bytes below 0x20 as \u00xx (JsonWriter)
+/// - Unicode: every other byte below 0x20 as \u00xx; output never spans lines
+/// - Legacy: \b and \f short, other control bytes copied verbatim
+enum class JsonEscape {
+    Canonical,
+    Unicode,
+    Legacy
+};
+
+/// Append value with JSON string escaping (no surrounding quotes)
+/// Scans 32 (AVX2) or 16 (SSE2/NEON) bytes at a time for bytes that need
+/// escaping and copies clean runs in one append; scalar elsewhere
+void append_json_escaped(std::string& out, std::string_view value, JsonEscape escape = JsonEscape::Canonical);
+
+/// JsonWriter emits canonical JSON directly into a caller-owned string
+/// Canonical form: no insignificant whitespace, minimal escaping, caller-defined key order
+/// Streaming only - no document tree is built
+class JsonWriter {
+public:
+    /// Append to out; out is not cleared
+    explicit JsonWriter(std::string& out) : out_(out) { scopes_.reserve(8); }
+
+    void begin_object() { before_value(); out_.push_back('{'); scopes_.push_back(false); }
+    void end_object() { scopes_.pop_back(); out_.push_back('}'); }
+    void begin_array() { before_value(); out_.push_back('['); scopes_.push_back(false); }
+    void end_array() { scopes_.pop_back(); out_.push_back(']'); }
+
+    /// Write object key; next call must write its value
+    void key(std::string_view name) {
+        before_value();
+        write_string(name);
+        out_.push_back(':');
+        after_key_ = true;
+    }
+
+    void value(std::string_view text) { before_value(); write_string(text); }
+    void value(const char* text) { value(std::string_view(text)); }
+    void value(uint64_t number) { before_value(); out_.append(std::to_string(number)); }
+    void value(bool flag) { before_value(); out_.append(flag ? "true" : "false"); }
+
+    /// Write an already-encoded JSON value verbatim (e.g. a fixed-point decimal)
+    void raw_value(std::string_view json) { before_value(); out_.append(json); }
+
+private:
+    std::string& out_;
+    std::vector<bool> scopes_;  // Per open container: has at least one element
+    bool after_key_ = false;
+
+    /// Emit element separator when needed
+    void before_value() {
+        if (after_key_) {
+            after_key_ = false;
+            return;
+        }
+        if (!scopes_.empty()) {
+            if (scopes_.back()) {
+                out_.push_back(',');
+            }
+            scopes_.back() = true;
+        }
+    }
+
+    /// Quote and escape string
+    void write_string(std::string_view text) {
+        out_.push_back('"');
+        append_json_escaped(out_, text, JsonEscape::Canonical);
+        out_.push_back('"');
+    }
+};
+
+/// JsonReader is a streaming pull parser over an in-memory buffer
+/// Events are consumed in document order; no document tree is built
+/// Strings without escapes are returned as views into the input (zero-copy);
+/// escaped strings are decoded into a reused scratch buffer
+/// Returned views are valid until the next read call
+class JsonReader {
+public:
+    /// Input must outlive the reader
+    explicit JsonReader(std::string_view input) : input_(input) { scopes_.reserve(8); }
+
+    /// Consume '{'
+    void begin_object() { consume_value_start('{'); scopes_.push_back(false); }
+
+    /// Advance to next key in current object
+    /// Returns false (and consumes '}') when the object ends
+    bool next_key(std::string_view& key) {
+        if (!next_element('}')) {
+            return false;
+        }
+        key = parse_string();
+        skip_whitespace();
+        expect(':');
+        after_key_ = true;
+        return true;
+    }
+
+    /// Consume '['
+    void begin_array() { consume_value_start('['); scopes_.push_back(false); }
+
+    /// Advance to next array element
+    /// Returns false (and consumes ']') when the array ends
+    bool next_element() { return next_element(']'); }
+
+    /// Read string value
+    std::string_view read_string() {
+        consume_value_start('"', false);
+        return parse_string();
+    }
+
+    /// Read non-negative integer value
+    uint64_t read_uint() {
+        consume_value_start(0, false);
+        size_t start = pos_;
+        uint64_t value = 0;
+        while (pos_ < input_.size() && input_[pos_] >= '0' && input_[pos_] <= '9') {
+            uint64_t digit = static_cast<uint64_t>(input_[pos_] - '0');
+            if (value > (UINT64_MAX - digit) / 10) {
+                fail("integer overflow");
+            }
+            value = value * 10 + digit;
+            ++pos_;
+        }
+        if (pos_ == start) {
+            fail("expected non-negative integer");
+        }
+        return value;
+    }
+
+    /// Read boolean value
+    bool read_bool() {
+        consume_value_start(0, false);
+        if (match_literal("true")) return true;
+        if (match_literal("false")) return false;
+        fail("expected boolean");
+    }
+
+    /// Skip one complete value of any type (used for unknown keys)
+    void skip_value() {
+        consume_value_start(0, false);
+        skip_value_body();
+    }
+
+    /// Require that only whitespace remains
+    void expect_end() {
+        skip_whitespace();
+        if (pos_ != input_.size()) {
+            fail("unexpected trailing content");
+        }
+    }
+
+    /// Current byte offset
+    size_t offset() const noexcept { return pos_; }
+
+    /// Throw JsonParseError at current offset
+    [[noreturn]] void fail(const std::string& message) const {
+        throw JsonParseError(message, pos_);
+    }
+
+private:
+    std::string_view input_;
+    size_t pos_ = 0;
+    std::vector<bool> scopes_;  // Per open container: has at least one element
+    bool after_key_ = false;
+    std::string scratch_;       // Reused buffer for escaped strings
+
+    void skip_whitespace() {
+        while (pos_ < input_.size()) {
+            char c = input_[pos_];
+            if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                return;
+            }
+            ++pos_;
+        }
+    }
+
+    void expect(char c) {
+        if (pos_ >= input_.size() || input_[pos_] != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        ++pos_;
+    }
+
+    bool match_literal(std::string_view literal) {
+        if (input_.substr(pos_, literal.size()) == literal) {
+            pos_ += literal.size();
+            return true;
+        }
+        return false;
+    }
+
+    /// Handle separators before a value; optionally consume an opening char
+    void consume_value_start(char opening, bool consume = true) {
+        if (after_key_) {
+            after_key_ = false;
+        } else if (!scopes_.empty()) {
+            // Value read without next_element()/next_key() - caller error
+            fail("value outside element position");
+        }
+        skip_whitespace();
+        if (opening != 0) {
+            if (pos_ >= input_.size() || input_[pos_] != opening) {
+                fail(std::string("expected '") + opening + "'");
+            }
+            if (consume) {
+                ++pos_;
+            }
+        }
+    }
+
+    bool next_element(char closing) {
+        if (scopes_.empty()) {
+            fail("no open container");
+        }
+        skip_whitespace();
+        if (pos_ < input_.size() && input_[pos_] == closing) {
+            ++pos_;
+            scopes_.pop_back();
+            return false;
+        }
+        if (scopes_.back()) {
+            expect(',');
+            skip_whitespace();
+        } else {
+            scopes_.back() = true;
+        }
+        // Element position reached; allow exactly one value read
+        after_key_ = closing == ']';
+        return true;
+    }
+
+    /// Parse string at current position (opening quote not yet consumed)
+    std::string_view parse_string() {
+        expect('"');
+        size_t start = pos_;
+
+        // Fast path: scan for terminator without escapes
+        while (pos_ < input_.size()) {
+            unsigned char c = static_cast<unsigned char>(input_[pos_]);
+            if (c == '"') {
+                return input_.substr(start, pos_++ - start);
+            }
+            if (c == '\\') {
+                break;
+            }
+            if (c < 0x20) {
+                fail("control character in string");
+            }
+            ++pos_;
+        }
+
+        // Slow path: decode escapes into scratch buffer
+        scratch_.assign(input_.data() + start, pos_ - start);
+        while (pos_ < input_.size()) {
+            // Copy unescaped run in bulk
+            size_t run_start = pos_;
+            while (pos_ < input_.size()) {
+                unsigned char c = static_cast<unsigned char>(input_[pos_]);
+                if (c == '"' || c == '\\') {
+                    break;
+                }
+                if (c < 0x20) {
+                    fail("control character in string");
+                }
+                ++pos_;
+            }
+            scratch_.append(input_.data() + run_start, pos_ - run_start);
+            if (pos_ >= input_.size()) {
+                break;
+            }
+            if (input_[pos_++] == '"') {
+                return scratch_;
+            }
+            if (pos_ >= input_.size()) {
+                break;
+            }
+            char escape = input_[pos_++];
+            switch (escape) {
+                case '"':  scratch_.push_back('"'); break;
+                case '\\': scratch_.push_back('\\'); break;
+                case '/':  scratch_.push_back('/'); break;
+                case 'b':  scratch_.push_back('\b'); break;
+                case 'f':  scratch_.push_back('\f'); break;
+                case 'n':  scratch_.push_back('\n'); break;
+                case 'r':  scratch_.push_back('\r'); break;
+                case 't':  scratch_.push_back('\t'); break;
+                case 'u':  append_code_point(parse_unicode_escape()); break;
+                default:   fail("invalid escape sequence");
+            }
+        }
+        fail("unterminated string");
+    }
+
+    uint32_t parse_hex4() {
+        if (pos_ + 4 > input_.size()) {
+            fail("truncated unicode escape");
+        }
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = input_[pos_++];
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= static_cast<uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') value |= static_cast<uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') value |= static_cast<uint32_t>(c - 'A' + 10);
+            else fail("invalid unicode escape");
+        }
+        return value;
+    }
+
+    uint32_t parse_unicode_escape() {
+        uint32_t code = parse_hex4();
+        if (code >= 0xD800 && code <= 0xDBFF) {
+            if (!match_literal("\\u")) {
+                fail("unpaired surrogate");
+            }
+            uint32_t low = parse_hex4();
+            if (low < 0xDC00 || low > 0xDFFF) {
+                fail("invalid surrogate pair");
+            }
+            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+        } else if (code >= 0xDC00 && code <= 0xDFFF) {
+            fail("unpaired surrogate");
+        }
+        return code;
+    }
+
+    void append_code_point(uint32_t code) {
+        if (code < 0x80) {
+            scratch_.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            scratch_.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            scratch_.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            scratch_.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            scratch_.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            scratch_.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            scratch_.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            scratch_.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            scratch_.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            scratch_.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    /// Skip value at current position (separators already handled)
+    void skip_value_body() {
+        if (pos_ >= input_.size()) {
+            fail("unexpected end of input");
+        }
+        char c = input_[pos_];
+        if (c == '"') {
+            parse_string();
+        } else if (c == '{' || c == '[') {
+            // Iterative depth tracking; strings skipped so brackets inside them are ignored
+            size_t depth = 0;
+            do {
+                skip_whitespace();
+                if (pos_ >= input_.size()) {
+                    fail("unexpected end of input");
+                }
+                char current = input_[pos_];
+                if (current == '"') {
+                    parse_string();
+                } else {
+                    if (current == '{' || current == '[') ++depth;
+                    else if (current == '}' || current == ']') --depth;
+                    ++pos_;
+                }
+            } while (depth > 0);
+        } else if (match_literal("true") || match_literal("false") || match_literal("null")) {
+            // Literal consumed
+        } else {
+            size_t start = pos_;
+            while (pos_ < input_.size() && input_[pos_] != '\0' &&
+                   std::strchr("+-0123456789.eE", input_[pos_]) != nullptr) {
+                ++pos_;
+            }
+            if (pos_ == start) {
+                fail("unexpected character");
+            }
+        }
+    }
+};
+
+} // namespace nx::batchflow
@@ -2,11 +2,19 @@
 
 #include "nx_batchflow_jobid.h"
 #include "nx_batchflow_retry_policy.h"
+#include "nx_batchflow_json.h"
 #include <string>
 #include <vector>
 #include <map>
 #include <set>
 #include <sstream>
+#include <optional>
+#include <stdexcept>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <algorithm>
 
 namespace nx::batchflow {
 
@@ -136,6 +144,49 @@ struct PresetRetryPolicy {
     }
 };
 
+/// PresetValidationMemo caches the validation result of one preset
+/// Copies carry the cached result; BatchFlowPreset mutators reset it
+class PresetValidationMemo {
+public:
+    PresetValidationMemo() = default;
+    
+    PresetValidationMemo(const PresetValidationMemo& other) : errors_(other.snapshot()) {}
+    
+    PresetValidationMemo& operator=(const PresetValidationMemo& other) {
+        if (this != &other) {
+            auto errors = other.snapshot();
+            std::lock_guard<std::mutex> lock(mutex_);
+            errors_ = std::move(errors);
+        }
+        return *this;
+    }
+    
+    /// Get cached errors, computing them on first use
+    template <typename Compute>
+    const std::vector<std::string>& get(Compute&& compute) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!errors_) {
+            errors_ = compute();
+        }
+        return *errors_;
+    }
+    
+    /// Drop cached result after mutation
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        errors_.reset();
+    }
+
+private:
+    std::optional<std::vector<std::string>> snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return errors_;
+    }
+    
+    mutable std::mutex mutex_;
+    mutable std::optional<std::vector<std::string>> errors_;
+};
+
 /// BatchFlowPreset represents complete workflow definition
 /// Pure data structure - immutable at runtime, no logic, no conditionals
 class BatchFlowPreset {
@@ -180,10 +231,14 @@ public:
     static BatchFlowPreset from_json(const std::string& json_str);
     
     /// Validate preset structure and consistency
-    std::vector<std::string> validate() const;
+    /// Result is computed once and memoized until the preset is modified
+    std::vector<std::string> validate() const { return validation_errors(); }
+    
+    /// Memoized validation errors (reference valid until next mutation)
+    const std::vector<std::string>& validation_errors() const;
     
     /// Check if preset is valid (no validation errors)
-    bool is_valid() const { return validate().empty(); }
+    bool is_valid() const { return validation_errors().empty(); }
     
     /// Generate diff between two presets
     std::vector<std::string> diff(const BatchFlowPreset& other) const;
@@ -198,12 +253,19 @@ private:
     std::map<std::string, PresetJobDefinition> jobs_;         // Job definitions (ordered)
     std::set<PresetDependency> dependencies_;                  // Dependencies (ordered)
     std::map<std::string, PresetRetryPolicy> retry_policies_; // Retry policies (ordered)
+    PresetValidationMemo validation_;                          // Memoized validate() result
 };
 
 /// PresetValidator provides validation logic for preset consistency
 /// Pure validation functions - no state, no side effects
 class PresetValidator {
 public:
+    /// Validate whole preset in one pass
+    /// Job names are interned once and shared by all checks. Errors are ordered:
+    /// version, jobs (by name), dependency references (by dependency order),
+    /// dependency cycles (by smallest member name), retry policies (by job name)
+    static std::vector<std::string> validate(const BatchFlowPreset& preset);
+    
     /// Validate job definitions for consistency
     static std::vector<std::string> validate_jobs(const std::map<std::string, PresetJobDefinition>& jobs);
     
@@ -221,48 +283,51 @@ public:
     static std::vector<std::string> validate_version(const PresetVersion& version);
 
 private:
-    /// Check for dependency cycles using DFS
-    static bool has_dependency_cycle(const std::set<PresetDependency>& dependencies);
+    struct JobIndex;
+    
+    /// Dependency adjacency over interned job indices (CSR)
+    struct Adjacency {
+        std::vector<uint32_t> offsets;  // Size job_count + 1
+        std::vector<uint32_t> targets;  // Sorted within each row
+    };
     
     /// Validate individual job definition
     static std::vector<std::string> validate_job(const PresetJobDefinition& job);
+    
+    static void append_job_errors(const std::map<std::string, PresetJobDefinition>& jobs,
+                                  std::vector<std::string>& errors);
+    static void append_dependency_errors(const JobIndex& index,
+                                         const std::set<PresetDependency>& dependencies,
+                                         std::vector<std::string>& errors);
+    static void append_retry_policy_errors(const JobIndex& index,
+                                           const std::map<std::string, PresetRetryPolicy>& policies,
+                                           std::vector<std::string>& errors);
+    
+    /// Strongly connected components that contain a cycle, members sorted,
+    /// components ordered by smallest member (iterative Tarjan, O(V + E))
+    static std::vector<std::vector<uint32_t>> find_cycles(const Adjacency& adjacency);
 };
 
 /// Implementation of key methods
 inline void BatchFlowPreset::add_job(PresetJobDefinition job) {
     std::string job_name = job.job_name;
     jobs_[job_name] = std::move(job);
+    validation_.reset();
 }
 
 inline void BatchFlowPreset::add_dependency(PresetDependency dependency) {
     dependencies_.insert(std::move(dependency));
+    validation_.reset();
 }
 
 inline void BatchFlowPreset::add_retry_policy(PresetRetryPolicy policy) {
     std::string job_name = policy.job_name;
     retry_policies_[job_name] = std::move(policy);
+    validation_.reset();
 }
 
-inline std::vector<std::string> BatchFlowPreset::validate() const {
-    std::vector<std::string> errors;
-    
-    // Validate version
-    auto version_errors = PresetValidator::validate_version(version_);
-    errors.insert(errors.end(), version_errors.begin(), version_errors.end());
-    
-    // Validate jobs
-    auto job_errors = PresetValidator::validate_jobs(jobs_);
-    errors.insert(errors.end(), job_errors.begin(), job_errors.end());
-    
-    // Validate dependencies
-    auto dep_errors = PresetValidator::validate_dependencies(jobs_, dependencies_);
-    errors.insert(errors.end(), dep_errors.begin(), dep_errors.end());
-    
-    // Validate retry policies
-    auto retry_errors = PresetValidator::validate_retry_policies(jobs_, retry_policies_);
-    errors.insert(errors.end(), retry_errors.begin(), retry_errors.end());
-    
-    return errors;
+inline const std::vector<std::string>& BatchFlowPreset::validation_errors() const {
+    return validation_.get([this]() { return PresetValidator::validate(*this); });
 }
 
 inline bool BatchFlowPreset::operator==(const BatchFlowPreset& other) const {
@@ -274,6 +339,572 @@ inline bool BatchFlowPreset::operator==(const BatchFlowPreset& other) const {
            retry_policies_ == other.retry_policies_;
 }
 
+inline std::vector<std::string> BatchFlowPreset::diff(const BatchFlowPreset& other) const {
+    // Differences read as "this -> other", in deterministic container order
+    std::vector<std::string> differences;
+    
+    if (!(version_ == other.version_)) {
+        differences.push_back("Version changed: " + version_.to_string() + " -> " + other.version_.to_string());
+    }
+    if (preset_name_ != other.preset_name_) {
+        differences.push_back("Name changed: " + preset_name_ + " -> " + other.preset_name_);
+    }
+    if (description_ != other.description_) {
+        differences.push_back("Description changed");
+    }
+    
+    for (const auto& [name, job] : jobs_) {
+        auto it = other.jobs_.find(name);
+        if (it == other.jobs_.end()) {
+            differences.push_back("Job removed: " + name);
+            continue;
+        }
+        const auto& revised = it->second;
+        std::vector<std::string> fields;
+        if (job.engine_identifier != revised.engine_identifier) fields.push_back("engine_identifier");
+        if (job.api_operation != revised.api_operation) fields.push_back("api_operation");
+        if (job.parameters_blob != revised.parameters_blob) fields.push_back("parameters_blob");
+        if (job.input_artifacts != revised.input_artifacts) fields.push_back("input_artifacts");
+        if (job.output_artifacts != revised.output_artifacts) fields.push_back("output_artifacts");
+        if (!fields.empty()) {
+            std::string line = "Job modified: " + name + " (";
+            for (size_t i = 0; i < fields.size(); ++i) {
+                if (i > 0) line += ", ";
+                line += fields[i];
+            }
+            differences.push_back(line + ")");
+        }
+    }
+    for (const auto& [name, job] : other.jobs_) {
+        if (jobs_.find(name) == jobs_.end()) {
+            differences.push_back("Job added: " + name);
+        }
+    }
+    
+    for (const auto& dep : dependencies_) {
+        if (other.dependencies_.find(dep) == other.dependencies_.end()) {
+            differences.push_back("Dependency removed: " + dep.from_job + " -> " + dep.to_job);
+        }
+    }
+    for (const auto& dep : other.dependencies_) {
+        if (dependencies_.find(dep) == dependencies_.end()) {
+            differences.push_back("Dependency added: " + dep.from_job + " -> " + dep.to_job);
+        }
+    }
+    
+    for (const auto& [name, policy] : retry_policies_) {
+        auto it = other.retry_policies_.find(name);
+        if (it == other.retry_policies_.end()) {
+            differences.push_back("Retry policy removed: " + name);
+        } else if (!(policy == it->second)) {
+            differences.push_back("Retry policy modified: " + name);
+        }
+    }
+    for (const auto& [name, policy] : other.retry_policies_) {
+        if (retry_policies_.find(name) == retry_policies_.end()) {
+            differences.push_back("Retry policy added: " + name);
+        }
+    }
+    
+    return differences;
+}
+
+inline PresetVersion PresetVersion::from_string(const std::string& version_str) {
+    uint32_t parts[3] = {0, 0, 0};
+    size_t part = 0;
+    bool has_digit = false;
+    
+    for (char c : version_str) {
+        if (c >= '0' && c <= '9') {
+            uint64_t next = static_cast<uint64_t>(parts[part]) * 10 + static_cast<uint32_t>(c - '0');
+            if (next > UINT32_MAX) {
+                throw std::invalid_argument("Invalid preset version: " + version_str);
+            }
+            parts[part] = static_cast<uint32_t>(next);
+            has_digit = true;
+        } else if (c == '.' && has_digit && part < 2) {
+            ++part;
+            has_digit = false;
+        } else {
+            throw std::invalid_argument("Invalid preset version: " + version_str);
+        }
+    }
+    
+    if (part != 2 || !has_digit) {
+        throw std::invalid_argument("Invalid preset version: " + version_str);
+    }
+    return PresetVersion(parts[0], parts[1], parts[2]);
+}
+
+/// Canonical JSON layout (keys in fixed order, containers in deterministic order):
+/// {"version","name","description","jobs":[...],"dependencies":[...],"retry_policies":[...]}
+/// Identical presets always serialize to identical bytes
+inline std::string BatchFlowPreset::to_json() const {
+    // Size estimate avoids repeated growth for large presets
+    size_t estimate = 128 + preset_name_.size() + description_.size();
+    for (const auto& [name, job] : jobs_) {
+        estimate += 160 + name.size() + job.engine_identifier.size() +
+                    job.api_operation.size() + job.parameters_blob.size();
+        for (const auto& artifact : job.input_artifacts) estimate += artifact.size() + 3;
+        for (const auto& artifact : job.output_artifacts) estimate += artifact.size() + 3;
+    }
+    for (const auto& dep : dependencies_) {
+        estimate += 32 + dep.from_job.size() + dep.to_job.size();
+    }
+    estimate += retry_policies_.size() * 128;
+    
+    std::string out;
+    out.reserve(estimate);
+    JsonWriter writer(out);
+    
+    auto write_string_array = [&writer](const auto& values) {
+        writer.begin_array();
+        for (const auto& value : values) {
+            writer.value(std::string_view(value));
+        }
+        writer.end_array();
+    };
+    
+    writer.begin_object();
+    writer.key("version");
+    writer.value(version_.to_string());
+    writer.key("name");
+    writer.value(preset_name_);
+    writer.key("description");
+    writer.value(description_);
+    
+    writer.key("jobs");
+    writer.begin_array();
+    for (const auto& [name, job] : jobs_) {
+        writer.begin_object();
+        writer.key("job_name");
+        writer.value(job.job_name);
+        writer.key("engine_identifier");
+        writer.value(job.engine_identifier);
+        writer.key("api_operation");
+        writer.value(job.api_operation);
+        writer.key("parameters_blob");
+        writer.value(job.parameters_blob);
+        writer.key("input_artifacts");
+        write_string_array(job.input_artifacts);
+        writer.key("output_artifacts");
+        write_string_array(job.output_artifacts);
+        writer.end_object();
+    }
+    writer.end_array();
+    
+    writer.key("dependencies");
+    writer.begin_array();
+    for (const auto& dep : dependencies_) {
+        writer.begin_object();
+        writer.key("from_job");
+        writer.value(dep.from_job);
+        writer.key("to_job");
+        writer.value(dep.to_job);
+        writer.end_object();
+    }
+    writer.end_array();
+    
+    writer.key("retry_policies");
+    writer.begin_array();
+    for (const auto& [name, policy] : retry_policies_) {
+        writer.begin_object();
+        writer.key("job_name");
+        writer.value(policy.job_name);
+        writer.key("max_attempts");
+        writer.value(static_cast<uint64_t>(policy.max_attempts));
+        writer.key("retry_delay_ticks");
+        writer.value(static_cast<uint64_t>(policy.retry_delay_ticks));
+        writer.key("retry_on_states");
+        write_string_array(policy.retry_on_states);
+        writer.end_object();
+    }
+    writer.end_array();
+    
+    writer.end_object();
+    return out;
+}
+
+/// Streaming decode - no intermediate document tree
+/// Key order is not significant on input; unknown keys are skipped
+/// Throws JsonParseError on malformed input or missing required fields
+inline BatchFlowPreset BatchFlowPreset::from_json(const std::string& json_str) {
+    JsonReader reader(json_str);
+    std::string_view key;
+    
+    auto read_uint32 = [&reader]() {
+        uint64_t value = reader.read_uint();
+        if (value > UINT32_MAX) {
+            reader.fail("value exceeds 32-bit range");
+        }
+        return static_cast<uint32_t>(value);
+    };
+    
+    auto read_string_array = [&reader]() {
+        std::vector<std::string> values;
+        reader.begin_array();
+        while (reader.next_element()) {
+            values.emplace_back(reader.read_string());
+        }
+        return values;
+    };
+    
+    std::optional<PresetVersion> version;
+    std::optional<std::string> name;
+    std::string description;
+    std::vector<PresetJobDefinition> jobs;
+    std::vector<PresetDependency> dependencies;
+    std::vector<PresetRetryPolicy> retry_policies;
+    
+    reader.begin_object();
+    while (reader.next_key(key)) {
+        if (key == "version") {
+            std::string version_str(reader.read_string());
+            try {
+                version = PresetVersion::from_string(version_str);
+            } catch (const std::invalid_argument& e) {
+                reader.fail(e.what());
+            }
+        } else if (key == "name") {
+            name = std::string(reader.read_string());
+        } else if (key == "description") {
+            description = std::string(reader.read_string());
+        } else if (key == "jobs") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                PresetJobDefinition job;
+                bool has_name = false;
+                reader.begin_object();
+                while (reader.next_key(key)) {
+                    if (key == "job_name") {
+                        job.job_name = reader.read_string();
+                        has_name = true;
+                    } else if (key == "engine_identifier") {
+                        job.engine_identifier = reader.read_string();
+                    } else if (key == "api_operation") {
+                        job.api_operation = reader.read_string();
+                    } else if (key == "parameters_blob") {
+                        job.parameters_blob = reader.read_string();
+                    } else if (key == "input_artifacts") {
+                        job.input_artifacts = read_string_array();
+                    } else if (key == "output_artifacts") {
+                        job.output_artifacts = read_string_array();
+                    } else {
+                        reader.skip_value();
+                    }
+                }
+                if (!has_name) {
+                    reader.fail("job missing job_name");
+                }
+                jobs.push_back(std::move(job));
+            }
+        } else if (key == "dependencies") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                std::optional<std::string> from_job;
+                std::optional<std::string> to_job;
+                reader.begin_object();
+                while (reader.next_key(key)) {
+                    if (key == "from_job") {
+                        from_job = std::string(reader.read_string());
+                    } else if (key == "to_job") {
+                        to_job = std::string(reader.read_string());
+                    } else {
+                        reader.skip_value();
+                    }
+                }
+                if (!from_job || !to_job) {
+                    reader.fail("dependency missing from_job or to_job");
+                }
+                dependencies.emplace_back(std::move(*from_job), std::move(*to_job));
+            }
+        } else if (key == "retry_policies") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                PresetRetryPolicy policy;
+                bool has_name = false;
+                reader.begin_object();
+                while (reader.next_key(key)) {
+                    if (key == "job_name") {
+                        policy.job_name = reader.read_string();
+                        has_name = true;
+                    } else if (key == "max_attempts") {
+                        policy.max_attempts = read_uint32();
+                    } else if (key == "retry_delay_ticks") {
+                        policy.retry_delay_ticks = read_uint32();
+                    } else if (key == "retry_on_states") {
+                        auto states = read_string_array();
+                        policy.retry_on_states = std::set<std::string>(
+                            std::make_move_iterator(states.begin()), std::make_move_iterator(states.end()));
+                    } else {
+                        reader.skip_value();
+                    }
+                }
+                if (!has_name) {
+                    reader.fail("retry policy missing job_name");
+                }
+                retry_policies.push_back(std::move(policy));
+            }
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.expect_end();
+    
+    if (!version) {
+        reader.fail("preset missing version");
+    }
+    if (!name) {
+        reader.fail("preset missing name");
+    }
+    
+    BatchFlowPreset preset(*version, std::move(*name), std::move(description));
+    for (auto& job : jobs) {
+        preset.add_job(std::move(job));
+    }
+    for (auto& dep : dependencies) {
+        preset.add_dependency(std::move(dep));
+    }
+    for (auto& policy : retry_policies) {
+        preset.add_retry_policy(std::move(policy));
+    }
+    return preset;
+}
+
+/// Dense job-name interning shared by the validation passes
+/// Index order follows the jobs map, so comparing indices compares names
+struct PresetValidator::JobIndex {
+    std::vector<std::string_view> names;
+    std::unordered_map<std::string_view, uint32_t> positions;
+    
+    explicit JobIndex(const std::map<std::string, PresetJobDefinition>& jobs) {
+        names.reserve(jobs.size());
+        positions.reserve(jobs.size());
+        for (const auto& [name, job] : jobs) {
+            positions.emplace(name, static_cast<uint32_t>(names.size()));
+            names.push_back(name);
+        }
+    }
+    
+    /// Intern names from sorted, unique views
+    explicit JobIndex(std::vector<std::string_view> sorted_names) : names(std::move(sorted_names)) {
+        positions.reserve(names.size());
+        for (uint32_t i = 0; i < names.size(); ++i) {
+            positions.emplace(names[i], i);
+        }
+    }
+    
+    std::optional<uint32_t> find(std::string_view name) const {
+        auto it = positions.find(name);
+        if (it == positions.end()) return std::nullopt;
+        return it->second;
+    }
+    
+    /// Build adjacency from dependencies whose endpoints are both interned
+    /// The dependency set is ordered by (from, to) name, which equals index
+    /// order, so rows come out sorted without a separate sort pass
+    Adjacency build_adjacency(const std::set<PresetDependency>& dependencies) const {
+        Adjacency adjacency;
+        adjacency.offsets.assign(names.size() + 1, 0);
+        adjacency.targets.reserve(dependencies.size());
+        for (const auto& dep : dependencies) {
+            auto from = find(dep.from_job);
+            auto to = find(dep.to_job);
+            if (!from || !to) continue;
+            ++adjacency.offsets[*from + 1];
+            adjacency.targets.push_back(*to);
+        }
+        for (size_t i = 1; i < adjacency.offsets.size(); ++i) {
+            adjacency.offsets[i] += adjacency.offsets[i - 1];
+        }
+        return adjacency;
+    }
+};
+
+/// Implementation of PresetValidator methods
+inline std::vector<std::string> PresetValidator::validate(const BatchFlowPreset& preset) {
+    std::vector<std::string> errors = validate_version(preset.version());
+    JobIndex index(preset.jobs());
+    append_job_errors(preset.jobs(), errors);
+    append_dependency_errors(index, preset.dependencies(), errors);
+    append_retry_policy_errors(index, preset.retry_policies(), errors);
+    return errors;
+}
+
+inline std::vector<std::string> PresetValidator::validate_jobs(const std::map<std::string, PresetJobDefinition>& jobs) {
+    std::vector<std::string> errors;
+    append_job_errors(jobs, errors);
+    return errors;
+}
+
+inline std::vector<std::string> PresetValidator::validate_dependencies(
+    const std::map<std::string, PresetJobDefinition>& jobs,
+    const std::set<PresetDependency>& dependencies) {
+    
+    std::vector<std::string> errors;
+    append_dependency_errors(JobIndex(jobs), dependencies, errors);
+    return errors;
+}
+
+inline std::vector<std::string> PresetValidator::validate_retry_policies(
+    const std::map<std::string, PresetJobDefinition>& jobs,
+    const std::map<std::string, PresetRetryPolicy>& policies) {
+    
+    std::vector<std::string> errors;
+    append_retry_policy_errors(JobIndex(jobs), policies, errors);
+    return errors;
+}
+
+inline std::vector<std::string> PresetValidator::validate_version(const PresetVersion& version) {
+    std::vector<std::string> errors;
+    if (!version.is_compatible_with(PresetVersion::current())) {
+        errors.push_back("Unsupported preset version: " + version.to_string() +
+                         " (expected major version " + std::to_string(PresetVersion::current().major) + ")");
+    }
+    return errors;
+}
+
+inline void PresetValidator::append_job_errors(const std::map<std::string, PresetJobDefinition>& jobs,
+                                               std::vector<std::string>& errors) {
+    for (const auto& [name, job] : jobs) {
+        if (name != job.job_name) {
+            errors.push_back("Job key '" + name + "' does not match job_name '" + job.job_name + "'");
+        }
+        auto job_errors = validate_job(job);
+        errors.insert(errors.end(), job_errors.begin(), job_errors.end());
+    }
+}
+
+inline void PresetValidator::append_dependency_errors(const JobIndex& index,
+                                                      const std::set<PresetDependency>& dependencies,
+                                                      std::vector<std::string>& errors) {
+    for (const auto& dep : dependencies) {
+        if (!index.find(dep.from_job)) {
+            errors.push_back("Dependency references unknown job: " + dep.from_job);
+        }
+        if (!index.find(dep.to_job)) {
+            errors.push_back("Dependency references unknown job: " + dep.to_job);
+        }
+    }
+    
+    // Every cyclic component is reported, not just the first one found
+    for (const auto& cycle : find_cycles(index.build_adjacency(dependencies))) {
+        std::string message = "Dependency cycle detected among jobs: ";
+        for (size_t i = 0; i < cycle.size(); ++i) {
+            if (i > 0) message += ", ";
+            message += index.names[cycle[i]];
+        }
+        errors.push_back(std::move(message));
+    }
+}
+
+inline void PresetValidator::append_retry_policy_errors(const JobIndex& index,
+                                                        const std::map<std::string, PresetRetryPolicy>& policies,
+                                                        std::vector<std::string>& errors) {
+    for (const auto& [name, policy] : policies) {
+        if (!index.find(policy.job_name)) {
+            errors.push_back("Retry policy references unknown job: " + policy.job_name);
+        }
+        if (policy.max_attempts == 0) {
+            errors.push_back("Retry policy for '" + policy.job_name + "' must allow at least one attempt");
+        }
+        for (const auto& state : policy.retry_on_states) {
+            if (state != "Failed") {
+                errors.push_back("Retry policy for '" + policy.job_name + "' has unknown retry state: " + state);
+            }
+        }
+    }
+}
+
+inline std::vector<std::vector<uint32_t>> PresetValidator::find_cycles(const Adjacency& adjacency) {
+    constexpr uint32_t kUnvisited = UINT32_MAX;
+    const uint32_t node_count = static_cast<uint32_t>(adjacency.offsets.size() - 1);
+    
+    std::vector<uint32_t> order(node_count, kUnvisited);
+    std::vector<uint32_t> lowlink(node_count, 0);
+    std::vector<bool> on_stack(node_count, false);
+    std::vector<uint32_t> component_stack;
+    
+    // Explicit call stack: node and next edge to explore
+    struct Frame {
+        uint32_t node;
+        uint32_t next_edge;
+    };
+    std::vector<Frame> call_stack;
+    std::vector<std::vector<uint32_t>> cycles;
+    uint32_t counter = 0;
+    
+    auto enter = [&](uint32_t node) {
+        order[node] = lowlink[node] = counter++;
+        component_stack.push_back(node);
+        on_stack[node] = true;
+        call_stack.push_back({node, adjacency.offsets[node]});
+    };
+    
+    for (uint32_t root = 0; root < node_count; ++root) {
+        if (order[root] != kUnvisited) continue;
+        enter(root);
+        
+        while (!call_stack.empty()) {
+            uint32_t node = call_stack.back().node;
+            uint32_t& next_edge = call_stack.back().next_edge;
+            
+            if (next_edge < adjacency.offsets[node + 1]) {
+                uint32_t target = adjacency.targets[next_edge++];
+                if (order[target] == kUnvisited) {
+                    enter(target);
+                } else if (on_stack[target]) {
+                    lowlink[node] = std::min(lowlink[node], order[target]);
+                }
+                continue;
+            }
+            
+            if (lowlink[node] == order[node]) {
+                std::vector<uint32_t> component;
+                uint32_t member;
+                do {
+                    member = component_stack.back();
+                    component_stack.pop_back();
+                    on_stack[member] = false;
+                    component.push_back(member);
+                } while (member != node);
+                
+                auto row_begin = adjacency.targets.begin() + adjacency.offsets[node];
+                auto row_end = adjacency.targets.begin() + adjacency.offsets[node + 1];
+                bool self_loop = std::binary_search(row_begin, row_end, node);
+                if (component.size() > 1 || self_loop) {
+                    std::sort(component.begin(), component.end());
+                    cycles.push_back(std::move(component));
+                }
+            }
+            
+            call_stack.pop_back();
+            if (!call_stack.empty()) {
+                uint32_t parent = call_stack.back().node;
+                lowlink[parent] = std::min(lowlink[parent], lowlink[node]);
+            }
+        }
+    }
+    
+    std::sort(cycles.begin(), cycles.end(),
+              [](const auto& a, const auto& b) { return a.front() < b.front(); });
+    return cycles;
+}
+
+inline std::vector<std::string> PresetValidator::validate_job(const PresetJobDefinition& job) {
+    std::vector<std::string> errors;
+    if (job.job_name.empty()) {
+        errors.push_back("Job has empty job_name");
+    }
+    if (job.engine_identifier.empty()) {
+        errors.push_back("Job '" + job.job_name + "' has empty engine_identifier");
+    }
+    if (job.api_operation.empty()) {
+        errors.push_back("Job '" + job.job_name + "' has empty api_operation");
+    }
+    return errors;
+}
+
 inline RetryPolicy PresetRetryPolicy::to_runtime_policy() const {
     std::set<RetryableState> runtime_states;
     for (const auto& state_str : retry_on_states) {
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "nx_batchflow_preset.h"
+#include "nx_batchflow_dag.h"
+#include <cstddef>
+
+namespace nx::batchflow {
+
+/// PresetCompileOptions controls bulk preset-to-graph compilation
+struct PresetCompileOptions {
+    size_t worker_count = 0;          // Hashing threads (0 = hardware concurrency)
+    size_t parallel_threshold = 512;  // Below this job count hashing stays on the calling thread
+};
+
+/// Compute JobId for a preset job through JobIdHasher::compute_job_id
+JobId compute_preset_job_id(const PresetJobDefinition& job);
+
+/// Compile preset into a finalized JobGraph in one bulk pass
+///
+/// Node i is the i-th job in name order; dependency order follows the preset's
+/// ordered dependency set. Job hashing is spread across worker threads, node and
+/// edge storage is sized once, and edges go straight into CSR adjacency through
+/// JobGraph::from_dense_edges - no per-edge JobId lookups.
+///
+/// Throws std::invalid_argument if the preset does not validate
+JobGraph compile_preset(const BatchFlowPreset& preset, const PresetCompileOptions& options = {});
+
+} // namespace nx::batchflow
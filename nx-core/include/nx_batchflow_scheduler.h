@@ -122,6 +122,7 @@ inline BatchFlowScheduler::BatchFlowScheduler(const JobGraph& dag, LogicalClock&
 }
 
 inline std::vector<JobId> BatchFlowScheduler::next_ready_jobs() const {
+    NX_PROFILE_ZONE("BatchFlowScheduler::next_ready_jobs");
     std::vector<JobId> ready_jobs;
     
     // Find all pending jobs with satisfied dependencies
@@ -138,6 +139,7 @@ inline std::vector<JobId> BatchFlowScheduler::next_ready_jobs() const {
 }
 
 inline LogicalTick BatchFlowScheduler::start_job(const JobId& job_id) {
+    NX_PROFILE_ZONE("BatchFlowScheduler::start_job");
     auto& status = job_statuses_[job_id];
     if (status.state != JobState::Pending) {
         throw std::invalid_argument("Job is not in Pending state");
@@ -148,6 +150,7 @@ inline LogicalTick BatchFlowScheduler::start_job(const JobId& job_id) {
 }
 
 inline LogicalTick BatchFlowScheduler::mark_completed(const JobId& job_id) {
+    NX_PROFILE_ZONE("BatchFlowScheduler::mark_completed");
     auto& status = job_statuses_[job_id];
     if (status.state != JobState::Running) {
         throw std::invalid_argument("Job is not in Running state");
@@ -158,6 +161,7 @@ inline LogicalTick BatchFlowScheduler::mark_completed(const JobId& job_id) {
 }
 
 inline LogicalTick BatchFlowScheduler::mark_failed(const JobId& job_id, FailureCategory category) {
+    NX_PROFILE_ZONE("BatchFlowScheduler::mark_failed");
     auto& status = job_statuses_[job_id];
     if (status.state != JobState::Running) {
         throw std::invalid_argument("Job is not in Running state");
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/// Building blocks for sectioned, memory-mapped binary images
+///
+/// An image is a fixed header followed by 8-byte aligned sections. The header
+/// starts with an 8-byte magic, a byte order mark and a format version, and
+/// ends with a section table of (offset, size) pairs. Strings live in one
+/// deduplicated string table and are referenced by (offset, length).
+///
+/// Records are read in place from the mapping, so every layout type must be
+/// trivially copyable and free of implicit padding. Helpers here never throw
+/// format-specific errors; each format maps the returned status to its own.
+
+namespace nx::binary_image {
+
+/// Host byte order guard stored in every header
+inline constexpr uint32_t kByteOrderMark = 0x01020304;
+
+/// Reference into the string table
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+/// Entry in a header section table
+struct SectionRef {
+    uint64_t offset;
+    uint64_t size;
+};
+
+/// Deduplicating string table builder
+/// add() throws std::length_error once the table would exceed 4 GiB
+class StringTableBuilder {
+public:
+    StringRef add(std::string_view value);
+
+    const std::string& data() const { return data_; }
+
+private:
+    std::string data_;
+    std::unordered_map<std::string, StringRef> index_;
+};
+
+/// Append count records as a new section, padded to 8-byte alignment so
+/// records can be read in place
+template <typename T>
+void append_section(std::string& image, SectionRef& section, const T* data, size_t count) {
+    image.append((8 - image.size() % 8) % 8, '\0');
+    section.offset = image.size();
+    section.size = count * sizeof(T);
+    if (count > 0) {
+        image.append(reinterpret_cast<const char*>(data), section.size);
+    }
+}
+
+/// Resolve a string reference; nullopt when it leaves the string table
+inline std::optional<std::string_view> string_at(const char* data, const SectionRef& strings, const StringRef& ref) {
+    if (static_cast<uint64_t>(ref.offset) + ref.length > strings.size) {
+        return std::nullopt;
+    }
+    return std::string_view(data + strings.offset + ref.offset, ref.length);
+}
+
+/// Outcome of reading a fixed image header
+enum class HeaderStatus {
+    Ok,
+    TooSmall,
+    BadMagic,
+    ByteOrderMismatch,
+    UnsupportedVersion,
+    SectionOutOfBounds
+};
+
+/// Human-readable reason; found_version is reported for UnsupportedVersion
+std::string describe(HeaderStatus status, uint32_t found_version);
+
+/// Copy the fixed header out of an image and check magic, byte order, format
+/// version and section table bounds - O(1) in image size
+///
+/// Header must expose magic[8], byte_order_mark, format_version and a
+/// sections[] array of SectionRef.
+template <typename Header>
+HeaderStatus read_header(const char* data, size_t size, const char (&magic)[8], uint32_t format_version,
+                         Header& header) {
+    if (size < sizeof(Header)) {
+        return HeaderStatus::TooSmall;
+    }
+    std::memcpy(&header, data, sizeof(Header));
+    if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0) {
+        return HeaderStatus::BadMagic;
+    }
+    if (header.byte_order_mark != kByteOrderMark) {
+        return HeaderStatus::ByteOrderMismatch;
+    }
+    if (header.format_version != format_version) {
+        return HeaderStatus::UnsupportedVersion;
+    }
+    for (const SectionRef& section : header.sections) {
+        if (section.offset % 8 != 0 || section.offset > size || section.size > size - section.offset) {
+            return HeaderStatus::SectionOutOfBounds;
+        }
+    }
+    return HeaderStatus::Ok;
+}
+
+/// Read-only image bytes: a private file mapping, or owned bytes
+///
+/// On non-POSIX platforms map_file() reads the file into owned bytes.
+class MappedImage {
+public:
+    enum class OpenStatus {
+        Ok,
+        NotFound,     // File could not be opened
+        Unreadable    // File is empty or could not be mapped
+    };
+
+    MappedImage() = default;
+    MappedImage(const MappedImage&) = delete;
+    MappedImage& operator=(const MappedImage&) = delete;
+    ~MappedImage();
+
+    /// Map path read-only; replaces nothing on failure
+    OpenStatus map_file(const std::filesystem::path& path);
+
+    /// Take ownership of in-memory image bytes
+    void adopt(std::string bytes);
+
+    const char* data() const noexcept { return data_; }
+    size_t size() const noexcept { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    std::string owned_;             // Owned bytes (adopt() or non-POSIX fallback)
+    void* mapping_ = nullptr;       // mmap base (POSIX)
+    size_t mapping_size_ = 0;
+};
+
+} // namespace nx::binary_image
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define NX_PROFILE_HAS_TSC 1
+#endif
+
+/// Hot-path profiling zones
+///
+/// NX_PROFILE_ZONE("name") times the enclosing scope. Zones are compiled in
+/// only when NX_PROFILE_ENABLED is defined (CMake: -DNX_ENABLE_PROFILING=ON);
+/// otherwise the macro expands to nothing and instrumented code is unchanged.
+///
+/// When enabled, a zone costs two timestamp reads (RDTSC on x86, steady_clock
+/// elsewhere) and one store into a per-thread ring buffer. No locks, no
+/// allocation after the thread's first zone. Zone names must be string
+/// literals (or otherwise outlive the process).
+///
+/// Profiling observes wall time only; it never feeds back into scheduling,
+/// hashing or any other deterministic output.
+
+#define NX_PROFILE_CONCAT_INNER(a, b) a##b
+#define NX_PROFILE_CONCAT(a, b) NX_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef NX_PROFILE_ENABLED
+#define NX_PROFILE_ZONE(name) \
+    ::nx::profile::Zone NX_PROFILE_CONCAT(nx_profile_zone_, __LINE__) { name }
+#else
+#define NX_PROFILE_ZONE(name) ((void)0)
+#endif
+
+namespace nx::profile {
+
+/// True when this translation unit was compiled with zones enabled
+#ifdef NX_PROFILE_ENABLED
+inline constexpr bool kEnabled = true;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+/// Raw timestamp in ticks (TSC cycles, or steady_clock nanoseconds without TSC)
+inline uint64_t read_timestamp() noexcept {
+#ifdef NX_PROFILE_HAS_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/// Single-writer ring of finished zones owned by one thread
+/// The owning thread publishes each sample by advancing head; collect()
+/// reads behind it and discards anything the writer may have overwritten.
+struct ThreadRing {
+    static constexpr size_t kCapacity = 4096;   // Power of two
+    static constexpr size_t kMask = kCapacity - 1;
+    static constexpr size_t kRetained = kCapacity - 1;  // Slot at head may be mid-write
+
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> begin{0};
+        std::atomic<uint64_t> end{0};
+    };
+
+    std::array<Slot, kCapacity> slots;
+    alignas(64) std::atomic<uint64_t> head{0};   // Samples ever written (writer only)
+    alignas(64) uint64_t tail = 0;               // Samples consumed (collector only)
+    std::atomic<bool> retired{false};            // Owning thread has exited
+
+    void push(const char* name, uint64_t begin, uint64_t end) noexcept {
+        uint64_t index = head.load(std::memory_order_relaxed);
+        // Pairs with the collector's acquire fence: a torn read implies it sees head >= index
+        std::atomic_thread_fence(std::memory_order_release);
+        Slot& slot = slots[index & kMask];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.begin.store(begin, std::memory_order_relaxed);
+        slot.end.store(end, std::memory_order_relaxed);
+        head.store(index + 1, std::memory_order_release);
+    }
+};
+
+namespace detail {
+/// Allocate and register the calling thread's ring; retired at thread exit
+ThreadRing* register_thread();
+} // namespace detail
+
+/// Ring buffer for the calling thread, registered on first use
+inline ThreadRing& thread_ring() {
+    thread_local ThreadRing* ring = detail::register_thread();
+    return *ring;
+}
+
+/// RAII zone; use through NX_PROFILE_ZONE
+class Zone {
+public:
+    explicit Zone(const char* name) noexcept
+        : name_(name), begin_(read_timestamp()) {}
+
+    ~Zone() {
+        uint64_t end = read_timestamp();
+        thread_ring().push(name_, begin_, end);
+    }
+
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+
+private:
+    const char* name_;
+    uint64_t begin_;
+};
+
+/// Aggregated timings for one zone name since start (or reset())
+struct ZoneStats {
+    std::string name;
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+};
+
+/// Process-wide profile: zones sorted by name
+struct ProfileSnapshot {
+    std::vector<ZoneStats> zones;
+    uint64_t dropped = 0;          // Samples overwritten before they were collected
+    double ticks_per_ns = 1.0;     // Timestamp calibration used for conversion
+};
+
+/// Drain every thread's ring into the process-wide aggregate and return it
+/// Safe to call from any thread while zones are being recorded. Rings are
+/// bounded, so call at least once per kRetained zones per thread to avoid drops.
+ProfileSnapshot collect();
+
+/// Discard all aggregated and pending samples
+void reset();
+
+} // namespace nx::profile
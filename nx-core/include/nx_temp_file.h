@@ -0,0 +1,18 @@
+#pragma once
+
+#include <filesystem>
+
+/// Temporary siblings for write-then-rename file replacement
+///
+/// Writers build the new content in a temporary file next to the target and
+/// rename it into place, so readers see either the old or the new file. The
+/// temporary name must be private to one writer: two processes sharing it
+/// could rename each other's half-written file into place.
+
+namespace nx::core {
+
+/// "<path>.tmp.<pid>.<n>" - unique per process and per call, and in the same
+/// directory as path so the final rename never crosses file systems
+std::filesystem::path unique_temp_path(const std::filesystem::path& path);
+
+} // namespace nx::core
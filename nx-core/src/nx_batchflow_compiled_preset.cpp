@@ -0,0 +1,570 @@
+#include "nx_batchflow_compiled_preset.h"
+#include "nx_binary_image.h"
+#include "nx_temp_file.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace nx::batchflow {
+
+namespace {
+
+using binary_image::SectionRef;
+using binary_image::StringRef;
+using binary_image::append_section;
+
+constexpr char kMagic[8] = {'N', 'X', 'P', 'R', 'E', 'S', 'E', 'T'};
+
+// Section indices in the header section table
+enum Section : uint32_t {
+    kStrings = 0,
+    kJobs,
+    kArtifacts,
+    kUpstreamOffsets,
+    kUpstreamTargets,
+    kDownstreamOffsets,
+    kDownstreamTargets,
+    kPolicies,
+    kPolicyStates,
+    kErrors,
+    kSectionCount
+};
+
+// Fixed-size image header (8-byte aligned, host byte order guarded by mark)
+struct FileHeader {
+    char magic[8];
+    uint32_t byte_order_mark;
+    uint32_t format_version;
+    uint32_t version_major;
+    uint32_t version_minor;
+    uint32_t version_patch;
+    uint32_t job_count;
+    uint32_t dependency_count;
+    uint32_t policy_count;
+    uint32_t error_count;
+    uint32_t reserved;
+    StringRef name;
+    StringRef description;
+    StringRef source_digest;
+    SectionRef sections[kSectionCount];
+};
+
+struct JobRecord {
+    StringRef name;
+    StringRef engine_identifier;
+    StringRef api_operation;
+    StringRef parameters_blob;
+    StringRef job_id;
+    uint32_t inputs_begin;
+    uint32_t inputs_count;
+    uint32_t outputs_begin;
+    uint32_t outputs_count;
+};
+
+struct PolicyRecord {
+    uint32_t job_index;
+    uint32_t max_attempts;
+    uint32_t retry_delay_ticks;
+    uint32_t states_begin;
+    uint32_t states_count;
+    uint32_t reserved;
+};
+
+// String table overflow is a compile error of this format
+class PresetStringTable {
+public:
+    StringRef add(std::string_view value) {
+        try {
+            return builder_.add(value);
+        } catch (const std::length_error& e) {
+            throw CompiledPresetError(e.what());
+        }
+    }
+
+    const std::string& data() const { return builder_.data(); }
+
+private:
+    binary_image::StringTableBuilder builder_;
+};
+
+} // anonymous namespace
+
+/// Backing storage of a compiled image: mapped file or owned bytes
+struct CompiledPreset::Image {
+    binary_image::MappedImage bytes;
+    const char* data = nullptr;
+    size_t size = 0;
+    FileHeader header{};
+
+    std::string_view string(const StringRef& ref) const {
+        auto value = binary_image::string_at(data, header.sections[kStrings], ref);
+        if (!value) {
+            throw CompiledPresetError("string reference out of bounds");
+        }
+        return *value;
+    }
+
+    template <typename T>
+    const T* section(Section index, size_t count) const {
+        const auto& ref = header.sections[index];
+        if (count * sizeof(T) > ref.size) {
+            throw CompiledPresetError("section record out of bounds");
+        }
+        return reinterpret_cast<const T*>(data + ref.offset);
+    }
+
+    template <typename T>
+    const T& record(Section index, size_t position) const {
+        return section<T>(index, position + 1)[position];
+    }
+
+    // Validate fixed header and section table only - O(1) in preset size
+    void validate_header() {
+        data = bytes.data();
+        size = bytes.size();
+        auto status = binary_image::read_header(data, size, kMagic, kFormatVersion, header);
+        if (status != binary_image::HeaderStatus::Ok) {
+            throw CompiledPresetError(binary_image::describe(status, header.format_version));
+        }
+        auto expect_count = [this](Section index, uint64_t count, size_t record_size) {
+            if (header.sections[index].size != count * record_size) {
+                throw CompiledPresetError("section size mismatch");
+            }
+        };
+        expect_count(kJobs, header.job_count, sizeof(JobRecord));
+        expect_count(kUpstreamOffsets, uint64_t{header.job_count} + 1, sizeof(uint32_t));
+        expect_count(kDownstreamOffsets, uint64_t{header.job_count} + 1, sizeof(uint32_t));
+        expect_count(kUpstreamTargets, header.dependency_count, sizeof(uint32_t));
+        expect_count(kDownstreamTargets, header.dependency_count, sizeof(uint32_t));
+        expect_count(kPolicies, header.policy_count, sizeof(PolicyRecord));
+        expect_count(kErrors, header.error_count, sizeof(StringRef));
+    }
+};
+
+namespace {
+
+std::string read_source_file(const std::filesystem::path& source_path) {
+    std::ifstream in(source_path, std::ios::binary);
+    if (!in.is_open()) {
+        throw CompiledPresetError("cannot open " + source_path.string());
+    }
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+} // anonymous namespace
+
+std::string CompiledPreset::source_digest(const std::string& source_text) {
+    return JobIdHasher::compute_content_hash(source_text);
+}
+
+std::string CompiledPreset::compile(const BatchFlowPreset& preset) {
+    return compile(preset, source_digest(preset.to_json()));
+}
+
+std::string CompiledPreset::compile(const BatchFlowPreset& preset, const std::string& source_digest) {
+    const auto& jobs = preset.jobs();
+    if (jobs.size() > UINT32_MAX - 1) {
+        throw CompiledPresetError("too many jobs");
+    }
+
+    PresetStringTable strings;
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.byte_order_mark = binary_image::kByteOrderMark;
+    header.format_version = kFormatVersion;
+    header.version_major = preset.version().major;
+    header.version_minor = preset.version().minor;
+    header.version_patch = preset.version().patch;
+    header.name = strings.add(preset.name());
+    header.description = strings.add(preset.description());
+    header.source_digest = strings.add(source_digest);
+
+    // Jobs in name order - dense index equals map position
+    std::unordered_map<std::string_view, uint32_t> job_index;
+    job_index.reserve(jobs.size());
+    std::vector<JobRecord> job_records;
+    job_records.reserve(jobs.size());
+    std::vector<StringRef> artifacts;
+
+    for (const auto& [name, job] : jobs) {
+        job_index.emplace(name, static_cast<uint32_t>(job_records.size()));
+
+        std::vector<ArtifactId> inputs;
+        std::vector<ArtifactId> outputs;
+        JobRecord record{};
+        record.name = strings.add(name);
+        record.engine_identifier = strings.add(job.engine_identifier);
+        record.api_operation = strings.add(job.api_operation);
+        record.parameters_blob = strings.add(job.parameters_blob);
+
+        record.inputs_begin = static_cast<uint32_t>(artifacts.size());
+        record.inputs_count = static_cast<uint32_t>(job.input_artifacts.size());
+        for (const auto& artifact : job.input_artifacts) {
+            artifacts.push_back(strings.add(artifact));
+            inputs.emplace_back(artifact);
+        }
+        record.outputs_begin = static_cast<uint32_t>(artifacts.size());
+        record.outputs_count = static_cast<uint32_t>(job.output_artifacts.size());
+        for (const auto& artifact : job.output_artifacts) {
+            artifacts.push_back(strings.add(artifact));
+            outputs.emplace_back(artifact);
+        }
+
+        JobDefinition definition(job.engine_identifier, job.api_operation, job.parameters_blob,
+                                 std::move(inputs), std::move(outputs));
+        record.job_id = strings.add(JobIdHasher::compute_job_id(definition).hash());
+        job_records.push_back(record);
+    }
+    header.job_count = static_cast<uint32_t>(job_records.size());
+
+    // CSR adjacency; edges with unknown endpoints are dropped (reported as errors)
+    std::vector<std::pair<uint32_t, uint32_t>> edges;  // (from, to)
+    edges.reserve(preset.dependencies().size());
+    for (const auto& dep : preset.dependencies()) {
+        auto from = job_index.find(dep.from_job);
+        auto to = job_index.find(dep.to_job);
+        if (from != job_index.end() && to != job_index.end()) {
+            edges.emplace_back(from->second, to->second);
+        }
+    }
+    header.dependency_count = static_cast<uint32_t>(edges.size());
+
+    auto build_csr = [&](bool upstream, std::vector<uint32_t>& offsets, std::vector<uint32_t>& targets) {
+        offsets.assign(job_records.size() + 1, 0);
+        for (const auto& [from, to] : edges) {
+            offsets[(upstream ? to : from) + 1]++;
+        }
+        for (size_t i = 1; i < offsets.size(); ++i) {
+            offsets[i] += offsets[i - 1];
+        }
+        targets.assign(edges.size(), 0);
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (const auto& [from, to] : edges) {
+            uint32_t row = upstream ? to : from;
+            targets[cursor[row]++] = upstream ? from : to;
+        }
+        for (size_t row = 0; row + 1 < offsets.size(); ++row) {
+            std::sort(targets.begin() + offsets[row], targets.begin() + offsets[row + 1]);
+        }
+    };
+
+    std::vector<uint32_t> upstream_offsets, upstream_targets, downstream_offsets, downstream_targets;
+    build_csr(true, upstream_offsets, upstream_targets);
+    build_csr(false, downstream_offsets, downstream_targets);
+
+    // Retry policies by job index (map order equals index order)
+    std::vector<PolicyRecord> policies;
+    std::vector<StringRef> policy_states;
+    for (const auto& [name, policy] : preset.retry_policies()) {
+        auto it = job_index.find(policy.job_name);
+        if (it == job_index.end()) {
+            continue;
+        }
+        PolicyRecord record{};
+        record.job_index = it->second;
+        record.max_attempts = policy.max_attempts;
+        record.retry_delay_ticks = policy.retry_delay_ticks;
+        record.states_begin = static_cast<uint32_t>(policy_states.size());
+        record.states_count = static_cast<uint32_t>(policy.retry_on_states.size());
+        for (const auto& state : policy.retry_on_states) {
+            policy_states.push_back(strings.add(state));
+        }
+        policies.push_back(record);
+    }
+    std::sort(policies.begin(), policies.end(),
+              [](const PolicyRecord& a, const PolicyRecord& b) { return a.job_index < b.job_index; });
+    header.policy_count = static_cast<uint32_t>(policies.size());
+
+    // Validation result captured once
+    std::vector<StringRef> errors;
+    for (const auto& error : preset.validate()) {
+        errors.push_back(strings.add(error));
+    }
+    header.error_count = static_cast<uint32_t>(errors.size());
+
+    std::string image(sizeof(FileHeader), '\0');
+    append_section(image, header.sections[kStrings], strings.data().data(), strings.data().size());
+    append_section(image, header.sections[kJobs], job_records.data(), job_records.size());
+    append_section(image, header.sections[kArtifacts], artifacts.data(), artifacts.size());
+    append_section(image, header.sections[kUpstreamOffsets], upstream_offsets.data(), upstream_offsets.size());
+    append_section(image, header.sections[kUpstreamTargets], upstream_targets.data(), upstream_targets.size());
+    append_section(image, header.sections[kDownstreamOffsets], downstream_offsets.data(), downstream_offsets.size());
+    append_section(image, header.sections[kDownstreamTargets], downstream_targets.data(), downstream_targets.size());
+    append_section(image, header.sections[kPolicies], policies.data(), policies.size());
+    append_section(image, header.sections[kPolicyStates], policy_states.data(), policy_states.size());
+    append_section(image, header.sections[kErrors], errors.data(), errors.size());
+    std::memcpy(image.data(), &header, sizeof(FileHeader));
+
+    return image;
+}
+
+namespace {
+
+void write_image_file(const std::string& image, const std::filesystem::path& path) {
+    // Private temp name: concurrent compiles of one preset must not share it
+    auto temp_path = nx::core::unique_temp_path(path);
+    try {
+        {
+            std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+            if (!out.is_open() || !out.write(image.data(), static_cast<std::streamsize>(image.size()))) {
+                throw CompiledPresetError("cannot write " + temp_path.string());
+            }
+        }
+        std::filesystem::rename(temp_path, path);
+    } catch (...) {
+        std::error_code ignored;
+        std::filesystem::remove(temp_path, ignored);
+        throw;
+    }
+}
+
+} // anonymous namespace
+
+void CompiledPreset::compile_to_file(const BatchFlowPreset& preset, const std::filesystem::path& path) {
+    write_image_file(compile(preset), path);
+}
+
+void CompiledPreset::compile_file(const std::filesystem::path& source_path, const std::filesystem::path& path) {
+    std::string source_text = read_source_file(source_path);
+    write_image_file(compile(BatchFlowPreset::from_json(source_text), source_digest(source_text)), path);
+}
+
+CompiledPreset CompiledPreset::open(const std::filesystem::path& path) {
+    auto image = std::make_shared<Image>();
+    switch (image->bytes.map_file(path)) {
+        case binary_image::MappedImage::OpenStatus::Ok:
+            break;
+        case binary_image::MappedImage::OpenStatus::NotFound:
+            throw CompiledPresetError("cannot open " + path.string());
+        case binary_image::MappedImage::OpenStatus::Unreadable:
+            throw CompiledPresetError("cannot map " + path.string());
+    }
+    image->validate_header();
+    return CompiledPreset(std::move(image));
+}
+
+CompiledPreset CompiledPreset::from_bytes(std::string bytes) {
+    auto image = std::make_shared<Image>();
+    image->bytes.adopt(std::move(bytes));
+    image->validate_header();
+    return CompiledPreset(std::move(image));
+}
+
+bool CompiledPreset::needs_recompile(const std::filesystem::path& path, const std::filesystem::path& source_path) {
+    if (!std::filesystem::exists(path)) {
+        return true;
+    }
+    try {
+        // Header-only open rejects other format versions; the source is hashed, never parsed
+        auto compiled = open(path);
+        return !compiled.is_compatible() ||
+               compiled.recorded_source_digest() != source_digest(read_source_file(source_path));
+    } catch (const CompiledPresetError&) {
+        return true;
+    }
+}
+
+PresetVersion CompiledPreset::version() const {
+    const auto& header = image_->header;
+    return PresetVersion(header.version_major, header.version_minor, header.version_patch);
+}
+
+std::string_view CompiledPreset::name() const {
+    return image_->string(image_->header.name);
+}
+
+std::string_view CompiledPreset::description() const {
+    return image_->string(image_->header.description);
+}
+
+std::string_view CompiledPreset::recorded_source_digest() const {
+    return image_->string(image_->header.source_digest);
+}
+
+bool CompiledPreset::is_valid() const {
+    return image_->header.error_count == 0;
+}
+
+std::vector<std::string_view> CompiledPreset::validation_errors() const {
+    std::vector<std::string_view> errors;
+    errors.reserve(image_->header.error_count);
+    for (size_t i = 0; i < image_->header.error_count; ++i) {
+        errors.push_back(image_->string(image_->record<StringRef>(kErrors, i)));
+    }
+    return errors;
+}
+
+size_t CompiledPreset::job_count() const {
+    return image_->header.job_count;
+}
+
+CompiledJobView CompiledPreset::job(size_t index) const {
+    if (index >= job_count()) {
+        throw std::out_of_range("Compiled job index out of range");
+    }
+    const auto& record = image_->record<JobRecord>(kJobs, index);
+
+    auto artifact_range = [this](uint32_t begin, uint32_t count) {
+        std::vector<std::string_view> values;
+        values.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            values.push_back(image_->string(image_->record<StringRef>(kArtifacts, size_t{begin} + i)));
+        }
+        return values;
+    };
+
+    return CompiledJobView{
+        image_->string(record.name),
+        image_->string(record.engine_identifier),
+        image_->string(record.api_operation),
+        image_->string(record.parameters_blob),
+        image_->string(record.job_id),
+        artifact_range(record.inputs_begin, record.inputs_count),
+        artifact_range(record.outputs_begin, record.outputs_count)
+    };
+}
+
+std::string_view CompiledPreset::job_name(size_t index) const {
+    if (index >= job_count()) {
+        throw std::out_of_range("Compiled job index out of range");
+    }
+    return image_->string(image_->record<JobRecord>(kJobs, index).name);
+}
+
+JobId CompiledPreset::job_id(size_t index) const {
+    if (index >= job_count()) {
+        throw std::out_of_range("Compiled job index out of range");
+    }
+    return JobId::from_content_hash(std::string(image_->string(image_->record<JobRecord>(kJobs, index).job_id)));
+}
+
+std::optional<size_t> CompiledPreset::find_job(std::string_view job_name) const {
+    size_t low = 0;
+    size_t high = job_count();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        auto candidate = this->job_name(mid);
+        if (candidate == job_name) {
+            return mid;
+        }
+        if (candidate < job_name) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return std::nullopt;
+}
+
+size_t CompiledPreset::dependency_count() const {
+    return image_->header.dependency_count;
+}
+
+namespace {
+
+CompiledEdgeRange csr_row(const uint32_t* offsets, const uint32_t* targets, size_t edge_count,
+                          size_t job_count, size_t index) {
+    uint32_t begin = offsets[index];
+    uint32_t end = offsets[index + 1];
+    if (begin > end || end > edge_count) {
+        throw CompiledPresetError("adjacency row out of bounds");
+    }
+    for (uint32_t i = begin; i < end; ++i) {
+        if (targets[i] >= job_count) {
+            throw CompiledPresetError("adjacency target out of bounds");
+        }
+    }
+    return CompiledEdgeRange(targets + begin, targets + end);
+}
+
+} // anonymous namespace
+
+CompiledEdgeRange CompiledPreset::dependencies_of(size_t index) const {
+    if (index >= job_count()) {
+        throw std::out_of_range("Compiled job index out of range");
+    }
+    return csr_row(image_->section<uint32_t>(kUpstreamOffsets, job_count() + 1),
+                   image_->section<uint32_t>(kUpstreamTargets, dependency_count()),
+                   dependency_count(), job_count(), index);
+}
+
+CompiledEdgeRange CompiledPreset::dependents_of(size_t index) const {
+    if (index >= job_count()) {
+        throw std::out_of_range("Compiled job index out of range");
+    }
+    return csr_row(image_->section<uint32_t>(kDownstreamOffsets, job_count() + 1),
+                   image_->section<uint32_t>(kDownstreamTargets, dependency_count()),
+                   dependency_count(), job_count(), index);
+}
+
+std::optional<PresetRetryPolicy> CompiledPreset::retry_policy(size_t index) const {
+    if (index >= job_count()) {
+        throw std::out_of_range("Compiled job index out of range");
+    }
+    const auto* policies = image_->section<PolicyRecord>(kPolicies, image_->header.policy_count);
+    const auto* end = policies + image_->header.policy_count;
+    const auto* it = std::lower_bound(policies, end, index,
+        [](const PolicyRecord& record, size_t value) { return record.job_index < value; });
+    if (it == end || it->job_index != index) {
+        return std::nullopt;
+    }
+
+    std::set<std::string> states;
+    for (uint32_t i = 0; i < it->states_count; ++i) {
+        states.emplace(image_->string(image_->record<StringRef>(kPolicyStates, size_t{it->states_begin} + i)));
+    }
+    return PresetRetryPolicy(std::string(job_name(index)), it->max_attempts, it->retry_delay_ticks,
+                             std::move(states));
+}
+
+BatchFlowPreset CompiledPreset::to_preset() const {
+    BatchFlowPreset preset(version(), std::string(name()), std::string(description()));
+
+    for (size_t i = 0; i < job_count(); ++i) {
+        auto view = job(i);
+        preset.add_job(PresetJobDefinition(
+            std::string(view.job_name),
+            std::string(view.engine_identifier),
+            std::string(view.api_operation),
+            std::string(view.parameters_blob),
+            std::vector<std::string>(view.input_artifacts.begin(), view.input_artifacts.end()),
+            std::vector<std::string>(view.output_artifacts.begin(), view.output_artifacts.end())));
+    }
+
+    for (size_t i = 0; i < job_count(); ++i) {
+        for (uint32_t dependent : dependents_of(i)) {
+            preset.add_dependency(PresetDependency(std::string(job_name(i)), std::string(job_name(dependent))));
+        }
+        if (auto policy = retry_policy(i)) {
+            preset.add_retry_policy(std::move(*policy));
+        }
+    }
+
+    return preset;
+}
+
+JobGraph CompiledPreset::to_job_graph() const {
+    std::vector<JobNode> nodes;
+    nodes.reserve(job_count());
+    for (size_t i = 0; i < job_count(); ++i) {
+        const auto& record = image_->record<JobRecord>(kJobs, i);
+        nodes.emplace_back(JobId::from_content_hash(std::string(image_->string(record.job_id))),
+                           std::string(image_->string(record.engine_identifier)),
+                           std::string(image_->string(record.parameters_blob)));
+    }
+
+    std::vector<DenseEdge> edges;
+    edges.reserve(dependency_count());
+    for (size_t i = 0; i < job_count(); ++i) {
+        for (uint32_t dependent : dependents_of(i)) {
+            edges.push_back(DenseEdge{static_cast<uint32_t>(i), dependent});
+        }
+    }
+
+    return JobGraph::from_dense_edges(std::move(nodes), edges);
+}
+
+} // namespace nx::batchflow
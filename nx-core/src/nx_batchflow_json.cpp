@@ -0,0 +1,109 @@
+#include "nx_batchflow_json.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace nx::batchflow {
+
+namespace {
+
+// A byte may need escaping if it is '"', '\\' or below 0x20
+inline bool is_special(unsigned char c) {
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+// Index of the first byte at or after pos that may need escaping, or size
+size_t find_special(const char* data, size_t size, size_t pos) {
+#if defined(__AVX2__)
+    const __m256i quote32 = _mm256_set1_epi8('"');
+    const __m256i backslash32 = _mm256_set1_epi8('\\');
+    const __m256i control32 = _mm256_set1_epi8(0x1F);
+    for (; pos + 32 <= size; pos += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        // min_epu8(v, 0x1F) == v  <=>  v <= 0x1F (unsigned)
+        __m256i hit = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, quote32), _mm256_cmpeq_epi8(v, backslash32)),
+            _mm256_cmpeq_epi8(_mm256_min_epu8(v, control32), v));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hit));
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1F);
+    for (; pos + 16 <= size; pos += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i hit = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+            _mm_cmpeq_epi8(_mm_min_epu8(v, control), v));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hit));
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t control = vdupq_n_u8(0x1F);
+    for (; pos + 16 <= size; pos += 16) {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos));
+        uint8x16_t hit = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)), vcleq_u8(v, control));
+        if (vmaxvq_u8(hit) != 0) {
+            break;   // Locate the byte within this block below
+        }
+    }
+#endif
+    for (; pos < size; ++pos) {
+        if (is_special(static_cast<unsigned char>(data[pos]))) {
+            return pos;
+        }
+    }
+    return size;
+}
+
+} // anonymous namespace
+
+void append_json_escaped(std::string& out, std::string_view value, JsonEscape escape) {
+    static constexpr char hex[] = "0123456789abcdef";
+    const char* data = value.data();
+    const size_t size = value.size();
+
+    size_t pos = 0;
+    while (pos < size) {
+        size_t next = find_special(data, size, pos);
+        out.append(data + pos, next - pos);   // Clean run in one copy
+        if (next == size) {
+            break;
+        }
+
+        char c = data[next];
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (escape != JsonEscape::Unicode && c == '\b') {
+                    out += "\\b";
+                } else if (escape != JsonEscape::Unicode && c == '\f') {
+                    out += "\\f";
+                } else if (escape == JsonEscape::Legacy) {
+                    out += c;
+                } else {
+                    out += "\\u00";
+                    out += hex[(c >> 4) & 0xF];
+                    out += hex[c & 0xF];
+                }
+        }
+        pos = next + 1;
+    }
+}
+
+} // namespace nx::batchflow
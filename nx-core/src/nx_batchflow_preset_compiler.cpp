@@ -0,0 +1,90 @@
+#include "nx_batchflow_preset_compiler.h"
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace nx::batchflow {
+
+JobId compute_preset_job_id(const PresetJobDefinition& job) {
+    return JobId::from_job_definition(JobDefinition(
+        job.engine_identifier, job.api_operation, job.parameters_blob,
+        std::vector<ArtifactId>(job.input_artifacts.begin(), job.input_artifacts.end()),
+        std::vector<ArtifactId>(job.output_artifacts.begin(), job.output_artifacts.end())));
+}
+
+JobGraph compile_preset(const BatchFlowPreset& preset, const PresetCompileOptions& options) {
+    const auto& errors = preset.validation_errors();
+    if (!errors.empty()) {
+        throw std::invalid_argument("Cannot compile invalid preset: " + errors.front());
+    }
+
+    const auto& jobs = preset.jobs();
+    const size_t job_count = jobs.size();
+
+    std::vector<const PresetJobDefinition*> ordered;
+    ordered.reserve(job_count);
+    std::unordered_map<std::string_view, uint32_t> positions;
+    positions.reserve(job_count);
+    for (const auto& [name, job] : jobs) {
+        positions.emplace(name, static_cast<uint32_t>(ordered.size()));
+        ordered.push_back(&job);
+    }
+
+    // Hash jobs into fixed slots; each worker owns a contiguous range
+    std::vector<std::optional<JobNode>> slots(job_count);
+    auto hash_range = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& job = *ordered[i];
+            slots[i].emplace(compute_preset_job_id(job), job.engine_identifier, job.parameters_blob);
+        }
+    };
+
+    size_t workers = options.worker_count != 0 ? options.worker_count
+                                               : std::max<size_t>(1, std::thread::hardware_concurrency());
+    workers = std::min(workers, job_count);
+    if (workers <= 1 || job_count < options.parallel_threshold) {
+        hash_range(0, job_count);
+    } else {
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> failures(workers);
+        threads.reserve(workers);
+        const size_t chunk = (job_count + workers - 1) / workers;
+        for (size_t w = 0; w < workers; ++w) {
+            size_t begin = std::min(job_count, w * chunk);
+            size_t end = std::min(job_count, begin + chunk);
+            threads.emplace_back([&, w, begin, end]() {
+                try {
+                    hash_range(begin, end);
+                } catch (...) {
+                    failures[w] = std::current_exception();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& failure : failures) {
+            if (failure) std::rethrow_exception(failure);
+        }
+    }
+
+    std::vector<JobNode> nodes;
+    nodes.reserve(job_count);
+    for (auto& slot : slots) {
+        nodes.push_back(std::move(*slot));
+    }
+
+    // Validation guarantees every endpoint resolves
+    std::vector<DenseEdge> edges;
+    edges.reserve(preset.dependencies().size());
+    for (const auto& dep : preset.dependencies()) {
+        edges.push_back(DenseEdge{positions.at(dep.from_job), positions.at(dep.to_job)});
+    }
+
+    return JobGraph::from_dense_edges(std::move(nodes), edges);
+}
+
+} // namespace nx::batchflow
@@ -0,0 +1,107 @@
+#include "nx_binary_image.h"
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nx::binary_image {
+
+StringRef StringTableBuilder::add(std::string_view value) {
+    auto it = index_.find(std::string(value));
+    if (it != index_.end()) {
+        return it->second;
+    }
+    if (data_.size() + value.size() > UINT32_MAX) {
+        throw std::length_error("string table exceeds 4 GiB");
+    }
+    StringRef ref{static_cast<uint32_t>(data_.size()), static_cast<uint32_t>(value.size())};
+    data_.append(value);
+    index_.emplace(std::string(value), ref);
+    return ref;
+}
+
+std::string describe(HeaderStatus status, uint32_t found_version) {
+    switch (status) {
+        case HeaderStatus::Ok:
+            return "ok";
+        case HeaderStatus::TooSmall:
+            return "image too small";
+        case HeaderStatus::BadMagic:
+            return "bad magic";
+        case HeaderStatus::ByteOrderMismatch:
+            return "byte order mismatch";
+        case HeaderStatus::UnsupportedVersion:
+            return "unsupported format version " + std::to_string(found_version);
+        case HeaderStatus::SectionOutOfBounds:
+            return "section out of bounds";
+    }
+    return "unknown header error";
+}
+
+MappedImage::~MappedImage() {
+#if !defined(_WIN32)
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+}
+
+MappedImage::OpenStatus MappedImage::map_file(const std::filesystem::path& path) {
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return OpenStatus::NotFound;
+    }
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return OpenStatus::Unreadable;
+    }
+    size_t mapping_size = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return OpenStatus::Unreadable;
+    }
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+    mapping_ = mapping;
+    mapping_size_ = mapping_size;
+    owned_.clear();
+    data_ = static_cast<const char*>(mapping);
+    size_ = mapping_size;
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return OpenStatus::NotFound;
+    }
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (bytes.empty()) {
+        return OpenStatus::Unreadable;
+    }
+    adopt(std::move(bytes));
+#endif
+    return OpenStatus::Ok;
+}
+
+void MappedImage::adopt(std::string bytes) {
+#if !defined(_WIN32)
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+#endif
+    owned_ = std::move(bytes);
+    data_ = owned_.data();
+    size_ = owned_.size();
+}
+
+} // namespace nx::binary_image
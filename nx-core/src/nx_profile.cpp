@@ -0,0 +1,169 @@
+#include "nx_profile.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace nx::profile {
+
+namespace {
+
+struct Accumulator {
+    uint64_t count = 0;
+    uint64_t total_ticks = 0;
+    uint64_t max_ticks = 0;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadRing>> rings;    // Live rings plus retired ones not yet drained
+    std::map<std::string, Accumulator, std::less<>> zones;
+    uint64_t dropped = 0;
+
+    // Calibration origin for converting ticks to nanoseconds
+    uint64_t origin_ticks = read_timestamp();
+    std::chrono::steady_clock::time_point origin_time = std::chrono::steady_clock::now();
+};
+
+// Never destroyed: threads may retire their rings during static destruction
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+// Marks the thread's ring retired at thread exit so collect() can release it
+struct RingOwner {
+    std::shared_ptr<ThreadRing> ring;
+    ~RingOwner() {
+        if (ring) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local RingOwner ring_owner;
+
+// Requires registry mutex
+double calibrate(Registry& state) {
+#ifdef NX_PROFILE_HAS_TSC
+    using namespace std::chrono;
+    // Spin until the window is long enough for a stable ratio (first collect only)
+    uint64_t ticks;
+    int64_t elapsed_ns;
+    do {
+        ticks = read_timestamp();
+        elapsed_ns = duration_cast<nanoseconds>(steady_clock::now() - state.origin_time).count();
+    } while (elapsed_ns < 1000000);
+    return static_cast<double>(ticks - state.origin_ticks) / static_cast<double>(elapsed_ns);
+#else
+    (void)state;
+    return 1.0;
+#endif
+}
+
+// Requires registry mutex; accumulate == false discards pending samples
+void drain(Registry& state, ThreadRing& ring, bool accumulate) {
+    uint64_t head = ring.head.load(std::memory_order_acquire);
+    uint64_t start = ring.tail;
+    if (head - start > ThreadRing::kRetained) {
+        if (accumulate) state.dropped += head - ThreadRing::kRetained - start;
+        start = head - ThreadRing::kRetained;
+    }
+    ring.tail = head;
+    if (!accumulate || start == head) {
+        return;
+    }
+
+    struct Sample {
+        const char* name;
+        uint64_t begin;
+        uint64_t end;
+    };
+    std::vector<Sample> samples;
+    samples.reserve(head - start);
+    for (uint64_t index = start; index < head; ++index) {
+        const auto& slot = ring.slots[index & ThreadRing::kMask];
+        samples.push_back({slot.name.load(std::memory_order_relaxed),
+                           slot.begin.load(std::memory_order_relaxed),
+                           slot.end.load(std::memory_order_relaxed)});
+    }
+
+    // The writer kept going while we copied: slots it may have reused are torn
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t head_after = ring.head.load(std::memory_order_relaxed);
+
+    for (uint64_t index = start; index < head; ++index) {
+        if (index + ThreadRing::kCapacity <= head_after) {
+            ++state.dropped;
+            continue;
+        }
+        const Sample& sample = samples[index - start];
+        if (!sample.name) {
+            continue;
+        }
+        uint64_t ticks = sample.end >= sample.begin ? sample.end - sample.begin : 0;
+        auto it = state.zones.find(std::string_view(sample.name));
+        if (it == state.zones.end()) {
+            it = state.zones.emplace(sample.name, Accumulator{}).first;
+        }
+        it->second.count += 1;
+        it->second.total_ticks += ticks;
+        it->second.max_ticks = std::max(it->second.max_ticks, ticks);
+    }
+}
+
+void drain_all(Registry& state, bool accumulate) {
+    auto& rings = state.rings;
+    for (auto it = rings.begin(); it != rings.end();) {
+        bool retired = (*it)->retired.load(std::memory_order_acquire);
+        drain(state, **it, accumulate);
+        it = retired ? rings.erase(it) : it + 1;
+    }
+}
+
+} // namespace
+
+ThreadRing* detail::register_thread() {
+    auto ring = std::make_shared<ThreadRing>();
+    {
+        Registry& state = registry();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.rings.push_back(ring);
+    }
+    ring_owner.ring = ring;
+    return ring.get();
+}
+
+ProfileSnapshot collect() {
+    Registry& state = registry();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    drain_all(state, true);
+
+    ProfileSnapshot snapshot;
+    snapshot.dropped = state.dropped;
+    if (state.zones.empty()) {
+        return snapshot;  // Nothing recorded: skip calibration
+    }
+    snapshot.ticks_per_ns = calibrate(state);
+
+    snapshot.zones.reserve(state.zones.size());
+    for (const auto& [name, accumulator] : state.zones) {
+        snapshot.zones.push_back(ZoneStats{
+            .name = name,
+            .count = accumulator.count,
+            .total_ns = static_cast<uint64_t>(static_cast<double>(accumulator.total_ticks) / snapshot.ticks_per_ns),
+            .max_ns = static_cast<uint64_t>(static_cast<double>(accumulator.max_ticks) / snapshot.ticks_per_ns)
+        });
+    }
+    return snapshot;
+}
+
+void reset() {
+    Registry& state = registry();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    drain_all(state, false);
+    state.zones.clear();
+    state.dropped = 0;
+}
+
+} // namespace nx::profile
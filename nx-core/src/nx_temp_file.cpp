@@ -0,0 +1,27 @@
+#include "nx_temp_file.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace nx::core {
+
+std::filesystem::path unique_temp_path(const std::filesystem::path& path) {
+    static std::atomic<uint64_t> counter{0};
+#if defined(_WIN32)
+    auto pid = static_cast<long long>(_getpid());
+#else
+    auto pid = static_cast<long long>(::getpid());
+#endif
+    auto temp_path = path;
+    temp_path += ".tmp." + std::to_string(pid) + "." +
+                 std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+    return temp_path;
+}
+
+} // namespace nx::core
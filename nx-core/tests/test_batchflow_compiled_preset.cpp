@@ -0,0 +1,253 @@
+#include "../include/nx_batchflow_compiled_preset.h"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace nx::batchflow;
+
+static BatchFlowPreset create_sample_preset() {
+    BatchFlowPreset preset(PresetVersion::current(), "Compiled sample", "Three-stage pipeline");
+    preset.add_job(PresetJobDefinition("decode", "nx_convert_pro", "decode", "{\"in\":\"a.mp4\"}",
+                                       {}, {"raw_video", "raw_audio"}));
+    preset.add_job(PresetJobDefinition("normalize", "nx_audiolab", "normalize", "{\"lufs\":-23}",
+                                       {"raw_audio"}, {"normalized_audio"}));
+    preset.add_job(PresetJobDefinition("mux", "nx_convert_pro", "mux", "{}",
+                                       {"raw_video", "normalized_audio"}, {"final"}));
+    preset.add_dependency(PresetDependency("decode", "normalize"));
+    preset.add_dependency(PresetDependency("decode", "mux"));
+    preset.add_dependency(PresetDependency("normalize", "mux"));
+    preset.add_retry_policy(PresetRetryPolicy("normalize", 3, 2, {"Failed"}));
+    return preset;
+}
+
+static std::filesystem::path temp_image(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / ("nx_compiled_preset_" + name + ".nxp");
+    std::filesystem::remove(path);
+    return path;
+}
+
+void test_compiled_preset_round_trip() {
+    std::cout << "Testing compiled preset round trip...\n";
+
+    auto preset = create_sample_preset();
+    auto path = temp_image("round_trip");
+    CompiledPreset::compile_to_file(preset, path);
+
+    auto compiled = CompiledPreset::open(path);
+    assert(compiled.version() == preset.version());
+    assert(compiled.name() == "Compiled sample");
+    assert(compiled.is_valid());
+    assert(compiled.validation_errors().empty());
+    assert(compiled.job_count() == 3);
+    assert(compiled.dependency_count() == 3);
+    assert(compiled.to_preset() == preset);
+
+    std::filesystem::remove(path);
+    std::cout << "✓ Compiled preset reproduces source preset\n";
+}
+
+void test_concurrent_compiles_use_private_temp_files() {
+    std::cout << "Testing concurrent compiles to one path...\n";
+
+    auto preset = create_sample_preset();
+    auto path = temp_image("concurrent");
+    std::vector<std::thread> writers;
+    std::atomic<size_t> failures{0};
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([&] {
+            for (int round = 0; round < 20; ++round) {
+                try {
+                    CompiledPreset::compile_to_file(preset, path);
+                } catch (...) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    assert(failures == 0);
+    assert(CompiledPreset::open(path).to_preset() == preset);
+
+    for (const auto& entry : std::filesystem::directory_iterator(path.parent_path())) {
+        assert(!entry.path().filename().string().starts_with(path.filename().string() + ".tmp"));
+    }
+
+    std::filesystem::remove(path);
+    std::cout << "✓ Each compile renames only its own complete image\n";
+}
+
+void test_compiled_preset_indexes_and_csr() {
+    std::cout << "Testing compiled preset indexes and adjacency...\n";
+
+    auto preset = create_sample_preset();
+    auto compiled = CompiledPreset::from_bytes(CompiledPreset::compile(preset));
+
+    auto decode = compiled.find_job("decode");
+    auto normalize = compiled.find_job("normalize");
+    auto mux = compiled.find_job("mux");
+    assert(decode && normalize && mux);
+    assert(!compiled.find_job("missing"));
+
+    auto mux_deps = compiled.dependencies_of(*mux);
+    assert(mux_deps.size() == 2);
+    assert(compiled.dependencies_of(*decode).empty());
+    assert(compiled.dependents_of(*decode).size() == 2);
+
+    // Precomputed JobIds match content hashing
+    const auto& source = preset.jobs().at("mux");
+    JobDefinition definition(source.engine_identifier, source.api_operation, source.parameters_blob,
+                             {ArtifactId("raw_video"), ArtifactId("normalized_audio")}, {ArtifactId("final")});
+    assert(compiled.job_id(*mux) == JobIdHasher::compute_job_id(definition));
+
+    auto view = compiled.job(*mux);
+    assert(view.input_artifacts.size() == 2);
+    assert(view.input_artifacts[0] == "raw_video");
+
+    auto policy = compiled.retry_policy(*normalize);
+    assert(policy && policy->max_attempts == 3);
+    assert(!compiled.retry_policy(*mux));
+
+    // Graph built from compiled image matches graph built from definitions
+    auto graph = compiled.to_job_graph();
+    assert(graph.node_count() == 3);
+    assert(graph.get_dependencies(compiled.job_id(*mux)).size() == 2);
+
+    std::cout << "✓ Compiled indexes, digests and CSR adjacency are consistent\n";
+}
+
+void test_compiled_preset_records_validation_errors() {
+    std::cout << "Testing compiled validation result...\n";
+
+    BatchFlowPreset preset(PresetVersion::current(), "invalid", "");
+    preset.add_job(PresetJobDefinition("a", "e", "op", "{}", {}, {}));
+    preset.add_dependency(PresetDependency("a", "ghost"));
+
+    auto compiled = CompiledPreset::from_bytes(CompiledPreset::compile(preset));
+    assert(!compiled.is_valid());
+    auto errors = compiled.validation_errors();
+    assert(errors.size() == preset.validate().size());
+    assert(errors[0] == preset.validate()[0]);
+    assert(compiled.dependency_count() == 0);  // Dangling edge has no dense index
+
+    std::cout << "✓ Validation result is captured at compile time\n";
+}
+
+static std::filesystem::path write_source(const std::string& name, const std::string& text) {
+    auto path = std::filesystem::temp_directory_path() / ("nx_compiled_preset_" + name + ".json");
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << text;
+    return path;
+}
+
+void test_needs_recompile() {
+    std::cout << "Testing recompile decisions...\n";
+
+    auto preset = create_sample_preset();
+    auto path = temp_image("recompile");
+    auto source = write_source("recompile", preset.to_json());
+
+    assert(CompiledPreset::needs_recompile(path, source));
+    CompiledPreset::compile_file(source, path);
+    assert(!CompiledPreset::needs_recompile(path, source));
+    assert(CompiledPreset::open(path).to_preset() == preset);
+
+    // Any source byte edit makes the image stale; the source is never parsed
+    write_source("recompile", preset.to_json() + " ");
+    assert(CompiledPreset::needs_recompile(path, source));
+    write_source("recompile", "not json at all");
+    assert(CompiledPreset::needs_recompile(path, source));
+
+    // Missing source always recompiles
+    std::filesystem::remove(source);
+    assert(CompiledPreset::needs_recompile(path, source));
+
+    // Incompatible schema major version always recompiles
+    BatchFlowPreset future(PresetVersion(PresetVersion::current().major + 1, 0, 0), "future", "");
+    source = write_source("recompile", future.to_json());
+    CompiledPreset::compile_file(source, path);
+    assert(CompiledPreset::needs_recompile(path, source));
+    source = write_source("recompile", preset.to_json());
+
+    // Corrupted image is rejected on open and triggers recompile
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "not a compiled preset";
+    }
+    bool threw = false;
+    try {
+        CompiledPreset::open(path);
+    } catch (const CompiledPresetError&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(CompiledPreset::needs_recompile(path, source));
+
+    // Truncated image fails section bounds check
+    auto bytes = CompiledPreset::compile(preset);
+    threw = false;
+    try {
+        CompiledPreset::from_bytes(bytes.substr(0, bytes.size() / 2));
+    } catch (const CompiledPresetError&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(source);
+    std::cout << "✓ Recompile needed exactly when image is stale or incompatible\n";
+}
+
+void test_corrupt_adjacency_target() {
+    std::cout << "Testing corrupt adjacency targets...\n";
+
+    auto bytes = CompiledPreset::compile(create_sample_preset());
+
+    // Section table follows magic, ten uint32 fields and three string refs
+    constexpr size_t kSectionTable = 8 + 10 * sizeof(uint32_t) + 3 * 2 * sizeof(uint32_t);
+    constexpr size_t kDownstreamTargets = 6;
+    uint64_t targets_offset = 0;
+    std::memcpy(&targets_offset, bytes.data() + kSectionTable + kDownstreamTargets * 2 * sizeof(uint64_t),
+                sizeof(targets_offset));
+    uint32_t bad_target = 1000;
+    std::memcpy(bytes.data() + targets_offset, &bad_target, sizeof(bad_target));
+
+    // Header-only open accepts the image; access reports the corruption
+    auto compiled = CompiledPreset::from_bytes(bytes);
+    bool threw = false;
+    try {
+        compiled.to_preset();
+    } catch (const CompiledPresetError&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        compiled.to_job_graph();
+    } catch (const CompiledPresetError&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✓ Out-of-range adjacency targets raise CompiledPresetError\n";
+}
+
+int main() {
+    std::cout << "=== BatchFlow Compiled Preset Tests ===\n\n";
+
+    test_compiled_preset_round_trip();
+    test_concurrent_compiles_use_private_temp_files();
+    test_compiled_preset_indexes_and_csr();
+    test_compiled_preset_records_validation_errors();
+    test_needs_recompile();
+    test_corrupt_adjacency_target();
+
+    std::cout << "\n=== All compiled preset tests passed ===\n";
+    return 0;
+}
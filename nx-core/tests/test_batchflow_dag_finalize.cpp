@@ -0,0 +1,201 @@
+#include "../include/nx_batchflow_dag.h"
+#include <cassert>
+#include <iostream>
+
+using namespace nx::batchflow;
+
+static JobDefinition make_definition(const std::string& op, std::vector<std::string> inputs,
+                                     std::vector<std::string> outputs) {
+    std::vector<ArtifactId> in, out;
+    for (auto& a : inputs) in.emplace_back(std::move(a));
+    for (auto& a : outputs) out.emplace_back(std::move(a));
+    return JobDefinition("engine", op, "{}", std::move(in), std::move(out));
+}
+
+static JobId id_of(const JobDefinition& definition) {
+    return JobIdHasher::compute_job_id(definition);
+}
+
+void test_artifact_dependencies_inferred() {
+    std::cout << "Testing artifact dependency inference...\n";
+
+    auto decode = make_definition("decode", {"source.mp4"}, {"video", "audio"});
+    auto grade = make_definition("grade", {"video"}, {"graded"});
+    auto mix = make_definition("mix", {"audio"}, {"mixed"});
+    auto mux = make_definition("mux", {"graded", "mixed"}, {"out"});
+
+    JobGraph graph;
+    for (const auto& d : {mux, mix, grade, decode}) {
+        graph.add_job_definition(d);
+    }
+    GraphFinalizeOptions options;
+    options.infer_artifact_dependencies = true;
+    graph.finalize(options);
+
+    assert(graph.dependency_count() == 4);
+    assert(graph.get_dependencies(id_of(decode)).empty());  // source.mp4 is external
+    assert(graph.get_dependencies(id_of(grade)) == std::vector<JobId>{id_of(decode)});
+    assert(graph.get_dependencies(id_of(mux)).size() == 2);
+    assert(graph.get_dependents(id_of(decode)).size() == 2);
+
+    std::cout << "✓ Producer -> consumer edges come from artifact ids\n";
+}
+
+void test_inference_with_reduction_minimizes_edges() {
+    std::cout << "Testing inferred edges with transitive reduction...\n";
+
+    // c consumes both a's and b's output, b consumes a's: a -> c is implied
+    auto a = make_definition("a", {}, {"x"});
+    auto b = make_definition("b", {"x"}, {"y"});
+    auto c = make_definition("c", {"x", "y"}, {"z"});
+
+    JobGraph graph;
+    graph.add_job_definition(a);
+    graph.add_job_definition(b);
+    graph.add_job_definition(c);
+    graph.add_dependency(JobDependency(id_of(a), id_of(b)));  // Redundant with inference
+    graph.finalize(GraphFinalizeOptions::inferred());
+
+    assert(graph.dependency_count() == 2);
+    assert(graph.dependencies()[0] == JobDependency(id_of(a), id_of(b)));
+    assert(graph.dependencies()[1] == JobDependency(id_of(b), id_of(c)));
+    assert(graph.get_dependencies(id_of(c)) == std::vector<JobId>{id_of(b)});
+
+    std::cout << "✓ Only the minimal edge set remains\n";
+}
+
+void test_inference_rejects_ambiguous_producers() {
+    std::cout << "Testing ambiguous artifact producers...\n";
+
+    JobGraph graph;
+    graph.add_job_definition(make_definition("a", {}, {"shared"}));
+    graph.add_job_definition(make_definition("b", {}, {"shared"}));
+
+    bool threw = false;
+    try {
+        graph.finalize(GraphFinalizeOptions::inferred());
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(!graph.is_finalized());
+
+    // Without inference the same graph is fine
+    graph.finalize();
+    assert(graph.dependency_count() == 0);
+
+    std::cout << "✓ Two producers of one artifact are rejected\n";
+}
+
+void test_default_finalize_keeps_declared_edges() {
+    std::cout << "Testing default finalize keeps declared edges...\n";
+
+    auto a = make_definition("a", {}, {"x"});
+    auto b = make_definition("b", {"x"}, {"y"});
+    auto c = make_definition("c", {"y"}, {});
+
+    JobGraph graph;
+    graph.add_job_definition(a);
+    graph.add_job_definition(b);
+    graph.add_job_definition(c);
+    graph.add_dependency(JobDependency(id_of(a), id_of(b)));
+    graph.add_dependency(JobDependency(id_of(b), id_of(c)));
+    graph.add_dependency(JobDependency(id_of(a), id_of(c)));
+    graph.finalize();
+
+    assert(graph.dependency_count() == 3);
+    assert(graph.get_dependencies(id_of(c)).size() == 2);
+
+    std::cout << "✓ Passes only run when requested\n";
+}
+
+void test_deduplication_and_report() {
+    std::cout << "Testing edge deduplication report...\n";
+
+    auto a = make_definition("a", {}, {});
+    auto b = make_definition("b", {}, {});
+    auto c = make_definition("c", {}, {});
+
+    auto build = [&]() {
+        JobGraph graph;
+        graph.add_job_definition(a);
+        graph.add_job_definition(b);
+        graph.add_job_definition(c);
+        graph.add_dependency(JobDependency(id_of(a), id_of(b)));
+        graph.add_dependency(JobDependency(id_of(a), id_of(b)));
+        graph.add_dependency(JobDependency(id_of(b), id_of(c)));
+        graph.add_dependency(JobDependency(id_of(a), id_of(c)));
+        graph.add_dependency(JobDependency(id_of(a), id_of(b)));
+        return graph;
+    };
+
+    GraphFinalizeOptions dedupe;
+    dedupe.deduplicate_edges = true;
+    auto deduped = build();
+    auto report = deduped.finalize(dedupe);
+    assert(report.duplicate_edges_removed == 2);
+    assert(report.transitive_edges_removed == 0);
+    assert(deduped.dependency_count() == 3);
+    assert(deduped.get_dependents(id_of(a)).size() == 2);
+
+    GraphFinalizeOptions reduce;
+    reduce.reduce_transitive_edges = true;
+    auto reduced = build();
+    report = reduced.finalize(reduce);
+    assert(report.duplicate_edges_removed == 2);
+    assert(report.transitive_edges_removed == 1);
+    assert(report.edges_removed() == 3);
+    assert(reduced.dependency_count() == 2);
+    assert(reduced.get_dependencies(id_of(c)) == std::vector<JobId>{id_of(b)});
+
+    // Second finalize is a no-op
+    assert(reduced.finalize(reduce).edges_removed() == 0);
+
+    std::cout << "✓ Removed edges are counted per pass\n";
+}
+
+void test_reduction_on_large_graph() {
+    std::cout << "Testing reduction on small and large graphs...\n";
+
+    // Chain with skip edges i -> i+2: every skip edge is implied by the chain
+    for (size_t count : {size_t{200}, size_t{20000}}) {
+        JobGraph graph;
+        std::vector<JobId> ids;
+        for (size_t i = 0; i < count; ++i) {
+            auto definition = make_definition("job_" + std::to_string(i), {}, {});
+            ids.push_back(id_of(definition));
+            graph.add_job_definition(definition);
+        }
+        for (size_t i = 0; i + 2 < count; ++i) {
+            graph.add_dependency(JobDependency(ids[i], ids[i + 2]));
+        }
+        for (size_t i = 0; i + 1 < count; ++i) {
+            graph.add_dependency(JobDependency(ids[i], ids[i + 1]));
+        }
+
+        GraphFinalizeOptions options;
+        options.reduce_transitive_edges = true;
+        auto report = graph.finalize(options);
+        assert(report.transitive_edges_removed == count - 2);
+        assert(graph.dependency_count() == count - 1);
+        for (size_t i = 1; i < count; ++i) {
+            assert(graph.get_dependencies(ids[i]) == std::vector<JobId>{ids[i - 1]});
+        }
+    }
+
+    std::cout << "✓ Blocked bitset reduction handles large graphs\n";
+}
+
+int main() {
+    std::cout << "=== BatchFlow DAG Finalize Tests ===\n\n";
+
+    test_artifact_dependencies_inferred();
+    test_inference_with_reduction_minimizes_edges();
+    test_inference_rejects_ambiguous_producers();
+    test_default_finalize_keeps_declared_edges();
+    test_deduplication_and_report();
+    test_reduction_on_large_graph();
+
+    std::cout << "\n=== All DAG finalize tests passed ===\n";
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include "../include/nx_batchflow_incremental.h"
+#include <cassert>
+#include <iostream>
+
+using namespace nx::batchflow;
+
+// Chain a -> b -> c plus independent d; parameters of one job may be tweaked
+static JobGraph build_graph(const std::string& b_params, bool link_d_to_c = false) {
+    JobDefinition a("engine", "op", "{\"job\":\"a\"}", {}, {ArtifactId("a_out")});
+    JobDefinition b("engine", "op", b_params, {ArtifactId("a_out")}, {ArtifactId("b_out")});
+    JobDefinition c("engine", "op", "{\"job\":\"c\"}", {ArtifactId("b_out")}, {ArtifactId("c_out")});
+    JobDefinition d("engine", "op", "{\"job\":\"d\"}", {}, {ArtifactId("d_out")});
+
+    JobGraph graph;
+    graph.add_job_definition(a);
+    graph.add_job_definition(b);
+    graph.add_job_definition(c);
+    graph.add_job_definition(d);
+
+    auto id_a = JobIdHasher::compute_job_id(a);
+    auto id_b = JobIdHasher::compute_job_id(b);
+    auto id_c = JobIdHasher::compute_job_id(c);
+    auto id_d = JobIdHasher::compute_job_id(d);
+    graph.add_dependency(JobDependency(id_a, id_b));
+    graph.add_dependency(JobDependency(id_b, id_c));
+    if (link_d_to_c) {
+        graph.add_dependency(JobDependency(id_d, id_c));
+    }
+    graph.finalize();
+    return graph;
+}
+
+static JobId id_of(const std::string& params, const std::vector<ArtifactId>& inputs,
+                   const std::vector<ArtifactId>& outputs) {
+    return JobIdHasher::compute_job_id(JobDefinition("engine", "op", params, inputs, outputs));
+}
+
+void test_identical_graphs_reuse_everything() {
+    std::cout << "Testing incremental plan for unchanged graph...\n";
+
+    auto previous = build_graph("{\"job\":\"b\"}");
+    auto revised = build_graph("{\"job\":\"b\"}");
+
+    auto plan = IncrementalPlanner::plan(previous, revised);
+    assert(plan.changed_jobs.empty());
+    assert(plan.reexecute_jobs.empty());
+    assert(plan.removed_jobs.empty());
+    assert(plan.reused_jobs.size() == 4);
+
+    std::cout << "✓ Unchanged graph requires no re-execution\n";
+}
+
+void test_parameter_change_reexecutes_downstream_closure() {
+    std::cout << "Testing downstream closure of a parameter change...\n";
+
+    auto previous = build_graph("{\"job\":\"b\"}");
+    auto revised = build_graph("{\"job\":\"b\",\"tweak\":1}");
+
+    auto id_a = id_of("{\"job\":\"a\"}", {}, {ArtifactId("a_out")});
+    auto old_b = id_of("{\"job\":\"b\"}", {ArtifactId("a_out")}, {ArtifactId("b_out")});
+    auto new_b = id_of("{\"job\":\"b\",\"tweak\":1}", {ArtifactId("a_out")}, {ArtifactId("b_out")});
+    auto id_c = id_of("{\"job\":\"c\"}", {ArtifactId("b_out")}, {ArtifactId("c_out")});
+    auto id_d = id_of("{\"job\":\"d\"}", {}, {ArtifactId("d_out")});
+
+    auto plan = IncrementalPlanner::plan(previous, revised);
+
+    // b is new by content; c keeps its JobId but its upstream set changed
+    assert(plan.changed_jobs.size() == 2);
+    assert(plan.reexecute_jobs.size() == 2);
+    assert(plan.requires_reexecution(new_b));
+    assert(plan.requires_reexecution(id_c));
+    assert(!plan.requires_reexecution(id_a));
+    assert(!plan.requires_reexecution(id_d));
+    assert(plan.removed_jobs == std::vector<JobId>{old_b});
+    assert(plan.reused_jobs.size() == 2);
+
+    std::cout << "✓ Only changed job and its dependents re-execute\n";
+}
+
+void test_prior_outcomes_seed_scheduler() {
+    std::cout << "Testing carried outcomes seed the scheduler...\n";
+
+    auto previous = build_graph("{\"job\":\"b\"}");
+
+    // Run the previous graph to completion, except d which fails
+    LogicalClock clock;
+    BatchFlowScheduler scheduler(previous, clock);
+    auto id_d = id_of("{\"job\":\"d\"}", {}, {ArtifactId("d_out")});
+    while (!scheduler.all_jobs_finished()) {
+        for (const auto& job_id : scheduler.next_ready_jobs()) {
+            scheduler.start_job(job_id);
+            if (job_id == id_d) {
+                scheduler.mark_failed(job_id, FailureCategory::EngineError);
+            } else {
+                scheduler.mark_completed(job_id);
+            }
+        }
+    }
+    auto prior = scheduler.get_all_statuses();
+
+    auto revised = build_graph("{\"job\":\"b\",\"tweak\":1}", true);
+    auto plan = IncrementalPlanner::plan(previous, revised, &prior);
+
+    // Failed d re-runs, c depends on d and changed b; a is carried forward
+    auto id_a = id_of("{\"job\":\"a\"}", {}, {ArtifactId("a_out")});
+    assert(plan.reused_jobs == std::vector<JobId>{id_a});
+    assert(plan.carried_outcomes.size() == 1);
+    assert(plan.reexecute_jobs.size() == 3);
+    assert(plan.requires_reexecution(id_d));
+
+    LogicalClock revised_clock;
+    BatchFlowScheduler revised_scheduler(revised, revised_clock);
+    plan.apply_to(revised_scheduler);
+    assert(revised_scheduler.count_completed() == 1);
+    assert(revised_scheduler.count_pending() == 3);
+    assert(revised_scheduler.get_job_status(id_a) == prior.at(id_a));
+
+    // Ready set excludes the carried job
+    for (const auto& job_id : revised_scheduler.next_ready_jobs()) {
+        assert(plan.requires_reexecution(job_id));
+    }
+
+    std::cout << "✓ Carried outcomes leave only the re-execution set pending\n";
+}
+
+void test_preset_affected_jobs() {
+    std::cout << "Testing preset-level affected job closure...\n";
+
+    BatchFlowPreset previous(PresetVersion::current(), "p", "d");
+    previous.add_job(PresetJobDefinition("decode", "e", "op", "{}", {}, {"raw"}));
+    previous.add_job(PresetJobDefinition("filter", "e", "op", "{\"gain\":1}", {"raw"}, {"filtered"}));
+    previous.add_job(PresetJobDefinition("encode", "e", "op", "{}", {"filtered"}, {"out"}));
+    previous.add_job(PresetJobDefinition("thumb", "e", "op", "{}", {"raw"}, {"thumb"}));
+    previous.add_dependency(PresetDependency("decode", "filter"));
+    previous.add_dependency(PresetDependency("filter", "encode"));
+    previous.add_dependency(PresetDependency("decode", "thumb"));
+
+    auto revised = previous;
+    assert(IncrementalPlanner::affected_jobs(previous, revised).empty());
+    assert(previous.diff(revised).empty());
+
+    revised.add_job(PresetJobDefinition("filter", "e", "op", "{\"gain\":2}", {"raw"}, {"filtered"}));
+    auto affected = IncrementalPlanner::affected_jobs(previous, revised);
+    assert((affected == std::set<std::string>{"encode", "filter"}));
+
+    auto differences = previous.diff(revised);
+    assert(differences.size() == 1);
+    assert(differences[0] == "Job modified: filter (parameters_blob)");
+
+    // Retry policy change affects the job and its dependents only
+    auto retried = previous;
+    retried.add_retry_policy(PresetRetryPolicy("decode", 3, 1, {"Failed"}));
+    affected = IncrementalPlanner::affected_jobs(previous, retried);
+    assert(affected.size() == 4);
+    assert(previous.diff(retried) == std::vector<std::string>{"Retry policy added: decode"});
+
+    std::cout << "✓ Preset edits map to minimal affected job sets\n";
+}
+
+int main() {
+    std::cout << "=== BatchFlow Incremental Planning Tests ===\n\n";
+
+    test_identical_graphs_reuse_everything();
+    test_parameter_change_reexecutes_downstream_closure();
+    test_prior_outcomes_seed_scheduler();
+    test_preset_affected_jobs();
+
+    std::cout << "\n=== All incremental planning tests passed ===\n";
+    return 0;
+}
@@ -0,0 +1,180 @@
+#include "../include/nx_batchflow_preset.h"
+#include "../include/nx_batchflow_json.h"
+#include <cassert>
+#include <iostream>
+
+using namespace nx::batchflow;
+
+static BatchFlowPreset create_sample_preset() {
+    BatchFlowPreset preset(PresetVersion(1, 2, 3), "Sample \"quoted\" preset", "Line one\nLine two\t\\ end");
+
+    preset.add_job(PresetJobDefinition(
+        "encode", "nx_convert_pro", "encode",
+        "{\"codec\":\"h264\",\"crf\":18}",
+        {"decoded_video"}, {"encoded_video"}));
+    preset.add_job(PresetJobDefinition(
+        "decode", "nx_convert_pro", "decode",
+        "{\"input\":\"caf\xC3\xA9.mp4\"}",
+        {}, {"decoded_video"}));
+    preset.add_dependency(PresetDependency("decode", "encode"));
+    preset.add_retry_policy(PresetRetryPolicy("encode", 3, 5, {"Failed"}));
+
+    return preset;
+}
+
+void test_preset_json_round_trip() {
+    std::cout << "Testing preset JSON round trip...\n";
+
+    auto preset = create_sample_preset();
+    auto json = preset.to_json();
+    auto restored = BatchFlowPreset::from_json(json);
+
+    assert(restored == preset);
+    assert(restored.to_json() == json);
+
+    std::cout << "✓ Preset survives JSON round trip\n";
+}
+
+void test_preset_json_is_canonical() {
+    std::cout << "Testing canonical preset JSON...\n";
+
+    // Insertion order must not affect output
+    BatchFlowPreset a(PresetVersion::current(), "p", "");
+    a.add_job(PresetJobDefinition("x", "e", "op", "{}", {}, {}));
+    a.add_job(PresetJobDefinition("y", "e", "op", "{}", {}, {}));
+    BatchFlowPreset b(PresetVersion::current(), "p", "");
+    b.add_job(PresetJobDefinition("y", "e", "op", "{}", {}, {}));
+    b.add_job(PresetJobDefinition("x", "e", "op", "{}", {}, {}));
+    assert(a.to_json() == b.to_json());
+
+    assert(a.to_json() ==
+        "{\"version\":\"1.0.0\",\"name\":\"p\",\"description\":\"\","
+        "\"jobs\":["
+        "{\"job_name\":\"x\",\"engine_identifier\":\"e\",\"api_operation\":\"op\",\"parameters_blob\":\"{}\","
+        "\"input_artifacts\":[],\"output_artifacts\":[]},"
+        "{\"job_name\":\"y\",\"engine_identifier\":\"e\",\"api_operation\":\"op\",\"parameters_blob\":\"{}\","
+        "\"input_artifacts\":[],\"output_artifacts\":[]}"
+        "],\"dependencies\":[],\"retry_policies\":[]}");
+
+    std::cout << "✓ Preset JSON is canonical\n";
+}
+
+void test_preset_json_accepts_reordered_whitespace_input() {
+    std::cout << "Testing lenient preset JSON input...\n";
+
+    std::string json = R"({
+        "retry_policies": [],
+        "unknown_field": {"nested": [1, 2.5e3, "}", true, null]},
+        "name": "esc\u00e9\ud83d\ude00",
+        "version": "1.0.0",
+        "jobs": [ { "engine_identifier": "e", "job_name": "j", "api_operation": "op",
+                    "parameters_blob": "{\"k\":\"v\\\\\"}", "input_artifacts": ["a"], "output_artifacts": [] } ],
+        "dependencies": []
+    })";
+
+    auto preset = BatchFlowPreset::from_json(json);
+    assert(preset.name() == "esc\xC3\xA9\xF0\x9F\x98\x80");
+    assert(preset.jobs().size() == 1);
+    assert(preset.jobs().at("j").parameters_blob == "{\"k\":\"v\\\\\"}");
+    assert(preset.jobs().at("j").input_artifacts == std::vector<std::string>{"a"});
+
+    std::cout << "✓ Reader handles whitespace, key order, escapes and unknown keys\n";
+}
+
+void test_preset_json_rejects_malformed_input() {
+    std::cout << "Testing malformed preset JSON rejection...\n";
+
+    const std::vector<std::string> malformed = {
+        "",
+        "{",
+        "{\"version\":\"1.0.0\"}",                                  // missing name
+        "{\"name\":\"p\"}",                                         // missing version
+        "{\"version\":\"1.0\",\"name\":\"p\"}",                     // bad version
+        "{\"version\":\"1.0.0\",\"name\":\"p\",}",                  // trailing comma
+        "{\"version\":\"1.0.0\",\"name\":\"p\"} extra",             // trailing content
+        "{\"version\":\"1.0.0\",\"name\":\"p\",\"jobs\":[{}]}",     // job without name
+        "{\"version\":\"1.0.0\",\"name\":\"bad\\q\"}",              // invalid escape
+        "{\"version\":\"1.0.0\",\"name\":\"p\",\"retry_policies\":[{\"job_name\":\"j\",\"max_attempts\":99999999999}]}"
+    };
+
+    for (const auto& input : malformed) {
+        bool threw = false;
+        try {
+            BatchFlowPreset::from_json(input);
+        } catch (const JsonParseError&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    std::cout << "✓ Malformed preset JSON is rejected\n";
+}
+
+void test_writer_escaping_across_vector_blocks() {
+    std::cout << "Testing JsonWriter escaping across vector blocks...\n";
+
+    // Specials at every offset of a 70-byte string cross 16- and 32-byte block edges
+    for (size_t at = 0; at < 70; ++at) {
+        for (char special : {'"', '\\', '\b', '\f', '\n', '\x01', '\x1f'}) {
+            std::string text(70, 'x');
+            text[at] = special;
+            std::string expected = "\"" + std::string(at, 'x');
+            switch (special) {
+                case '"':  expected += "\\\""; break;
+                case '\\': expected += "\\\\"; break;
+                case '\b': expected += "\\b"; break;
+                case '\f': expected += "\\f"; break;
+                case '\n': expected += "\\n"; break;
+                case '\x01': expected += "\\u0001"; break;
+                default:   expected += "\\u001f"; break;
+            }
+            expected += std::string(69 - at, 'x') + "\"";
+
+            std::string out;
+            JsonWriter writer(out);
+            writer.value(std::string_view(text));
+            assert(out == expected);
+        }
+    }
+
+    // UTF-8 and DEL pass through unescaped
+    std::string out;
+    JsonWriter writer(out);
+    writer.value("caf\xC3\xA9 \x7f");
+    assert(out == "\"caf\xC3\xA9 \x7f\"");
+
+    std::cout << "✓ Canonical escaping is block-boundary safe\n";
+}
+
+void test_version_from_string() {
+    std::cout << "Testing PresetVersion parsing...\n";
+
+    assert(PresetVersion::from_string("2.10.0") == PresetVersion(2, 10, 0));
+    assert(PresetVersion::from_string(PresetVersion::current().to_string()) == PresetVersion::current());
+
+    for (const char* bad : {"", "1", "1.2", "1.2.3.4", "a.b.c", "1..2", "1.2.", "-1.0.0"}) {
+        bool threw = false;
+        try {
+            PresetVersion::from_string(bad);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    std::cout << "✓ PresetVersion parsing is strict\n";
+}
+
+int main() {
+    std::cout << "=== BatchFlow Preset JSON Tests ===\n\n";
+
+    test_preset_json_round_trip();
+    test_preset_json_is_canonical();
+    test_preset_json_accepts_reordered_whitespace_input();
+    test_preset_json_rejects_malformed_input();
+    test_writer_escaping_across_vector_blocks();
+    test_version_from_string();
+
+    std::cout << "\n=== All preset JSON tests passed ===\n";
+    return 0;
+}
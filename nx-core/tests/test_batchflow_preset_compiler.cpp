@@ -0,0 +1,172 @@
+#include "../include/nx_batchflow_preset_compiler.h"
+#include <cassert>
+#include <iostream>
+#include <map>
+
+using namespace nx::batchflow;
+
+static BatchFlowPreset create_diamond_preset() {
+    BatchFlowPreset preset(PresetVersion::current(), "diamond", "");
+    preset.add_job(PresetJobDefinition("decode", "nx_convert_pro", "decode", "{}", {}, {"video", "audio"}));
+    preset.add_job(PresetJobDefinition("grade", "nx_convert_pro", "grade", "{\"lut\":\"a\"}", {"video"}, {"graded"}));
+    preset.add_job(PresetJobDefinition("mix", "nx_audiolab", "mix", "{}", {"audio"}, {"mixed"}));
+    preset.add_job(PresetJobDefinition("mux", "nx_convert_pro", "mux", "{}", {"mixed", "graded"}, {"out"}));
+    preset.add_dependency(PresetDependency("decode", "grade"));
+    preset.add_dependency(PresetDependency("decode", "mix"));
+    preset.add_dependency(PresetDependency("grade", "mux"));
+    preset.add_dependency(PresetDependency("mix", "mux"));
+    return preset;
+}
+
+// Reference path: one JobDefinition, add_node and add_dependency per element
+static JobGraph build_graph_incrementally(const BatchFlowPreset& preset, std::map<std::string, JobId>& ids) {
+    JobGraph graph;
+    for (const auto& [name, job] : preset.jobs()) {
+        std::vector<ArtifactId> inputs, outputs;
+        for (const auto& a : job.input_artifacts) inputs.emplace_back(a);
+        for (const auto& a : job.output_artifacts) outputs.emplace_back(a);
+        JobDefinition definition(job.engine_identifier, job.api_operation, job.parameters_blob,
+                                 std::move(inputs), std::move(outputs));
+        JobNode node = JobNode::from_definition(definition);
+        ids.emplace(name, node.id());
+        graph.add_node(std::move(node));
+    }
+    for (const auto& dep : preset.dependencies()) {
+        graph.add_dependency(JobDependency(ids.at(dep.from_job), ids.at(dep.to_job)));
+    }
+    graph.finalize();
+    return graph;
+}
+
+void test_compile_matches_incremental_construction() {
+    std::cout << "Testing bulk compile against incremental construction...\n";
+
+    auto preset = create_diamond_preset();
+    std::map<std::string, JobId> ids;
+    auto expected = build_graph_incrementally(preset, ids);
+    auto graph = compile_preset(preset);
+
+    assert(graph.is_finalized());
+    assert(graph.node_count() == expected.node_count());
+    assert(graph.dependency_count() == expected.dependency_count());
+    for (size_t i = 0; i < graph.node_count(); ++i) {
+        const auto& id = graph.nodes()[i].id();
+        assert(id == expected.nodes()[i].id());
+        assert(graph.get_dependencies(id) == expected.get_dependencies(id));
+        assert(graph.get_dependents(id) == expected.get_dependents(id));
+    }
+    assert(graph.get_dependencies(ids.at("mux")).size() == 2);
+    assert(graph.get_node(ids.at("mix"))->engine_name() == "nx_audiolab");
+
+    std::cout << "✓ Bulk compile produces the same graph\n";
+}
+
+void test_preset_job_id_matches_hasher() {
+    std::cout << "Testing direct preset job hashing...\n";
+
+    PresetJobDefinition job("j", "engine", "op", "{\"x\":1}", {"zeta", "alpha", "mid"}, {"b", "a"});
+    JobDefinition definition("engine", "op", "{\"x\":1}",
+                             {ArtifactId("zeta"), ArtifactId("alpha"), ArtifactId("mid")},
+                             {ArtifactId("b"), ArtifactId("a")});
+    assert(compute_preset_job_id(job) == JobIdHasher::compute_job_id(definition));
+
+    PresetJobDefinition bare("k", "engine", "op", "", {}, {});
+    assert(compute_preset_job_id(bare) == JobIdHasher::compute_job_id(JobDefinition("engine", "op", "", {}, {})));
+
+    std::cout << "✓ Direct hashing matches JobIdHasher\n";
+}
+
+void test_parallel_compile_is_deterministic() {
+    std::cout << "Testing parallel compile determinism...\n";
+
+    BatchFlowPreset preset(PresetVersion::current(), "wide", "");
+    for (int i = 0; i < 300; ++i) {
+        std::string name = "job_" + std::to_string(i);
+        preset.add_job(PresetJobDefinition(name, "e", "op", "{\"i\":" + std::to_string(i) + "}", {}, {}));
+        if (i > 0) {
+            preset.add_dependency(PresetDependency("job_" + std::to_string(i / 2), name));
+        }
+    }
+
+    auto serial = compile_preset(preset, PresetCompileOptions{1, 0});
+    auto parallel = compile_preset(preset, PresetCompileOptions{7, 0});
+    assert(serial.node_count() == parallel.node_count());
+    for (size_t i = 0; i < serial.node_count(); ++i) {
+        assert(serial.nodes()[i].id() == parallel.nodes()[i].id());
+    }
+    for (size_t i = 0; i < serial.dependency_count(); ++i) {
+        assert(serial.dependencies()[i] == parallel.dependencies()[i]);
+    }
+
+    std::cout << "✓ Worker count does not change the compiled graph\n";
+}
+
+void test_invalid_input_rejected() {
+    std::cout << "Testing invalid compile input...\n";
+
+    BatchFlowPreset preset(PresetVersion::current(), "cyclic", "");
+    preset.add_job(PresetJobDefinition("a", "e", "op", "{}", {}, {}));
+    preset.add_job(PresetJobDefinition("b", "e", "op", "{}", {}, {}));
+    preset.add_dependency(PresetDependency("a", "b"));
+    preset.add_dependency(PresetDependency("b", "a"));
+
+    bool threw = false;
+    try {
+        compile_preset(preset);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    auto node = [](const char* engine) { return JobNode::from_definition(JobDefinition(engine, "op", "{}", {}, {})); };
+
+    threw = false;
+    try {
+        JobGraph::from_dense_edges({node("a"), node("b")}, {DenseEdge{0, 2}});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        JobGraph::from_dense_edges({node("a"), node("b")}, {DenseEdge{0, 1}, DenseEdge{1, 0}});
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✓ Invalid presets and edges are rejected\n";
+}
+
+void test_finalize_keeps_external_endpoints() {
+    std::cout << "Testing finalize with external dependency endpoints...\n";
+
+    auto a = JobNode::from_definition(JobDefinition("a", "op", "{}", {}, {}));
+    auto external = JobId::from_content_hash("external");
+
+    JobGraph graph;
+    graph.add_node(a);
+    graph.add_dependency(JobDependency(external, a.id()));
+    assert(graph.is_acyclic());
+    graph.finalize();
+
+    assert(graph.get_dependencies(a.id()) == std::vector<JobId>{external});
+    assert(graph.get_dependents(external) == std::vector<JobId>{a.id()});
+    assert(graph.get_node(external) == nullptr);
+
+    std::cout << "✓ Dependencies on non-node endpoints stay queryable\n";
+}
+
+int main() {
+    std::cout << "=== BatchFlow Preset Compiler Tests ===\n\n";
+
+    test_compile_matches_incremental_construction();
+    test_preset_job_id_matches_hasher();
+    test_parallel_compile_is_deterministic();
+    test_invalid_input_rejected();
+    test_finalize_keeps_external_endpoints();
+
+    std::cout << "\n=== All preset compiler tests passed ===\n";
+    return 0;
+}
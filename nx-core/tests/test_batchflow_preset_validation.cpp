@@ -0,0 +1,136 @@
+#include "../include/nx_batchflow_preset.h"
+#include <cassert>
+#include <iostream>
+
+using namespace nx::batchflow;
+
+static PresetJobDefinition make_job(const std::string& name) {
+    return PresetJobDefinition(name, "nx_convert_pro", "transcode", "{}", {}, {});
+}
+
+void test_errors_reported_in_deterministic_order() {
+    std::cout << "Testing validation error order...\n";
+
+    BatchFlowPreset preset(PresetVersion(2, 0, 0), "broken", "");
+    preset.add_job(make_job("a"));
+    preset.add_job(PresetJobDefinition("b", "", "op", "{}", {}, {}));
+    preset.add_job(make_job("c"));
+    preset.add_dependency(PresetDependency("a", "ghost"));
+    preset.add_dependency(PresetDependency("a", "c"));
+    preset.add_dependency(PresetDependency("c", "a"));
+    preset.add_retry_policy(PresetRetryPolicy("phantom", 0, 1, {"Failed"}));
+
+    const std::vector<std::string> expected = {
+        "Unsupported preset version: 2.0.0 (expected major version 1)",
+        "Job 'b' has empty engine_identifier",
+        "Dependency references unknown job: ghost",
+        "Dependency cycle detected among jobs: a, c",
+        "Retry policy references unknown job: phantom",
+        "Retry policy for 'phantom' must allow at least one attempt",
+    };
+    assert(preset.validate() == expected);
+
+    std::cout << "✓ Every error is reported in a stable order\n";
+}
+
+void test_every_cycle_reported() {
+    std::cout << "Testing multiple cycle reporting...\n";
+
+    BatchFlowPreset preset(PresetVersion::current(), "cycles", "");
+    for (const char* name : {"a", "b", "c", "d", "e", "f"}) {
+        preset.add_job(make_job(name));
+    }
+    preset.add_dependency(PresetDependency("e", "d"));
+    preset.add_dependency(PresetDependency("d", "e"));
+    preset.add_dependency(PresetDependency("b", "c"));
+    preset.add_dependency(PresetDependency("c", "a"));
+    preset.add_dependency(PresetDependency("a", "b"));
+    preset.add_dependency(PresetDependency("f", "f"));
+
+    const std::vector<std::string> expected = {
+        "Dependency cycle detected among jobs: a, b, c",
+        "Dependency cycle detected among jobs: d, e",
+        "Dependency cycle detected among jobs: f",
+    };
+    assert(preset.validate() == expected);
+
+    std::cout << "✓ Each cyclic component is reported once\n";
+}
+
+void test_deep_chain_validates_iteratively() {
+    std::cout << "Testing deep dependency chain...\n";
+
+    const size_t depth = 50000;
+    BatchFlowPreset preset(PresetVersion::current(), "deep", "");
+    for (size_t i = 0; i < depth; ++i) {
+        preset.add_job(make_job("job_" + std::to_string(i)));
+        if (i > 0) {
+            preset.add_dependency(PresetDependency("job_" + std::to_string(i - 1), "job_" + std::to_string(i)));
+        }
+    }
+    assert(preset.is_valid());
+
+    // Closing the chain produces one cycle spanning every job
+    preset.add_dependency(PresetDependency("job_" + std::to_string(depth - 1), "job_0"));
+    auto errors = preset.validate();
+    assert(errors.size() == 1);
+    assert(errors[0].rfind("Dependency cycle detected among jobs: job_0, job_1, ", 0) == 0);
+
+    std::cout << "✓ Deep chains validate without recursion\n";
+}
+
+void test_validation_is_memoized() {
+    std::cout << "Testing validation memoization...\n";
+
+    BatchFlowPreset preset(PresetVersion::current(), "memo", "");
+    preset.add_job(make_job("a"));
+
+    const auto& first = preset.validation_errors();
+    assert(&first == &preset.validation_errors());
+    assert(preset.is_valid());
+
+    // Mutation invalidates the cached result
+    preset.add_dependency(PresetDependency("a", "missing"));
+    assert(!preset.is_valid());
+
+    // Copies keep the cached result and stay independent
+    BatchFlowPreset copy = preset;
+    assert(copy.validate() == preset.validate());
+    copy.add_job(make_job("missing"));
+    assert(copy.is_valid());
+    assert(!preset.is_valid());
+
+    std::cout << "✓ Validation runs once per preset revision\n";
+}
+
+void test_static_validators_agree() {
+    std::cout << "Testing component validators...\n";
+
+    BatchFlowPreset preset(PresetVersion::current(), "parts", "");
+    preset.add_job(make_job("a"));
+    preset.add_job(make_job("b"));
+    preset.add_dependency(PresetDependency("a", "b"));
+    preset.add_dependency(PresetDependency("b", "a"));
+    preset.add_dependency(PresetDependency("b", "zzz"));
+
+    auto errors = PresetValidator::validate_dependencies(preset.jobs(), preset.dependencies());
+    assert(errors.size() == 2);
+    assert(errors[0] == "Dependency references unknown job: zzz");
+    assert(errors[1] == "Dependency cycle detected among jobs: a, b");
+    assert(PresetValidator::validate(preset) == preset.validate());
+
+    std::cout << "✓ Component validators match whole-preset validation\n";
+}
+
+int main() {
+    std::cout << "=== BatchFlow Preset Validation Tests ===\n\n";
+
+    test_errors_reported_in_deterministic_order();
+    test_every_cycle_reported();
+    test_deep_chain_validates_iteratively();
+    test_validation_is_memoized();
+    test_static_validators_agree();
+
+    std::cout << "\n=== All preset validation tests passed ===\n";
+    return 0;
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "DeterministicExecutionEngine.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace nx::batch {
+
+/**
+ * Producer behaviour when the observer bus ring is full
+ */
+enum class ObserverOverflowPolicy {
+    Drop,   // Discard the event and count it; execution never waits
+    Block   // Wait for the drain thread to free a slot; no event is lost
+};
+
+/**
+ * Configuration for AsyncObserverBus
+ */
+struct ObserverBusOptions {
+    size_t capacity = 4096;                                      // Ring slots (rounded up to a power of two)
+    ObserverOverflowPolicy overflow = ObserverOverflowPolicy::Drop; // Full-ring behaviour
+};
+
+/**
+ * Delivery statistics for one subscribed observer
+ */
+struct ObserverLagStats {
+    uint64_t delivered = 0;          // Events handed to this observer
+    uint64_t lag = 0;                // Enqueued events not yet handed to this observer
+    uint64_t max_lag = 0;            // Largest lag seen at delivery time
+    uint64_t total_delivery_ns = 0;  // Time spent inside this observer's callbacks
+    uint64_t max_delivery_ns = 0;    // Slowest single callback
+    uint64_t exceptions = 0;         // Callbacks that threw (swallowed by the bus)
+};
+
+/**
+ * Point-in-time accounting for AsyncObserverBus
+ *
+ * Every event offered to the bus is either enqueued or dropped:
+ *   offered == enqueued + dropped
+ */
+struct ObserverBusStats {
+    uint64_t enqueued = 0;                   // Events accepted into the ring
+    uint64_t dropped = 0;                    // Events discarded under Drop policy
+    uint64_t blocked = 0;                    // Events whose producer had to wait under Block policy
+    std::vector<ObserverLagStats> observers; // Per-observer delivery, in subscription order
+};
+
+/**
+ * Asynchronous fan-out of execution events to any number of observers
+ *
+ * DECOUPLING:
+ * - Is itself an ExecutionEngineObserver; pass it to DeterministicExecutionEngine
+ *   in place of a single observer
+ * - Producer side copies the event into a bounded lock-free ring (one CAS per
+ *   event, no locks, no allocation beyond the event copy) and returns
+ * - A dedicated drain thread delivers events to every observer in order
+ * - Slow observers accumulate lag instead of delaying execution
+ *
+ * TIMING:
+ * - Each event's ObservedEventContext (time and thread) is captured on the
+ *   producer thread at publication; TimedExecutionEngineObserver subscribers
+ *   receive it unchanged, so their timestamps and thread ids are those of
+ *   the execution thread, not the drain thread
+ * - Buses nest: an inner bus forwards the context it was given
+ *
+ * ORDERING:
+ * - Events from one producer thread are delivered in publication order
+ * - Each observer sees events in the same order
+ *
+ * CONSTRAINTS:
+ * - Observers are fixed at construction and must outlive the bus
+ * - Observers are called from the drain thread only, never concurrently
+ * - Destruction drains every enqueued event before joining the thread
+ */
+class AsyncObserverBus : public TimedExecutionEngineObserver {
+public:
+    explicit AsyncObserverBus(std::vector<ExecutionEngineObserver*> observers,
+                              ObserverBusOptions options = {});
+    ~AsyncObserverBus() override;
+
+    AsyncObserverBus(const AsyncObserverBus&) = delete;
+    AsyncObserverBus& operator=(const AsyncObserverBus&) = delete;
+
+    void observe_state_transition_at(const ExecutionTraceRecord& trace_record,
+                                     const ObservedEventContext& context) override;
+
+    void observe_execution_complete_at(const SessionId& session_id,
+                                       size_t total_jobs,
+                                       size_t successful_jobs,
+                                       const ObservedEventContext& context) override;
+
+    void observe_execution_halt_at(const SessionId& session_id,
+                                   const SessionJobId& failed_job_id,
+                                   size_t execution_index,
+                                   const ObservedEventContext& context) override;
+
+    /**
+     * Wait until every event enqueued before the call has been delivered
+     *
+     * Covers events from every producer thread, including slots claimed by
+     * other producers that are still being filled.
+     */
+    void flush();
+
+    /**
+     * Current overflow and lag accounting (safe from any thread)
+     */
+    ObserverBusStats stats() const;
+
+    const ObserverBusOptions& options() const;
+
+private:
+    enum class EventKind : uint8_t {
+        Transition,
+        Complete,
+        Halt
+    };
+
+    struct Event {
+        EventKind kind = EventKind::Transition;
+        ExecutionTraceRecord trace{};   // Transition only
+        SessionId session_id{};         // Complete / Halt
+        SessionJobId failed_job_id{};   // Halt only
+        size_t total_jobs = 0;          // Complete: total; Halt: execution index
+        size_t successful_jobs = 0;     // Complete only
+        ObservedEventContext context{}; // Producer time and thread
+    };
+
+    // Bounded MPSC ring cell; sequence encodes whether the slot is free or full
+    struct alignas(64) Cell {
+        std::atomic<size_t> sequence{0};
+        Event event;
+    };
+
+    struct alignas(64) ObserverSlot {
+        ExecutionEngineObserver* observer = nullptr;
+        TimedExecutionEngineObserver* timed = nullptr;  // Same observer when it takes event context
+        std::atomic<uint64_t> delivered{0};
+        std::atomic<uint64_t> max_lag{0};
+        std::atomic<uint64_t> total_delivery_ns{0};
+        std::atomic<uint64_t> max_delivery_ns{0};
+        std::atomic<uint64_t> exceptions{0};
+    };
+
+    ObserverBusOptions options_;                        // OWNED: Capacity and overflow policy
+    size_t mask_;                                       // OWNED: capacity - 1
+    std::unique_ptr<Cell[]> cells_;                     // OWNED: Ring storage
+    std::unique_ptr<ObserverSlot[]> observers_;         // OWNED: Subscribers and their lag
+    size_t observer_count_;                             // OWNED: Number of subscribers
+
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};    // Shared by producers
+    alignas(64) size_t dequeue_pos_ = 0;                // Drain thread only
+
+    std::atomic<uint64_t> enqueued_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> blocked_{0};
+    std::atomic<uint64_t> drained_{0};                  // Events fully fanned out (== dequeue_pos_ between events)
+    std::atomic<uint32_t> doorbell_{0};                 // Wakes the drain thread
+    std::atomic<bool> stopping_{false};
+
+    std::thread drain_thread_;
+
+    // Place event in the ring according to the overflow policy
+    void publish(Event&& event);
+
+    // Claim a free slot and move event into it; false when the ring is full
+    bool try_enqueue(Event& event);
+
+    // Take the oldest ready event; false when none is ready
+    bool try_dequeue(Event& event);
+
+    // Drain thread body
+    void drain_loop();
+
+    // Hand one event to every observer, recording lag and callback time
+    void deliver(const Event& event);
+};
+
+} // namespace nx::batch
@@ -3,12 +3,26 @@
 #include "ExecutionState.h"
 #include "ExecutionGraph.h"
 #include "JobExecutor.h"
+#include "ResultCache.h"
+#include <chrono>
 #include <vector>
 #include <functional>
 #include <memory>
+#include <thread>
 
 namespace nx::batch {
 
+/**
+ * Result cache disposition for a traced transition
+ * 
+ * Only terminal transitions of cache-enabled engines carry Hit or Miss.
+ */
+enum class CacheDisposition {
+    NotConsulted,   // No cache configured, or non-terminal transition
+    Hit,            // Result reused from cache, executor not invoked
+    Miss            // Executor invoked
+};
+
 /**
  * Execution trace record for deterministic observability
  * 
@@ -23,6 +37,8 @@ struct ExecutionTraceRecord {
     SessionJobId job_id;                        // REFERENCED: Job identity
     ExecutionState previous_state;              // COPIED: State before transition
     ExecutionState new_state;                   // COPIED: State after transition
+    CacheDisposition cache = CacheDisposition::NotConsulted; // OWNED: Result cache outcome
+    ComponentType component;                    // COPIED: Target component of the job spec
     
     bool operator==(const ExecutionTraceRecord& other) const = default;
 };
@@ -35,6 +51,11 @@ struct ExecutionTraceRecord {
  * - Observer cannot mutate execution state
  * - Observer cannot delay or influence execution
  * - Observer events do not affect determinism
+ * 
+ * Observers run synchronously on the execution thread; wrap slow observers
+ * in AsyncObserverBus so they are driven from a separate drain thread.
+ * Observers that need the time or thread of an event derive from
+ * TimedExecutionEngineObserver instead.
  */
 class ExecutionEngineObserver {
 public:
@@ -70,6 +91,76 @@ public:
                                        size_t execution_index) = 0;
 };
 
+/**
+ * When and where a monitoring event was emitted
+ * 
+ * MONITORING SEPARATION:
+ * - Wall-clock and thread data for observers only; never part of
+ *   ExecutionTraceRecord, so execution traces stay deterministic
+ */
+struct ObservedEventContext {
+    std::chrono::steady_clock::time_point emitted_at;  // COPIED: Time the engine emitted the event
+    std::thread::id thread;                            // COPIED: Thread that emitted the event
+    
+    /**
+     * Context of an event emitted by the calling thread now
+     */
+    static ObservedEventContext now() {
+        return {std::chrono::steady_clock::now(), std::this_thread::get_id()};
+    }
+};
+
+/**
+ * Observer that receives the emitting time and thread with every event
+ * 
+ * CONTEXT SOURCE:
+ * - Called directly by an engine, the context is taken on the execution
+ *   thread at the moment of the call
+ * - Behind AsyncObserverBus, the context is captured when the event is
+ *   published and delivered unchanged from the drain thread, so timing
+ *   observers may share one engine through the bus
+ */
+class TimedExecutionEngineObserver : public ExecutionEngineObserver {
+public:
+    /**
+     * Observe job state transition with its emitting context
+     */
+    virtual void observe_state_transition_at(const ExecutionTraceRecord& trace_record,
+                                             const ObservedEventContext& context) = 0;
+    
+    /**
+     * Observe execution completion with its emitting context
+     */
+    virtual void observe_execution_complete_at(const SessionId& session_id,
+                                               size_t total_jobs,
+                                               size_t successful_jobs,
+                                               const ObservedEventContext& context) = 0;
+    
+    /**
+     * Observe execution halt with its emitting context
+     */
+    virtual void observe_execution_halt_at(const SessionId& session_id,
+                                           const SessionJobId& failed_job_id,
+                                           size_t execution_index,
+                                           const ObservedEventContext& context) = 0;
+    
+    void observe_state_transition(const ExecutionTraceRecord& trace_record) final {
+        observe_state_transition_at(trace_record, ObservedEventContext::now());
+    }
+    
+    void observe_execution_complete(const SessionId& session_id,
+                                    size_t total_jobs,
+                                    size_t successful_jobs) final {
+        observe_execution_complete_at(session_id, total_jobs, successful_jobs, ObservedEventContext::now());
+    }
+    
+    void observe_execution_halt(const SessionId& session_id,
+                                const SessionJobId& failed_job_id,
+                                size_t execution_index) final {
+        observe_execution_halt_at(session_id, failed_job_id, execution_index, ObservedEventContext::now());
+    }
+};
+
 /**
  * Deterministic execution engine loop
  * 
@@ -105,10 +196,21 @@ public:
      * @param execution_graph Validated execution graph
      * @param job_executor Job execution implementation
      * @param observer Optional monitoring observer (may be nullptr)
+     * @param result_cache Optional content-addressed result cache (may be nullptr)
+     * @param input_digests Input digest resolver; required when result_cache is set
+     * @throws std::invalid_argument if result_cache is set without input_digests
+     * 
+     * RESULT CACHE:
+     * - Jobs whose spec hash and input digests match a cached success
+     *   complete without invoking the executor
+     * - State transitions are unchanged; hits and misses appear in the trace
+     * - Successful executed results are stored; failures are never cached
      */
     explicit DeterministicExecutionEngine(const ExecutionGraph& execution_graph,
                                          std::shared_ptr<JobExecutor> job_executor,
-                                         ExecutionEngineObserver* observer = nullptr);
+                                         ExecutionEngineObserver* observer = nullptr,
+                                         ResultCache* result_cache = nullptr,
+                                         const JobInputDigestProvider* input_digests = nullptr);
     
     /**
      * Execute all jobs in deterministic order
@@ -156,6 +258,8 @@ private:
     std::vector<SessionJobId> execution_order_;         // OWNED: Deterministic job execution order
     std::shared_ptr<JobExecutor> job_executor_;         // REFERENCED: Job execution implementation
     ExecutionEngineObserver* observer_;                 // REFERENCED: Optional monitoring observer
+    ResultCache* result_cache_;                         // REFERENCED: Optional result cache
+    const JobInputDigestProvider* input_digests_;       // REFERENCED: Input digest resolver (set with cache)
     std::vector<ExecutionTraceRecord> execution_trace_; // OWNED: Complete execution trace
     size_t current_execution_index_;                    // OWNED: Current position in execution
     SessionId session_id_;                              // REFERENCED: Session identity for events
@@ -166,10 +270,15 @@ private:
     // Execute single job through complete lifecycle
     bool execute_single_job(const SessionJobId& job_id);
     
+    // Resolve result through cache when configured, executor otherwise
+    JobExecutionResult resolve_job_result(const JobExecutionSpec& spec, CacheDisposition& disposition);
+    
     // Record state transition in trace and notify observer
     void record_state_transition(const SessionJobId& job_id, 
                                 ExecutionState previous_state, 
-                                ExecutionState new_state);
+                                ExecutionState new_state,
+                                ComponentType component,
+                                CacheDisposition cache = CacheDisposition::NotConsulted);
     
     // Notify observer of execution completion
     void notify_execution_complete();
@@ -5,6 +5,11 @@
 #include "JobExecutionResult.h"
 #include <vector>
 #include <optional>
+#include <memory>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
 
 namespace nx::batch {
 
@@ -68,7 +73,8 @@ struct ExecutionOutcome {
  * 
  * ARCHITECTURAL CONSTRAINTS:
  * - Emitted exactly once per execution attempt, after completion
- * - Contains complete intent (JobExecutionSpec) embedded verbatim
+ * - Contains complete intent (JobExecutionSpec), shared immutably across
+ *   all attempts of the same intent
  * - Contains retry lineage for deterministic replay
  * - Contains no time fields, no runtime state, no partial results
  * 
@@ -83,7 +89,7 @@ struct ExecutionRecord {
     std::optional<SessionJobId> parent_attempt_id;      // REFERENCED: Parent attempt for retry lineage
     uint32_t retry_index;                               // OWNED: Retry attempt number (0 = original)
     
-    JobExecutionSpec intent;                            // OWNED: Complete immutable intent, embedded verbatim
+    std::shared_ptr<const JobExecutionSpec> intent;     // SHARED: Complete immutable intent (never null)
     ExecutionOutcome outcome;                           // OWNED: Deterministic execution outcome
     
     /**
@@ -91,7 +97,7 @@ struct ExecutionRecord {
      * 
      * PHASE 10.2 CONTRACT:
      * - Called exactly once per execution attempt, after completion
-     * - Intent is embedded verbatim for self-sufficient replay
+     * - Intent is captured completely for self-sufficient replay
      * - Outcome is deterministic, no environment dependencies
      * 
      * @param attempt_id Unique execution attempt identity
@@ -108,16 +114,36 @@ struct ExecutionRecord {
         JobExecutionSpec intent,
         ExecutionOutcome outcome
     ) {
-        return ExecutionRecord{
-            .attempt_id = std::move(attempt_id),
-            .parent_attempt_id = std::move(parent_attempt_id),
-            .retry_index = retry_index,
-            .intent = std::move(intent),
-            .outcome = outcome
-        };
+        return create(
+            std::move(attempt_id),
+            std::move(parent_attempt_id),
+            retry_index,
+            std::make_shared<const JobExecutionSpec>(std::move(intent)),
+            outcome
+        );
     }
     
-    bool operator==(const ExecutionRecord& other) const = default;
+    /**
+     * Create execution record sharing an already materialized intent
+     * 
+     * Used when several attempts of the same intent are held at once
+     * (retry chains, replay loading) so the spec is stored only once.
+     * 
+     * @param intent Shared immutable job specification (must not be null)
+     * @throws std::invalid_argument if intent is null
+     */
+    static ExecutionRecord create(
+        SessionJobId attempt_id,
+        std::optional<SessionJobId> parent_attempt_id,
+        uint32_t retry_index,
+        std::shared_ptr<const JobExecutionSpec> intent,
+        ExecutionOutcome outcome
+    );
+    
+    /**
+     * Structural equality - intents compare by content, not by pointer
+     */
+    bool operator==(const ExecutionRecord& other) const;
 };
 
 /**
@@ -153,6 +179,26 @@ public:
     virtual void record(const ExecutionRecord& record) = 0;
 };
 
+/**
+ * Forward-only cursor over persisted execution records
+ * 
+ * STREAMING CONTRACT:
+ * - Yields records in the same deterministic order as load_all()
+ * - Holds at most one record at a time, plus any shared intents
+ * - Cannot rewind, seek, or query "latest state"
+ */
+class ExecutionRecordCursor {
+public:
+    virtual ~ExecutionRecordCursor() = default;
+    
+    /**
+     * Advance to the next persisted record
+     * 
+     * @return Next execution record, or nullopt when history is exhausted
+     */
+    virtual std::optional<ExecutionRecord> next() = 0;
+};
+
 /**
  * Read-only execution replay source for deterministic replay
  * 
@@ -184,6 +230,18 @@ public:
      * @return Vector of all execution records in deterministic order
      */
     virtual std::vector<ExecutionRecord> load_all() const = 0;
+    
+    /**
+     * Open a streaming cursor over all persisted execution records
+     * 
+     * Preferred over load_all() for large histories: memory stays bounded
+     * by one record plus shared intents. The default implementation
+     * materializes load_all(); sources backed by storage override it.
+     * The source must outlive the returned cursor.
+     * 
+     * @return Cursor yielding records in load_all() order
+     */
+    virtual std::unique_ptr<ExecutionRecordCursor> open_cursor() const;
 };
 
 /**
@@ -227,9 +285,80 @@ public:
     explicit InMemoryExecutionReplaySource(std::vector<ExecutionRecord> records);
     
     std::vector<ExecutionRecord> load_all() const override;
+    std::unique_ptr<ExecutionRecordCursor> open_cursor() const override;
     
 private:
     std::vector<ExecutionRecord> records_;  // OWNED: Immutable execution records for replay
 };
 
+/**
+ * File-backed execution recorder with intent deduplication
+ * 
+ * FILE FORMAT (append-only, one entry per line):
+ * - Header line identifying the format version
+ * - Spec dictionary entries: one per unique JobSpecHash, holding the
+ *   complete JobExecutionSpec, written before the first record using it
+ * - Execution records: lineage and outcome, referencing intent by hash
+ * 
+ * Strings are length-prefixed ("<len>:<bytes>") so commands and
+ * arguments may contain any byte, including separators and newlines.
+ * 
+ * DETERMINISTIC BEHAVIOR:
+ * - Same record sequence produces byte-identical files
+ * - No timestamps, no environment data
+ * - Retries of the same intent add only a record entry, never a spec copy
+ */
+class FileExecutionRecorder : public ExecutionRecorder {
+public:
+    /**
+     * Open recorder on file, appending to any existing content
+     * 
+     * @param path File to append execution records to
+     * @throws std::runtime_error if the file cannot be opened, or exists
+     *         without the current format header
+     */
+    explicit FileExecutionRecorder(const std::filesystem::path& path);
+    
+    void record(const ExecutionRecord& record) override;
+    
+private:
+    std::ofstream out_;                     // OWNED: Append-only output stream
+    std::set<std::string> written_specs_;   // OWNED: Spec hashes already in the dictionary
+};
+
+/**
+ * File-backed execution replay source
+ * 
+ * DETERMINISTIC BEHAVIOR:
+ * - Records returned in file order
+ * - Each unique spec is materialized once and shared by all records
+ * - Dictionary entries are verified against their recomputed hash
+ * 
+ * Cursors read the file incrementally; only the spec dictionary is
+ * retained, so memory is bounded by unique intents, not by attempts.
+ */
+class FileExecutionReplaySource : public ExecutionReplaySource {
+public:
+    explicit FileExecutionReplaySource(std::filesystem::path path);
+    
+    /**
+     * Load all records from file
+     * 
+     * @throws std::runtime_error if the file is unreadable, malformed, references
+     *         an unknown spec hash, or a dictionary entry fails hash verification
+     */
+    std::vector<ExecutionRecord> load_all() const override;
+    
+    /**
+     * Open streaming cursor over the file
+     * 
+     * @throws std::runtime_error under the same conditions as load_all(),
+     *         raised when the offending entry is reached
+     */
+    std::unique_ptr<ExecutionRecordCursor> open_cursor() const override;
+    
+private:
+    std::filesystem::path path_;  // OWNED: Persisted execution record file
+};
+
 } // namespace nx::batch
\ No newline at end of file
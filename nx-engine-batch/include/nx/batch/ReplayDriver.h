@@ -100,18 +100,21 @@ public:
      * Replay and verify persisted execution records
      * 
      * REPLAY CONTRACT:
-     * - Loads all execution records from replay source
-     * - Reconstructs deterministic execution order from persisted data
+     * - Streams execution records from replay source via open_cursor()
+     * - Preserves deterministic execution order from persisted data
      * - Re-executes each attempt with fresh SessionJobId
      * - Compares replayed outcomes against persisted outcomes
      * - Reports deterministic match or specific divergences
      * 
      * VERIFICATION PROCESS:
-     * 1. Load persisted execution records
-     * 2. Reconstruct retry chains and execution order
-     * 3. Execute each attempt with identical intent but fresh identity
-     * 4. Compare outcomes: intent hashes, retry indices, outcome kinds
-     * 5. Generate verification report with match status and divergences
+     * 1. Read next persisted execution record from cursor
+     * 2. Execute the attempt with identical intent but fresh identity
+     * 3. Compare outcomes: intent hashes, retry indices, outcome kinds
+     * 4. Generate verification report with match status and divergences
+     * 
+     * MEMORY BOUND:
+     * - One record in flight; no history materialization
+     * - Report size grows with mismatches only
      * 
      * DETERMINISM GUARANTEES:
      * - Replay order matches original logical order
@@ -124,13 +127,34 @@ public:
      */
     ReplayReport replay_and_verify(const ExecutionReplaySource& source);
     
+    /**
+     * Replay and verify with independent retry chains on a worker pool
+     * 
+     * PARALLEL CONTRACT:
+     * - Records are partitioned by intent hash; every chain is owned by
+     *   exactly one worker and replayed in persisted order
+     * - Different chains replay concurrently
+     * - Mismatches are merged by record position, so the returned report is
+     *   identical to replay_and_verify() for the same source
+     * - Records stream from open_cursor() through bounded per-worker queues
+     * 
+     * EXECUTOR REQUIREMENT:
+     * - Executors with an attached recorder replay on the serial path, so
+     *   persisted replay attempts keep their serial order and the recorder
+     *   is never called concurrently
+     * 
+     * @param source Execution replay source containing persisted records
+     * @param worker_count Worker threads (0 = hardware concurrency, 1 = serial path)
+     * @return ReplayReport identical to the serial replay report
+     * @throws Rethrows the first exception raised by a worker or the source
+     */
+    ReplayReport replay_and_verify_parallel(const ExecutionReplaySource& source, size_t worker_count = 0);
+    
 private:
     std::shared_ptr<RetryExecutor> retry_executor_;  // REFERENCED: Executor for replay verification
     
-    // Reconstruct retry chains from persisted execution records
-    // NOTE: Currently preparatory - reconstructed chains are not consumed in verification
-    // This provides foundation for future retry chain validation if needed
-    std::vector<RetryChain> reconstruct_retry_chains(const std::vector<ExecutionRecord>& records);
+    // Re-execute single persisted attempt and compare its outcome
+    std::optional<ReplayMismatch> replay_record(const ExecutionRecord& record);
     
     // Verify single execution attempt against persisted record
     std::optional<ReplayMismatch> verify_attempt(
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "JobExecutionSpec.h"
+#include "JobExecutionResult.h"
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace nx::batch {
+
+/**
+ * Content-addressed key for cached job results
+ *
+ * IDENTITY GUARANTEE:
+ * - Derived from JobExecutionSpec hash and input artifact digests only
+ * - Same intent over same inputs always yields the same key
+ * - Input digest order is significant (matches argument order)
+ */
+struct ResultCacheKey {
+    std::string value;  // SHA-256 over spec hash and input digests
+
+    /**
+     * Derive cache key from intent and input content
+     *
+     * @param spec_hash Content hash of the job intent
+     * @param input_digests Content digests of the job's input artifacts
+     * @return Deterministic cache key
+     */
+    static ResultCacheKey create(const JobSpecHash& spec_hash,
+                                 const std::vector<std::string>& input_digests);
+
+    bool operator==(const ResultCacheKey& other) const = default;
+};
+
+/**
+ * Resolves input artifact digests for a job intent
+ *
+ * CONSTRAINTS:
+ * - Must be deterministic for identical input content
+ * - Must not execute or observe other jobs
+ */
+class JobInputDigestProvider {
+public:
+    virtual ~JobInputDigestProvider() = default;
+
+    /**
+     * @param spec Immutable job specification
+     * @return Content digests of every input the job reads
+     */
+    virtual std::vector<std::string> input_digests(const JobExecutionSpec& spec) const = 0;
+};
+
+/**
+ * Bounds applied to a ResultCache
+ *
+ * Eviction is least-recently-used until both limits hold.
+ */
+struct ResultCacheLimits {
+    size_t max_entries = 4096;          // Maximum cached results
+    size_t max_bytes = 16 * 1024 * 1024; // Maximum accounted key + result bytes
+};
+
+/**
+ * Persistent, content-addressed cache of successful job results
+ *
+ * CACHING RULES:
+ * - Only successful results are stored; failures always re-execute
+ * - Lookups promote entries to most-recently-used
+ * - Stores evict least-recently-used entries beyond the limits
+ *
+ * PERSISTENCE:
+ * - save() writes entries in recency order and replaces the file atomically
+ * - load() restores entries and recency; a missing file yields an empty cache
+ * - Malformed files are rejected, never partially trusted
+ *
+ * THREAD SAFETY:
+ * - Not synchronized; owned by a single execution engine at a time
+ */
+class ResultCache {
+public:
+    explicit ResultCache(ResultCacheLimits limits = {});
+
+    /**
+     * Find a cached successful result
+     *
+     * @param key Content-addressed key
+     * @return Cached result, or nullopt on miss
+     */
+    std::optional<JobExecutionResult> lookup(const ResultCacheKey& key);
+
+    /**
+     * Cache a successful result, replacing any previous entry for the key
+     *
+     * @param key Content-addressed key
+     * @param result Successful execution result
+     * @throws std::invalid_argument if result is not successful
+     */
+    void store(const ResultCacheKey& key, const JobExecutionResult& result);
+
+    size_t entry_count() const;
+    size_t byte_size() const;
+    const ResultCacheLimits& limits() const;
+
+    /**
+     * Persist all entries to path (atomic replace)
+     *
+     * @throws std::runtime_error on I/O failure
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * Restore cache from path, applying limits on load
+     *
+     * @throws std::runtime_error if the file exists but is malformed
+     */
+    static ResultCache load(const std::filesystem::path& path, ResultCacheLimits limits = {});
+
+private:
+    struct Entry {
+        std::string key;            // OWNED: ResultCacheKey value
+        JobExecutionResult result;  // OWNED: Cached successful result
+        size_t bytes;               // OWNED: Accounted size
+    };
+
+    ResultCacheLimits limits_;                                          // OWNED: Eviction bounds
+    std::list<Entry> entries_;                                          // OWNED: Most recent first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_; // OWNED: Key lookup
+    size_t bytes_ = 0;                                                  // OWNED: Sum of entry sizes
+
+    // Drop least-recently-used entries until within limits
+    void evict_to_limits();
+};
+
+} // namespace nx::batch
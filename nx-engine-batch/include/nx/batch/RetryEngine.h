@@ -143,6 +143,16 @@ public:
         const RetryAttempt& attempt
     );
     
+    /**
+     * Check whether attempts are persisted through a recorder
+     * 
+     * Recorders are append-only and unsynchronized, so callers that fan
+     * execute_retry() out across threads must not do so when this is true.
+     * 
+     * @return true if an execution recorder is attached
+     */
+    bool has_recorder() const;
+    
 private:
     ExecutionRecorder* recorder_;  // REFERENCED: Optional execution recorder for persistence
     
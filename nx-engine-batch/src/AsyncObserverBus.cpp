@@ -0,0 +1,242 @@
+#include "nx/batch/AsyncObserverBus.h"
+#include <bit>
+#include <chrono>
+
+namespace nx::batch {
+
+namespace {
+
+void store_max(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current &&
+           !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+AsyncObserverBus::AsyncObserverBus(std::vector<ExecutionEngineObserver*> observers,
+                                   ObserverBusOptions options)
+    : options_(options)
+    , mask_(std::bit_ceil(options.capacity < 2 ? size_t{2} : options.capacity) - 1)
+    , cells_(std::make_unique<Cell[]>(mask_ + 1))
+    , observers_(std::make_unique<ObserverSlot[]>(observers.size()))
+    , observer_count_(observers.size()) {
+    options_.capacity = mask_ + 1;
+    for (size_t i = 0; i <= mask_; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < observer_count_; ++i) {
+        observers_[i].observer = observers[i];
+        observers_[i].timed = dynamic_cast<TimedExecutionEngineObserver*>(observers[i]);
+    }
+    drain_thread_ = std::thread([this] { drain_loop(); });
+}
+
+AsyncObserverBus::~AsyncObserverBus() {
+    stopping_.store(true, std::memory_order_release);
+    doorbell_.fetch_add(1, std::memory_order_release);
+    doorbell_.notify_one();
+    drain_thread_.join();
+}
+
+void AsyncObserverBus::observe_state_transition_at(const ExecutionTraceRecord& trace_record,
+                                                   const ObservedEventContext& context) {
+    Event event;
+    event.kind = EventKind::Transition;
+    event.trace = trace_record;
+    event.context = context;
+    publish(std::move(event));
+}
+
+void AsyncObserverBus::observe_execution_complete_at(const SessionId& session_id,
+                                                     size_t total_jobs,
+                                                     size_t successful_jobs,
+                                                     const ObservedEventContext& context) {
+    Event event;
+    event.kind = EventKind::Complete;
+    event.session_id = session_id;
+    event.total_jobs = total_jobs;
+    event.successful_jobs = successful_jobs;
+    event.context = context;
+    publish(std::move(event));
+}
+
+void AsyncObserverBus::observe_execution_halt_at(const SessionId& session_id,
+                                                 const SessionJobId& failed_job_id,
+                                                 size_t execution_index,
+                                                 const ObservedEventContext& context) {
+    Event event;
+    event.kind = EventKind::Halt;
+    event.session_id = session_id;
+    event.failed_job_id = failed_job_id;
+    event.total_jobs = execution_index;
+    event.context = context;
+    publish(std::move(event));
+}
+
+void AsyncObserverBus::flush() {
+    // Slots drain in position order; enqueued_ may count a later slot before an
+    // earlier one is filled, so wait on the claimed position instead
+    uint64_t target = enqueue_pos_.load(std::memory_order_acquire);
+    uint64_t drained = drained_.load(std::memory_order_acquire);
+    while (drained < target) {
+        drained_.wait(drained, std::memory_order_acquire);
+        drained = drained_.load(std::memory_order_acquire);
+    }
+}
+
+ObserverBusStats AsyncObserverBus::stats() const {
+    ObserverBusStats stats;
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.blocked = blocked_.load(std::memory_order_relaxed);
+    stats.observers.reserve(observer_count_);
+
+    // Read delivered counts before enqueued so lag is never negative
+    std::vector<uint64_t> delivered(observer_count_);
+    for (size_t i = 0; i < observer_count_; ++i) {
+        delivered[i] = observers_[i].delivered.load(std::memory_order_acquire);
+    }
+    stats.enqueued = enqueued_.load(std::memory_order_acquire);
+
+    for (size_t i = 0; i < observer_count_; ++i) {
+        const auto& slot = observers_[i];
+        ObserverLagStats lag;
+        lag.delivered = delivered[i];
+        lag.lag = stats.enqueued > delivered[i] ? stats.enqueued - delivered[i] : 0;
+        lag.max_lag = slot.max_lag.load(std::memory_order_relaxed);
+        lag.total_delivery_ns = slot.total_delivery_ns.load(std::memory_order_relaxed);
+        lag.max_delivery_ns = slot.max_delivery_ns.load(std::memory_order_relaxed);
+        lag.exceptions = slot.exceptions.load(std::memory_order_relaxed);
+        stats.observers.push_back(lag);
+    }
+    return stats;
+}
+
+const ObserverBusOptions& AsyncObserverBus::options() const {
+    return options_;
+}
+
+void AsyncObserverBus::publish(Event&& event) {
+    if (!try_enqueue(event)) {
+        if (options_.overflow == ObserverOverflowPolicy::Drop) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        blocked_.fetch_add(1, std::memory_order_relaxed);
+        do {
+            std::this_thread::yield();
+        } while (!try_enqueue(event));
+    }
+    enqueued_.fetch_add(1, std::memory_order_release);
+    doorbell_.fetch_add(1, std::memory_order_release);
+    doorbell_.notify_one();
+}
+
+bool AsyncObserverBus::try_enqueue(Event& event) {
+    size_t position = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells_[position & mask_];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto distance = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (distance == 0) {
+            if (enqueue_pos_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (distance < 0) {
+            return false;  // Slot still holds an undelivered event: ring is full
+        } else {
+            position = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->event = std::move(event);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncObserverBus::try_dequeue(Event& event) {
+    Cell& cell = cells_[dequeue_pos_ & mask_];
+    if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+        return false;
+    }
+    event = std::move(cell.event);
+    cell.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+    return true;
+}
+
+void AsyncObserverBus::drain_loop() {
+    Event event;
+    while (true) {
+        uint32_t doorbell = doorbell_.load(std::memory_order_acquire);
+        bool delivered_any = false;
+        while (try_dequeue(event)) {
+            deliver(event);
+            drained_.fetch_add(1, std::memory_order_release);
+            drained_.notify_all();
+            delivered_any = true;
+        }
+        if (delivered_any) {
+            continue;
+        }
+        // Producers have returned before destruction, so an empty ring is final
+        if (stopping_.load(std::memory_order_acquire)) {
+            return;
+        }
+        doorbell_.wait(doorbell, std::memory_order_acquire);
+    }
+}
+
+void AsyncObserverBus::deliver(const Event& event) {
+    uint64_t enqueued = enqueued_.load(std::memory_order_acquire);
+    for (size_t i = 0; i < observer_count_; ++i) {
+        auto& slot = observers_[i];
+        uint64_t delivered = slot.delivered.load(std::memory_order_relaxed);
+        store_max(slot.max_lag, enqueued > delivered ? enqueued - delivered : 0);
+
+        auto started = std::chrono::steady_clock::now();
+        try {
+            if (slot.timed) {
+                switch (event.kind) {
+                    case EventKind::Transition:
+                        slot.timed->observe_state_transition_at(event.trace, event.context);
+                        break;
+                    case EventKind::Complete:
+                        slot.timed->observe_execution_complete_at(event.session_id, event.total_jobs,
+                                                                  event.successful_jobs, event.context);
+                        break;
+                    case EventKind::Halt:
+                        slot.timed->observe_execution_halt_at(event.session_id, event.failed_job_id,
+                                                              event.total_jobs, event.context);
+                        break;
+                }
+            } else {
+                switch (event.kind) {
+                    case EventKind::Transition:
+                        slot.observer->observe_state_transition(event.trace);
+                        break;
+                    case EventKind::Complete:
+                        slot.observer->observe_execution_complete(event.session_id, event.total_jobs,
+                                                                  event.successful_jobs);
+                        break;
+                    case EventKind::Halt:
+                        slot.observer->observe_execution_halt(event.session_id, event.failed_job_id,
+                                                              event.total_jobs);
+                        break;
+                }
+            }
+        } catch (...) {
+            // A failing observer must not starve the others
+            slot.exceptions.fetch_add(1, std::memory_order_relaxed);
+        }
+        auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - started).count());
+
+        slot.total_delivery_ns.fetch_add(elapsed, std::memory_order_relaxed);
+        store_max(slot.max_delivery_ns, elapsed);
+        slot.delivered.fetch_add(1, std::memory_order_release);
+    }
+}
+
+} // namespace nx::batch
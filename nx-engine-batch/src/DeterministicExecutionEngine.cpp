@@ -1,5 +1,6 @@
 #include "nx/batch/DeterministicExecutionEngine.h"
 #include "determinism_guards.h"
+#include "nx_profile.h"
 #include <algorithm>
 #include <stdexcept>
 
@@ -10,11 +11,15 @@ namespace nx::batch {
 DeterministicExecutionEngine::DeterministicExecutionEngine(
     const ExecutionGraph& execution_graph,
     std::shared_ptr<JobExecutor> job_executor,
-    ExecutionEngineObserver* observer)
+    ExecutionEngineObserver* observer,
+    ResultCache* result_cache,
+    const JobInputDigestProvider* input_digests)
     : state_store_(execution_graph)
     , execution_order_(compute_execution_order(execution_graph))
     , job_executor_(std::move(job_executor))
     , observer_(observer)
+    , result_cache_(result_cache)
+    , input_digests_(input_digests)
     , current_execution_index_(0)
     , session_id_(execution_graph.nodes().empty() ? SessionId{""} : execution_graph.nodes()[0].job_id.session) {
     
@@ -25,11 +30,20 @@ DeterministicExecutionEngine::DeterministicExecutionEngine(
     if (!job_executor_) {
         throw std::invalid_argument("JobExecutor cannot be null");
     }
+    
+    // Spec hash alone cannot see changed input content; never cache on it
+    if (result_cache_ && !input_digests_) {
+        throw std::invalid_argument("ResultCache requires a JobInputDigestProvider");
+    }
 }
 
 DeterministicExecutionEngine::ExecutionResult DeterministicExecutionEngine::execute_all_jobs() {
     NX_DETERMINISTIC_FUNCTION;
     nx::core::DeterminismGuard::assert_no_time_access();
+    // The guard forbids time feeding execution. Profiling zones (compiled in
+    // only with NX_ENABLE_PROFILING) read the clock into a side ring that no
+    // trace record, state or result ever reads, so they are exempt.
+    NX_PROFILE_ZONE("DeterministicExecutionEngine::execute_all_jobs");
     
     bool all_completed = true;
     size_t jobs_executed = 0;
@@ -94,6 +108,7 @@ std::vector<SessionJobId> DeterministicExecutionEngine::compute_execution_order(
 
 bool DeterministicExecutionEngine::execute_single_job(const SessionJobId& job_id) {
     NX_DETERMINISTIC_FUNCTION;
+    NX_PROFILE_ZONE("DeterministicExecutionEngine::execute_single_job");
     
     // Phase 1: State Transition Planned → Running
     const auto& current_state = state_store_.get_job_state(job_id);
@@ -101,18 +116,21 @@ bool DeterministicExecutionEngine::execute_single_job(const SessionJobId& job_id
         throw std::logic_error("Job not in Planned state for execution");
     }
     
-    auto running_state = current_state.transition_to_running();
-    state_store_.update_job_state(running_state);
-    record_state_transition(job_id, ExecutionState::Planned, ExecutionState::Running);
-    
-    // Phase 2: Job Execution
     // PHASE 9 BRIDGE: Map from SessionJobId to JobExecutionSpec
+    // Resolved before the first transition so every trace record names its component
     auto spec_opt = state_store_.get_execution_graph().get_spec(job_id);
     if (!spec_opt) {
         throw std::logic_error("JobExecutionSpec not found for SessionJobId");
     }
+    const ComponentType component = spec_opt->target;
     
-    JobExecutionResult execution_result = job_executor_->execute_job(spec_opt.value());
+    auto running_state = current_state.transition_to_running();
+    state_store_.update_job_state(running_state);
+    record_state_transition(job_id, ExecutionState::Planned, ExecutionState::Running, component);
+    
+    // Phase 2: Job Execution
+    CacheDisposition cache_disposition = CacheDisposition::NotConsulted;
+    JobExecutionResult execution_result = resolve_job_result(spec_opt.value(), cache_disposition);
     
     // Phase 3: State Transition Running → Terminal
     const auto& running_job_state = state_store_.get_job_state(job_id);
@@ -128,22 +146,52 @@ bool DeterministicExecutionEngine::execute_single_job(const SessionJobId& job_id
     }
     
     state_store_.update_job_state(terminal_state);
-    record_state_transition(job_id, ExecutionState::Running, terminal_state_enum);
+    record_state_transition(job_id, ExecutionState::Running, terminal_state_enum, component, cache_disposition);
     
     // Phase 4: Propagation (monitoring events already emitted)
     return execution_result.success;
 }
 
+JobExecutionResult DeterministicExecutionEngine::resolve_job_result(
+    const JobExecutionSpec& spec,
+    CacheDisposition& disposition) {
+    
+    if (!result_cache_) {
+        disposition = CacheDisposition::NotConsulted;
+        return job_executor_->execute_job(spec);
+    }
+    
+    auto key = ResultCacheKey::create(
+        spec.hash,
+        input_digests_->input_digests(spec));
+    
+    if (auto cached = result_cache_->lookup(key)) {
+        disposition = CacheDisposition::Hit;
+        return cached.value();
+    }
+    
+    disposition = CacheDisposition::Miss;
+    auto result = job_executor_->execute_job(spec);
+    if (result.success) {
+        result_cache_->store(key, result);
+    }
+    return result;
+}
+
 void DeterministicExecutionEngine::record_state_transition(
     const SessionJobId& job_id,
     ExecutionState previous_state,
-    ExecutionState new_state) {
+    ExecutionState new_state,
+    ComponentType component,
+    CacheDisposition cache) {
     
     ExecutionTraceRecord trace_record{
         .execution_index = current_execution_index_++,
         .job_id = job_id,
         .previous_state = previous_state,
-        .new_state = new_state
+        .new_state = new_state,
+        .cache = cache,
+        .component = component
     };
     
     execution_trace_.push_back(trace_record);
@@ -1,7 +1,274 @@
 #include "nx/batch/ExecutionPersistence.h"
+#include "LengthPrefixedText.h"
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
 
 namespace nx::batch {
 
+namespace {
+
+// Version 2: spec hashes use the length-prefixed canonical form
+constexpr const char* kFileHeader = "NX-EXECUTION-RECORDS 2";
+
+// Entry tags - single character, first token on every entry line
+constexpr char kSpecEntry = 'S';
+constexpr char kRecordEntry = 'R';
+
+// Upper bound on list capacity reserved from an untrusted count
+constexpr uint64_t kReserveLimit = 64;
+
+constexpr const char* kFileKind = "execution record";
+
+using detail::write_string;
+
+void write_job_id(std::ostream& out, const SessionJobId& id) {
+    write_string(out, id.session.value);
+    out << ' ';
+    write_string(out, id.job_value);
+    out << ' ' << id.attempt_index;
+}
+
+void write_spec_entry(std::ostream& out, const JobExecutionSpec& spec) {
+    out << kSpecEntry << ' ';
+    write_string(out, spec.hash.value);
+    out << ' ' << static_cast<int>(spec.target) << ' ';
+    write_string(out, spec.command);
+    out << ' ' << spec.arguments.size();
+    for (const auto& arg : spec.arguments) {
+        out << ' ';
+        write_string(out, arg);
+    }
+    out << ' ' << spec.retry_policy.max_attempts
+        << ' ' << (spec.retry_policy.halt_on_failure ? 1 : 0)
+        << ' ' << static_cast<int>(spec.failure_strategy)
+        << ' ' << spec.dependencies.size();
+    for (const auto& dep : spec.dependencies) {
+        out << ' ';
+        write_string(out, dep.value);
+    }
+    out << '\n';
+}
+
+void write_record_entry(std::ostream& out, const ExecutionRecord& record) {
+    out << kRecordEntry << ' ';
+    write_job_id(out, record.attempt_id);
+    if (record.parent_attempt_id.has_value()) {
+        out << " 1 ";
+        write_job_id(out, record.parent_attempt_id.value());
+    } else {
+        out << " 0";
+    }
+    out << ' ' << record.retry_index << ' ';
+    write_string(out, record.intent->hash.value);
+    out << ' ' << static_cast<int>(record.outcome.kind)
+        << ' ' << static_cast<int>(record.outcome.error_code) << '\n';
+}
+
+[[noreturn]] void malformed(const std::string& detail) {
+    detail::malformed(kFileKind, detail);
+}
+
+// Entry tokens plus the record-specific field types
+class EntryReader : public detail::TokenReader {
+public:
+    explicit EntryReader(std::istream& in) : TokenReader(in, kFileKind) {}
+
+    uint32_t read_u32() {
+        auto value = read_number();
+        if (value > UINT32_MAX) {
+            malformed("number out of range");
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    // Enumerators are stored as their underlying value; last is the highest valid one
+    template <typename Enum>
+    Enum read_enum(Enum last) {
+        auto value = read_number();
+        if (value > static_cast<uint64_t>(last)) {
+            malformed("enum value out of range");
+        }
+        return static_cast<Enum>(value);
+    }
+
+    SessionJobId read_job_id() {
+        SessionJobId id;
+        id.session.value = read_string();
+        id.job_value = read_string();
+        id.attempt_index = read_u32();
+        return id;
+    }
+};
+
+std::shared_ptr<const JobExecutionSpec> read_spec_entry(EntryReader& reader) {
+    JobSpecHash stored_hash{reader.read_string()};
+    auto target = reader.read_enum(ComponentType::MetaFix);
+    auto command = reader.read_string();
+
+    // Counts come from the file: reserve a bounded prefix, grow as entries parse
+    auto argument_count = reader.read_number();
+    std::vector<std::string> arguments;
+    arguments.reserve(static_cast<size_t>(std::min<uint64_t>(argument_count, kReserveLimit)));
+    for (uint64_t i = 0; i < argument_count; ++i) {
+        arguments.push_back(reader.read_string());
+    }
+
+    RetryPolicy retry_policy;
+    retry_policy.max_attempts = reader.read_u32();
+    retry_policy.halt_on_failure = reader.read_number() != 0;
+    auto failure_strategy = reader.read_enum(FailureStrategy::Skip);
+
+    auto dependency_count = reader.read_number();
+    std::vector<JobSpecHash> dependencies;
+    dependencies.reserve(static_cast<size_t>(std::min<uint64_t>(dependency_count, kReserveLimit)));
+    for (uint64_t i = 0; i < dependency_count; ++i) {
+        dependencies.push_back(JobSpecHash{reader.read_string()});
+    }
+    reader.end_entry();
+
+    auto spec = std::make_shared<const JobExecutionSpec>(JobExecutionSpec::create(
+        target, std::move(command), std::move(arguments),
+        retry_policy, failure_strategy, std::move(dependencies)));
+
+    // Tamper detection: dictionary key must match recomputed content hash
+    if (spec->hash != stored_hash) {
+        malformed("spec hash mismatch for " + stored_hash.value);
+    }
+    return spec;
+}
+
+// Streams a vector owned elsewhere (the source outlives its cursors)
+class VectorRecordCursor : public ExecutionRecordCursor {
+public:
+    explicit VectorRecordCursor(const std::vector<ExecutionRecord>& records) : records_(records) {}
+
+    std::optional<ExecutionRecord> next() override {
+        if (position_ >= records_.size()) {
+            return std::nullopt;
+        }
+        return records_[position_++];
+    }
+
+private:
+    const std::vector<ExecutionRecord>& records_;
+    size_t position_ = 0;
+};
+
+// Owns a materialized history - fallback for sources without native streaming
+class OwningRecordCursor : public ExecutionRecordCursor {
+public:
+    explicit OwningRecordCursor(std::vector<ExecutionRecord> records)
+        : records_(std::move(records)), cursor_(records_) {}
+
+    std::optional<ExecutionRecord> next() override { return cursor_.next(); }
+
+private:
+    std::vector<ExecutionRecord> records_;
+    VectorRecordCursor cursor_;
+};
+
+// Reads one entry at a time; retains only the spec dictionary
+class FileRecordCursor : public ExecutionRecordCursor {
+public:
+    explicit FileRecordCursor(const std::filesystem::path& path)
+        : in_(path, std::ios::binary), reader_(in_) {
+        if (!in_.is_open()) {
+            throw std::runtime_error("Cannot open execution record file: " + path.string());
+        }
+
+        std::string header;
+        if (!std::getline(in_, header) || header != kFileHeader) {
+            malformed("unsupported header");
+        }
+    }
+
+    std::optional<ExecutionRecord> next() override {
+        for (int tag = in_.get(); tag != std::char_traits<char>::eof(); tag = in_.get()) {
+            if (tag == kSpecEntry) {
+                auto spec = read_spec_entry(reader_);
+                auto [it, inserted] = dictionary_.emplace(spec->hash.value, spec);
+                if (!inserted && *it->second != *spec) {
+                    malformed("conflicting spec entries for " + spec->hash.value);
+                }
+            } else if (tag == kRecordEntry) {
+                return read_record_entry();
+            } else {
+                malformed("unknown entry tag");
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    std::ifstream in_;
+    EntryReader reader_;
+    std::map<std::string, std::shared_ptr<const JobExecutionSpec>> dictionary_;
+
+    ExecutionRecord read_record_entry() {
+        auto attempt_id = reader_.read_job_id();
+        std::optional<SessionJobId> parent_attempt_id;
+        if (reader_.read_number() != 0) {
+            parent_attempt_id = reader_.read_job_id();
+        }
+        auto retry_index = reader_.read_u32();
+        auto spec_hash = reader_.read_string();
+        auto kind = reader_.read_enum(ExecutionOutcome::Kind::Failed);
+        auto error_code = reader_.read_enum(DeterministicErrorCode::ResourceUnavailable);
+        reader_.end_entry();
+
+        auto spec_it = dictionary_.find(spec_hash);
+        if (spec_it == dictionary_.end()) {
+            malformed("record references unknown spec " + spec_hash);
+        }
+
+        return ExecutionRecord::create(
+            std::move(attempt_id),
+            std::move(parent_attempt_id),
+            retry_index,
+            spec_it->second,
+            ExecutionOutcome{kind, error_code}
+        );
+    }
+};
+
+} // anonymous namespace
+
+ExecutionRecord ExecutionRecord::create(
+    SessionJobId attempt_id,
+    std::optional<SessionJobId> parent_attempt_id,
+    uint32_t retry_index,
+    std::shared_ptr<const JobExecutionSpec> intent,
+    ExecutionOutcome outcome) {
+
+    if (!intent) {
+        throw std::invalid_argument("ExecutionRecord intent cannot be null");
+    }
+
+    return ExecutionRecord{
+        .attempt_id = std::move(attempt_id),
+        .parent_attempt_id = std::move(parent_attempt_id),
+        .retry_index = retry_index,
+        .intent = std::move(intent),
+        .outcome = outcome
+    };
+}
+
+std::unique_ptr<ExecutionRecordCursor> ExecutionReplaySource::open_cursor() const {
+    return std::make_unique<OwningRecordCursor>(load_all());
+}
+
+bool ExecutionRecord::operator==(const ExecutionRecord& other) const {
+    return attempt_id == other.attempt_id &&
+           parent_attempt_id == other.parent_attempt_id &&
+           retry_index == other.retry_index &&
+           (intent == other.intent || (intent && other.intent && *intent == *other.intent)) &&
+           outcome == other.outcome;
+}
+
 void InMemoryExecutionRecorder::record(const ExecutionRecord& record) {
     records_.push_back(record);
 }
@@ -22,4 +289,57 @@ std::vector<ExecutionRecord> InMemoryExecutionReplaySource::load_all() const {
     return records_;
 }
 
-} // namespace nx::batch
\ No newline at end of file
+std::unique_ptr<ExecutionRecordCursor> InMemoryExecutionReplaySource::open_cursor() const {
+    return std::make_unique<VectorRecordCursor>(records_);
+}
+
+FileExecutionRecorder::FileExecutionRecorder(const std::filesystem::path& path) {
+    bool is_new = !std::filesystem::exists(path) || std::filesystem::file_size(path) == 0;
+    if (!is_new) {
+        // Never append entries to another format version or an unrelated file
+        std::ifstream existing(path, std::ios::binary);
+        std::string header;
+        if (!std::getline(existing, header) || header != kFileHeader) {
+            malformed("unsupported header in " + path.string());
+        }
+    }
+
+    out_.open(path, std::ios::binary | std::ios::app);
+    if (!out_.is_open()) {
+        throw std::runtime_error("Cannot open execution record file: " + path.string());
+    }
+
+    if (is_new) {
+        out_ << kFileHeader << '\n';
+        out_.flush();
+    }
+}
+
+void FileExecutionRecorder::record(const ExecutionRecord& record) {
+    // Dictionary entry precedes the first record referencing it
+    // Appending to an existing file may repeat an entry; readers accept identical repeats
+    if (written_specs_.insert(record.intent->hash.value).second) {
+        write_spec_entry(out_, *record.intent);
+    }
+    write_record_entry(out_, record);
+    out_.flush();
+}
+
+FileExecutionReplaySource::FileExecutionReplaySource(std::filesystem::path path)
+    : path_(std::move(path)) {
+}
+
+std::vector<ExecutionRecord> FileExecutionReplaySource::load_all() const {
+    auto cursor = open_cursor();
+    std::vector<ExecutionRecord> records;
+    while (auto record = cursor->next()) {
+        records.push_back(std::move(record.value()));
+    }
+    return records;
+}
+
+std::unique_ptr<ExecutionRecordCursor> FileExecutionReplaySource::open_cursor() const {
+    return std::make_unique<FileRecordCursor>(path_);
+}
+
+} // namespace nx::batch
@@ -1,5 +1,6 @@
 #include "nx/batch/ExecutionState.h"
 #include "nx/batch/ExecutionGraph.h"
+#include "nx_profile.h"
 #include <stdexcept>
 #include <algorithm>
 
@@ -70,11 +71,13 @@ ExecutionStateStore::ExecutionStateStore(const ExecutionGraph& execution_graph)
 }
 
 const ExecutionJobState& ExecutionStateStore::get_job_state(const SessionJobId& job_id) const {
+    NX_PROFILE_ZONE("ExecutionStateStore::get_job_state");
     size_t index = find_job_index(job_id);
     return job_states_[index];
 }
 
 void ExecutionStateStore::update_job_state(const ExecutionJobState& new_state) {
+    NX_PROFILE_ZONE("ExecutionStateStore::update_job_state");
     size_t index = find_job_index(new_state.job_id);
     const auto& current_state = job_states_[index];
     
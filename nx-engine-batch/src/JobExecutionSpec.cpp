@@ -58,13 +58,22 @@ JobSpecHash JobExecutionSpec::compute_hash(
     // Field 1: Component target (as integer for stability)
     canonical_stream << "target:" << static_cast<int>(target) << ";";
     
+    // Free-form strings are length-prefixed ("<len>:<bytes>") so separator
+    // characters inside values cannot make two distinct specs collide
+    auto write_field = [&canonical_stream](const std::string& value) {
+        canonical_stream << value.size() << ":" << value;
+    };
+    
     // Field 2: Command string
-    canonical_stream << "command:" << command << ";";
+    canonical_stream << "command:";
+    write_field(command);
+    canonical_stream << ";";
     
-    // Field 3: Arguments (order preserved for semantic correctness)
-    canonical_stream << "arguments:";
+    // Field 3: Arguments (count, then order preserved for semantic correctness)
+    canonical_stream << "arguments:" << arguments.size() << ",";
     for (const auto& arg : arguments) {
-        canonical_stream << arg << ",";
+        write_field(arg);
+        canonical_stream << ",";
     }
     canonical_stream << ";";
     
@@ -76,9 +85,10 @@ JobSpecHash JobExecutionSpec::compute_hash(
     canonical_stream << "failure_strategy:" << static_cast<int>(failure_strategy) << ";";
     
     // Field 6: Dependencies (already content-hashed, maintain order)
-    canonical_stream << "dependencies:";
+    canonical_stream << "dependencies:" << dependencies.size() << ",";
     for (const auto& dep : dependencies) {
-        canonical_stream << dep.value << ",";
+        write_field(dep.value);
+        canonical_stream << ",";
     }
     canonical_stream << ";";
     
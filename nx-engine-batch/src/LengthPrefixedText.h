@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+/// Shared token format for the batch engine's text persistence files
+///
+/// Entries are space-separated decimal numbers and length-prefixed strings
+/// ("<len>:<bytes>"), one entry per line. Every field is read from untrusted
+/// input, so malformed content raises std::runtime_error and never an
+/// allocation failure or a silently wrapped length.
+
+namespace nx::batch::detail {
+
+inline void write_string(std::ostream& out, const std::string& value) {
+    out << value.size() << ':' << value;
+}
+
+/// "Malformed <file_kind> file: <detail>"
+[[noreturn]] inline void malformed(const char* file_kind, const std::string& detail) {
+    throw std::runtime_error(std::string("Malformed ") + file_kind + " file: " + detail);
+}
+
+// Sequential reader over entry tokens
+class TokenReader {
+public:
+    TokenReader(std::istream& in, const char* file_kind) : in_(in), file_kind_(file_kind) {}
+
+    uint64_t read_number() {
+        skip_separator();
+        uint64_t value = 0;
+        bool any = false;
+        while (std::isdigit(in_.peek())) {
+            auto digit = static_cast<uint64_t>(in_.get() - '0');
+            if (value > (UINT64_MAX - digit) / 10) {
+                malformed("number out of range");
+            }
+            value = value * 10 + digit;
+            any = true;
+        }
+        if (!any) {
+            malformed("expected number");
+        }
+        return value;
+    }
+
+    // Storage grows with the bytes actually read, so a corrupt length cannot
+    // force a huge allocation before the truncation is noticed
+    std::string read_string() {
+        auto length = read_number();
+        if (in_.get() != ':') {
+            malformed("expected string length separator");
+        }
+        std::string value;
+        while (value.size() < length) {
+            size_t offset = value.size();
+            auto chunk = static_cast<size_t>(std::min<uint64_t>(length - offset, kReadChunk));
+            value.resize(offset + chunk);
+            if (!in_.read(value.data() + offset, static_cast<std::streamsize>(chunk))) {
+                malformed("truncated string");
+            }
+        }
+        return value;
+    }
+
+    void end_entry() {
+        if (in_.get() != '\n') {
+            malformed("expected end of entry");
+        }
+    }
+
+    [[noreturn]] void malformed(const std::string& detail) const {
+        detail::malformed(file_kind_, detail);
+    }
+
+private:
+    static constexpr uint64_t kReadChunk = 64 * 1024;
+
+    std::istream& in_;
+    const char* file_kind_;
+
+    void skip_separator() {
+        if (in_.peek() == ' ') {
+            in_.get();
+        }
+    }
+};
+
+} // namespace nx::batch::detail
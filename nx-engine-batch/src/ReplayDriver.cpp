@@ -1,43 +1,79 @@
 #include "nx/batch/ReplayDriver.h"
-#include <unordered_map>
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace nx::batch {
 
+namespace {
+
+struct PositionedRecord {
+    size_t position;        // Index in persisted order
+    ExecutionRecord record;
+};
+
+struct PositionedMismatch {
+    size_t position;        // Index of the diverging record in persisted order
+    ReplayMismatch mismatch;
+};
+
+// Bounded FIFO between the record reader and one replay worker
+class ReplayWorkQueue {
+public:
+    static constexpr size_t kCapacity = 256;
+
+    void push(PositionedRecord item) {
+        std::unique_lock lock(mutex_);
+        not_full_.wait(lock, [this] { return items_.size() < kCapacity; });
+        items_.push_back(std::move(item));
+        not_empty_.notify_one();
+    }
+
+    std::optional<PositionedRecord> pop() {
+        std::unique_lock lock(mutex_);
+        not_empty_.wait(lock, [this] { return !items_.empty() || closed_; });
+        if (items_.empty()) {
+            return std::nullopt;
+        }
+        auto item = std::move(items_.front());
+        items_.pop_front();
+        not_full_.notify_one();
+        return item;
+    }
+
+    void close() {
+        std::lock_guard lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<PositionedRecord> items_;
+    bool closed_ = false;
+};
+
+} // anonymous namespace
+
 ReplayDriver::ReplayDriver(std::shared_ptr<RetryExecutor> retry_executor)
     : retry_executor_(std::move(retry_executor)) {
 }
 
 ReplayReport ReplayDriver::replay_and_verify(const ExecutionReplaySource& source) {
-    // Load all persisted execution records
-    auto records = source.load_all();
-    
-    if (records.empty()) {
-        return ReplayReport::success();
-    }
-    
-    // Reconstruct retry chains from persisted records
-    auto retry_chains = reconstruct_retry_chains(records);
+    // Stream persisted execution records - no full history materialization
+    auto cursor = source.open_cursor();
     
     // Replay all execution attempts and collect mismatches
     std::vector<ReplayMismatch> mismatches;
     
-    for (const auto& record : records) {
-        // Generate fresh session ID for replay
-        auto replay_session_id = generate_replay_session_id();
-        
-        // Create fresh retry attempt for replay
-        auto replay_attempt = RetryAttempt{
-            .attempt_id = SessionJobId::create_initial(replay_session_id, "replay-" + std::to_string(record.retry_index)),
-            .parent_attempt_id = std::nullopt,  // Simplified for replay
-            .retry_index = record.retry_index
-        };
-        
-        // Execute replay attempt with identical intent
-        auto replay_result = retry_executor_->execute_retry(record.intent, replay_attempt);
-        
-        // Verify attempt against original record
-        auto mismatch = verify_attempt(record, replay_result);
+    while (auto record = cursor->next()) {
+        auto mismatch = replay_record(record.value());
         if (mismatch.has_value()) {
             mismatches.push_back(mismatch.value());
         }
@@ -51,51 +87,112 @@ ReplayReport ReplayDriver::replay_and_verify(const ExecutionReplaySource& source
     }
 }
 
-std::vector<RetryChain> ReplayDriver::reconstruct_retry_chains(const std::vector<ExecutionRecord>& records) {
-    // Group records by intent hash to reconstruct retry chains
-    std::unordered_map<std::string, std::vector<const ExecutionRecord*>> chains_by_intent;
-    
-    for (const auto& record : records) {
-        chains_by_intent[record.intent.hash.value].push_back(&record);
-    }
-    
-    // Reconstruct retry chains
-    std::vector<RetryChain> retry_chains;
-    
-    for (auto& [intent_hash, chain_records] : chains_by_intent) {
-        // Sort by retry index to maintain deterministic order
-        std::sort(chain_records.begin(), chain_records.end(),
-                  [](const ExecutionRecord* a, const ExecutionRecord* b) {
-                      return a->retry_index < b->retry_index;
-                  });
-        
-        if (!chain_records.empty()) {
-            // Create retry chain from first record
-            const auto& first_record = *chain_records[0];
-            auto initial_attempt = RetryAttempt{
-                .attempt_id = first_record.attempt_id,
-                .parent_attempt_id = first_record.parent_attempt_id,
-                .retry_index = first_record.retry_index
-            };
-            
-            auto chain = RetryChain::create(first_record.intent, initial_attempt);
-            
-            // Add remaining attempts to chain
-            for (size_t i = 1; i < chain_records.size(); ++i) {
-                const auto& record = *chain_records[i];
-                auto retry_attempt = RetryAttempt{
-                    .attempt_id = record.attempt_id,
-                    .parent_attempt_id = record.parent_attempt_id,
-                    .retry_index = record.retry_index
-                };
-                chain.attempts.push_back(retry_attempt);
+ReplayReport ReplayDriver::replay_and_verify_parallel(const ExecutionReplaySource& source, size_t worker_count) {
+    if (worker_count == 0) {
+        worker_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    if (worker_count == 1 || retry_executor_->has_recorder()) {
+        // Recorders are unsynchronized; keep recording single-threaded
+        return replay_and_verify(source);
+    }
+    
+    std::vector<std::unique_ptr<ReplayWorkQueue>> queues;
+    std::vector<std::vector<PositionedMismatch>> worker_mismatches(worker_count);
+    std::vector<std::exception_ptr> worker_errors(worker_count);
+    std::vector<std::thread> workers;
+    
+    queues.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        queues.push_back(std::make_unique<ReplayWorkQueue>());
+    }
+    
+    workers.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers.emplace_back([this, &queue = *queues[i], &found = worker_mismatches[i], &error = worker_errors[i]]() {
+            while (auto item = queue.pop()) {
+                if (error) {
+                    continue;  // Drain remaining work after failure
+                }
+                try {
+                    auto mismatch = replay_record(item->record);
+                    if (mismatch.has_value()) {
+                        found.push_back(PositionedMismatch{item->position, mismatch.value()});
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
             }
-            
-            retry_chains.push_back(std::move(chain));
+        });
+    }
+    
+    // Partition by intent hash: one chain -> one worker -> persisted order
+    std::exception_ptr source_error;
+    try {
+        auto cursor = source.open_cursor();
+        std::hash<std::string> partition_hash;
+        size_t position = 0;
+        while (auto record = cursor->next()) {
+            size_t worker = partition_hash(record->intent->hash.value) % worker_count;
+            queues[worker]->push(PositionedRecord{position++, std::move(record.value())});
+        }
+    } catch (...) {
+        source_error = std::current_exception();
+    }
+    
+    for (auto& queue : queues) {
+        queue->close();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    
+    if (source_error) {
+        std::rethrow_exception(source_error);
+    }
+    for (const auto& error : worker_errors) {
+        if (error) {
+            std::rethrow_exception(error);
         }
     }
     
-    return retry_chains;
+    // Canonical merge: record position order, as produced by the serial path
+    std::vector<PositionedMismatch> merged;
+    for (auto& found : worker_mismatches) {
+        merged.insert(merged.end(), found.begin(), found.end());
+    }
+    std::sort(merged.begin(), merged.end(),
+              [](const PositionedMismatch& a, const PositionedMismatch& b) {
+                  return a.position < b.position;
+              });
+    
+    if (merged.empty()) {
+        return ReplayReport::success();
+    }
+    
+    std::vector<ReplayMismatch> mismatches;
+    mismatches.reserve(merged.size());
+    for (auto& entry : merged) {
+        mismatches.push_back(entry.mismatch);
+    }
+    return ReplayReport::divergence(std::move(mismatches));
+}
+
+std::optional<ReplayMismatch> ReplayDriver::replay_record(const ExecutionRecord& record) {
+    // Generate fresh session ID for replay
+    auto replay_session_id = generate_replay_session_id();
+    
+    // Create fresh retry attempt for replay
+    auto replay_attempt = RetryAttempt{
+        .attempt_id = SessionJobId::create_initial(replay_session_id, "replay-" + std::to_string(record.retry_index)),
+        .parent_attempt_id = std::nullopt,  // Simplified for replay
+        .retry_index = record.retry_index
+    };
+    
+    // Execute replay attempt with identical intent
+    auto replay_result = retry_executor_->execute_retry(*record.intent, replay_attempt);
+    
+    // Verify attempt against original record
+    return verify_attempt(record, replay_result);
 }
 
 std::optional<ReplayMismatch> ReplayDriver::verify_attempt(
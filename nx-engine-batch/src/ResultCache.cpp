@@ -0,0 +1,172 @@
+#include "nx/batch/ResultCache.h"
+#include "../../nx-core/include/identity.h"
+#include "../../nx-core/include/nx_temp_file.h"
+#include "LengthPrefixedText.h"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace nx::batch {
+
+namespace {
+
+constexpr const char* kCacheHeader = "NX-RESULT-CACHE 1";
+
+constexpr const char* kFileKind = "result cache";
+
+using detail::write_string;
+
+size_t entry_bytes(const std::string& key, const JobExecutionResult& result) {
+    return key.size() + result.message.size() + result.result_token.size();
+}
+
+} // anonymous namespace
+
+ResultCacheKey ResultCacheKey::create(const JobSpecHash& spec_hash,
+                                      const std::vector<std::string>& input_digests) {
+    // Canonical serialization: length-prefixed so digest boundaries are unambiguous
+    std::ostringstream canonical_stream;
+    canonical_stream << "spec:";
+    write_string(canonical_stream, spec_hash.value);
+    canonical_stream << ";inputs:" << input_digests.size();
+    for (const auto& digest : input_digests) {
+        canonical_stream << ',';
+        write_string(canonical_stream, digest);
+    }
+    canonical_stream << ';';
+
+    auto hash_bytes = nx::core::Identity::compute_hash(canonical_stream.str());
+
+    std::ostringstream hex_stream;
+    hex_stream << std::hex << std::setfill('0');
+    for (uint8_t byte : hash_bytes) {
+        hex_stream << std::setw(2) << static_cast<unsigned>(byte);
+    }
+
+    return ResultCacheKey{hex_stream.str()};
+}
+
+ResultCache::ResultCache(ResultCacheLimits limits)
+    : limits_(limits) {
+}
+
+std::optional<JobExecutionResult> ResultCache::lookup(const ResultCacheKey& key) {
+    auto it = index_.find(key.value);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+
+    // Promote to most-recently-used
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->result;
+}
+
+void ResultCache::store(const ResultCacheKey& key, const JobExecutionResult& result) {
+    if (!result.success) {
+        throw std::invalid_argument("ResultCache only stores successful results");
+    }
+
+    auto bytes = entry_bytes(key.value, result);
+
+    auto it = index_.find(key.value);
+    if (it != index_.end()) {
+        bytes_ -= it->second->bytes;
+        it->second->result = result;
+        it->second->bytes = bytes;
+        entries_.splice(entries_.begin(), entries_, it->second);
+    } else {
+        entries_.push_front(Entry{key.value, result, bytes});
+        index_.emplace(key.value, entries_.begin());
+    }
+    bytes_ += bytes;
+
+    evict_to_limits();
+}
+
+size_t ResultCache::entry_count() const {
+    return entries_.size();
+}
+
+size_t ResultCache::byte_size() const {
+    return bytes_;
+}
+
+const ResultCacheLimits& ResultCache::limits() const {
+    return limits_;
+}
+
+void ResultCache::save(const std::filesystem::path& path) const {
+    // Private temp name: concurrent saves to one path must not share it
+    auto temp_path = nx::core::unique_temp_path(path);
+
+    try {
+        {
+            std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                throw std::runtime_error("Cannot write result cache file: " + temp_path.string());
+            }
+
+            out << kCacheHeader << '\n';
+
+            // Least recent first, so load() replays stores into identical recency
+            for (auto it = entries_.rbegin(); it != entries_.rend(); ++it) {
+                write_string(out, it->key);
+                out << ' ';
+                write_string(out, it->result.message);
+                out << ' ';
+                write_string(out, it->result.result_token);
+                out << '\n';
+            }
+
+            if (!out.flush()) {
+                throw std::runtime_error("Cannot write result cache file: " + temp_path.string());
+            }
+        }
+
+        std::filesystem::rename(temp_path, path);
+    } catch (...) {
+        std::error_code ignored;
+        std::filesystem::remove(temp_path, ignored);
+        throw;
+    }
+}
+
+ResultCache ResultCache::load(const std::filesystem::path& path, ResultCacheLimits limits) {
+    ResultCache cache(limits);
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return cache;
+    }
+
+    detail::TokenReader reader(in, kFileKind);
+
+    std::string header;
+    if (!std::getline(in, header) || header != kCacheHeader) {
+        reader.malformed("unsupported header");
+    }
+
+    while (in.peek() != std::char_traits<char>::eof()) {
+        ResultCacheKey key{reader.read_string()};
+        JobExecutionResult result{.success = true, .message = "", .result_token = ""};
+        result.message = reader.read_string();
+        result.result_token = reader.read_string();
+        reader.end_entry();
+        cache.store(key, result);
+    }
+
+    return cache;
+}
+
+void ResultCache::evict_to_limits() {
+    while (!entries_.empty() &&
+           (entries_.size() > limits_.max_entries || bytes_ > limits_.max_bytes)) {
+        const auto& victim = entries_.back();
+        bytes_ -= victim.bytes;
+        index_.erase(victim.key);
+        entries_.pop_back();
+    }
+}
+
+} // namespace nx::batch
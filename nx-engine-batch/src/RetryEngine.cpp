@@ -73,6 +73,10 @@ JobExecutionResult RetryExecutor::execute_retry(
     return result;
 }
 
+bool RetryExecutor::has_recorder() const {
+    return recorder_ != nullptr;
+}
+
 ExecutionOutcome RetryExecutor::result_to_outcome(const JobExecutionResult& result) const {
     return result.success ? ExecutionOutcome::success() : ExecutionOutcome::failed(DeterministicErrorCode::ProcessingFailed);
 }
@@ -0,0 +1,320 @@
+#include "nx/batch/AsyncObserverBus.h"
+#include "nx/batch/BatchEngineImpl.h"
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace nx::batch;
+
+// Records every event; optionally blocks until released to simulate a slow sink
+class RecordingObserver : public ExecutionEngineObserver {
+public:
+    std::vector<ExecutionTraceRecord> transitions;
+    std::vector<SessionId> completed_sessions;
+    std::vector<SessionJobId> halted_jobs;
+    std::atomic<bool>* gate = nullptr;
+    bool throw_on_transition = false;
+
+    void observe_state_transition(const ExecutionTraceRecord& trace_record) override {
+        if (gate) {
+            while (!gate->load()) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+        if (throw_on_transition) {
+            throw std::runtime_error("observer failure");
+        }
+        transitions.push_back(trace_record);
+    }
+
+    void observe_execution_complete(const SessionId& session_id, size_t, size_t) override {
+        completed_sessions.push_back(session_id);
+    }
+
+    void observe_execution_halt(const SessionId&, const SessionJobId& failed_job_id, size_t) override {
+        halted_jobs.push_back(failed_job_id);
+    }
+};
+
+// Records the emitting context of each transition and the thread that delivered it
+class ContextObserver : public TimedExecutionEngineObserver {
+public:
+    std::vector<ObservedEventContext> contexts;
+    std::vector<std::thread::id> delivery_threads;
+
+    void observe_state_transition_at(const ExecutionTraceRecord&, const ObservedEventContext& context) override {
+        contexts.push_back(context);
+        delivery_threads.push_back(std::this_thread::get_id());
+    }
+
+    void observe_execution_complete_at(const SessionId&, size_t, size_t, const ObservedEventContext&) override {}
+
+    void observe_execution_halt_at(const SessionId&, const SessionJobId&, size_t,
+                                   const ObservedEventContext&) override {}
+};
+
+// Marks each delivered transition by execution index; safe to poll from any thread
+class DeliveryFlagObserver : public ExecutionEngineObserver {
+public:
+    explicit DeliveryFlagObserver(size_t count) : delivered(count) {}
+
+    std::vector<std::atomic<bool>> delivered;
+
+    void observe_state_transition(const ExecutionTraceRecord& trace_record) override {
+        delivered[trace_record.execution_index].store(true, std::memory_order_relaxed);
+    }
+
+    void observe_execution_complete(const SessionId&, size_t, size_t) override {}
+
+    void observe_execution_halt(const SessionId&, const SessionJobId&, size_t) override {}
+};
+
+class FailingJobExecutor : public JobExecutor {
+public:
+    JobExecutionResult execute_job(const JobExecutionSpec&) const override {
+        return JobExecutionResult{.success = false, .message = "fail", .result_token = ""};
+    }
+};
+
+ExecutionGraph create_test_graph(size_t job_count) {
+    BatchEngineImpl batch_engine;
+    std::vector<ParsedBatchCommand> commands;
+    for (size_t i = 0; i < job_count; ++i) {
+        std::string in = "in" + std::to_string(i) + ".mp4";
+        std::string out = "out" + std::to_string(i) + ".mkv";
+        commands.push_back({"nx convert --input " + in + " --output " + out,
+                            {"nx", "convert", "--input", in, "--output", out}, true});
+    }
+    auto session = batch_engine.create_session(commands);
+    return batch_engine.create_execution_graph(session);
+}
+
+ExecutionTraceRecord make_record(size_t index) {
+    ExecutionTraceRecord record{};
+    record.execution_index = index;
+    record.previous_state = ExecutionState::Planned;
+    record.new_state = ExecutionState::Running;
+    return record;
+}
+
+void test_fan_out_preserves_engine_trace() {
+    auto graph = create_test_graph(4);
+    RecordingObserver first;
+    RecordingObserver second;
+
+    DeterministicExecutionEngine::ExecutionResult result;
+    {
+        AsyncObserverBus bus({&first, &second}, {.capacity = 64, .overflow = ObserverOverflowPolicy::Block});
+        DeterministicExecutionEngine engine(graph, std::make_shared<StubJobExecutor>(), &bus);
+        result = engine.execute_all_jobs();
+        bus.flush();
+
+        auto stats = bus.stats();
+        assert(stats.enqueued == result.trace.size() + 1);  // Transitions + completion
+        assert(stats.dropped == 0);
+        assert(stats.observers.size() == 2);
+        for (const auto& observer_stats : stats.observers) {
+            assert(observer_stats.delivered == stats.enqueued);
+            assert(observer_stats.lag == 0);
+        }
+    }
+
+    // Both observers see exactly the synchronous trace, in order
+    assert(first.transitions == result.trace);
+    assert(second.transitions == result.trace);
+    assert(first.completed_sessions.size() == 1);
+    assert(second.completed_sessions.size() == 1);
+}
+
+void test_halt_is_forwarded() {
+    auto graph = create_test_graph(2);
+    RecordingObserver observer;
+    {
+        AsyncObserverBus bus({&observer});
+        DeterministicExecutionEngine engine(graph, std::make_shared<FailingJobExecutor>(), &bus);
+        auto result = engine.execute_all_jobs();
+        assert(!result.all_jobs_completed);
+    }
+    assert(observer.halted_jobs.size() == 1);
+    assert(observer.completed_sessions.empty());
+}
+
+void test_drop_policy_accounts_for_every_event() {
+    std::atomic<bool> gate{false};
+    RecordingObserver slow;
+    slow.gate = &gate;
+
+    constexpr size_t kOffered = 100;
+    AsyncObserverBus bus({&slow}, {.capacity = 8, .overflow = ObserverOverflowPolicy::Drop});
+    assert(bus.options().capacity == 8);
+
+    for (size_t i = 0; i < kOffered; ++i) {
+        bus.observe_state_transition(make_record(i));
+    }
+
+    auto stats = bus.stats();
+    assert(stats.dropped > 0);
+    assert(stats.enqueued + stats.dropped == kOffered);
+    assert(stats.blocked == 0);
+    assert(stats.observers[0].lag > 0);
+
+    gate.store(true);
+    bus.flush();
+
+    stats = bus.stats();
+    assert(stats.observers[0].delivered == stats.enqueued);
+    assert(stats.observers[0].lag == 0);
+    assert(stats.observers[0].max_lag > 0);
+    assert(slow.transitions.size() == stats.enqueued);
+
+    // Surviving events keep their relative order
+    for (size_t i = 1; i < slow.transitions.size(); ++i) {
+        assert(slow.transitions[i - 1].execution_index < slow.transitions[i].execution_index);
+    }
+}
+
+void test_block_policy_loses_nothing() {
+    std::atomic<bool> gate{false};
+    RecordingObserver slow;
+    slow.gate = &gate;
+
+    constexpr size_t kOffered = 64;
+    AsyncObserverBus bus({&slow}, {.capacity = 4, .overflow = ObserverOverflowPolicy::Block});
+
+    std::thread releaser([&gate] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        gate.store(true);
+    });
+    for (size_t i = 0; i < kOffered; ++i) {
+        bus.observe_state_transition(make_record(i));
+    }
+    releaser.join();
+    bus.flush();
+
+    auto stats = bus.stats();
+    assert(stats.enqueued == kOffered);
+    assert(stats.dropped == 0);
+    assert(stats.blocked > 0);
+    assert(slow.transitions.size() == kOffered);
+    for (size_t i = 0; i < kOffered; ++i) {
+        assert(slow.transitions[i].execution_index == i);
+    }
+}
+
+void test_concurrent_producers() {
+    RecordingObserver observer;
+    constexpr size_t kProducers = 4;
+    constexpr size_t kPerProducer = 500;
+
+    AsyncObserverBus bus({&observer}, {.capacity = 16, .overflow = ObserverOverflowPolicy::Block});
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&bus, p] {
+            for (size_t i = 0; i < kPerProducer; ++i) {
+                bus.observe_state_transition(make_record(p * kPerProducer + i));
+            }
+        });
+    }
+    for (auto& producer : producers) producer.join();
+    bus.flush();
+
+    assert(observer.transitions.size() == kProducers * kPerProducer);
+
+    // Per-producer order is preserved
+    std::vector<size_t> last(kProducers, 0);
+    std::vector<bool> seen(kProducers, false);
+    for (const auto& record : observer.transitions) {
+        size_t producer = record.execution_index / kPerProducer;
+        assert(!seen[producer] || record.execution_index > last[producer]);
+        seen[producer] = true;
+        last[producer] = record.execution_index;
+    }
+}
+
+void test_flush_with_concurrent_producers() {
+    constexpr size_t kProducers = 8;
+    constexpr size_t kPerProducer = 2000;
+    DeliveryFlagObserver observer(kProducers * kPerProducer);
+
+    AsyncObserverBus bus({&observer}, {.capacity = 64, .overflow = ObserverOverflowPolicy::Block});
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&bus, &observer, p] {
+            for (size_t i = 0; i < kPerProducer; ++i) {
+                size_t index = p * kPerProducer + i;
+                bus.observe_state_transition(make_record(index));
+                // Other producers may still be filling earlier slots
+                bus.flush();
+                assert(observer.delivered[index].load(std::memory_order_relaxed));
+            }
+        });
+    }
+    for (auto& producer : producers) producer.join();
+}
+
+void test_throwing_observer_does_not_starve_others() {
+    RecordingObserver failing;
+    failing.throw_on_transition = true;
+    RecordingObserver healthy;
+
+    AsyncObserverBus bus({&failing, &healthy});
+    for (size_t i = 0; i < 10; ++i) {
+        bus.observe_state_transition(make_record(i));
+    }
+    bus.flush();
+
+    auto stats = bus.stats();
+    assert(stats.observers[0].exceptions == 10);
+    assert(stats.observers[1].exceptions == 0);
+    assert(healthy.transitions.size() == 10);
+}
+
+void test_timed_observer_gets_producer_context() {
+    ContextObserver timed;
+    RecordingObserver plain;
+    std::thread::id producer_thread;
+    std::chrono::steady_clock::time_point before;
+    std::chrono::steady_clock::time_point after;
+
+    {
+        AsyncObserverBus inner({&timed, &plain});
+        AsyncObserverBus outer({&inner});   // Nested buses forward the original context
+        std::thread producer([&] {
+            producer_thread = std::this_thread::get_id();
+            before = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < 8; ++i) {
+                outer.observe_state_transition(make_record(i));
+            }
+            after = std::chrono::steady_clock::now();
+        });
+        producer.join();
+        outer.flush();
+        inner.flush();
+    }
+
+    assert(timed.contexts.size() == 8);
+    assert(plain.transitions.size() == 8);
+    for (size_t i = 0; i < timed.contexts.size(); ++i) {
+        assert(timed.contexts[i].thread == producer_thread);
+        assert(timed.delivery_threads[i] != producer_thread);
+        assert(timed.contexts[i].emitted_at >= before && timed.contexts[i].emitted_at <= after);
+        assert(i == 0 || timed.contexts[i].emitted_at >= timed.contexts[i - 1].emitted_at);
+    }
+}
+
+int main() {
+    test_fan_out_preserves_engine_trace();
+    test_halt_is_forwarded();
+    test_drop_policy_accounts_for_every_event();
+    test_block_policy_loses_nothing();
+    test_concurrent_producers();
+    test_flush_with_concurrent_producers();
+    test_throwing_observer_does_not_starve_others();
+    test_timed_observer_gets_producer_context();
+
+    return 0;
+}
@@ -3,6 +3,10 @@
 #include "nx/batch/JobExecutionSpec.h"
 #include <cassert>
 #include <memory>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
 
 using namespace nx::batch;
 
@@ -39,7 +43,7 @@ void test_execution_record_is_self_sufficient() {
     // Assert successful re-execution capability
     auto& loaded_record = loaded_records[0];
     assert(loaded_record.attempt_id == attempt_id);
-    assert(loaded_record.intent == intent);
+    assert(*loaded_record.intent == intent);
     assert(loaded_record.outcome == ExecutionOutcome::success());
     assert(loaded_record.retry_index == 0);
     assert(!loaded_record.parent_attempt_id.has_value());
@@ -115,7 +119,7 @@ void test_replay_produces_identical_outcomes() {
     
     // Outcome codes identical
     assert(replayed_record.outcome == original_record.outcome);
-    assert(replayed_record.intent == original_record.intent);
+    assert(*replayed_record.intent == *original_record.intent);
     assert(replayed_record.retry_index == original_record.retry_index);
 }
 
@@ -217,7 +221,7 @@ void test_execution_record_contains_no_time_or_runtime_state() {
     assert(record.attempt_id == attempt_id);
     assert(!record.parent_attempt_id.has_value());
     assert(record.retry_index == 0);
-    assert(record.intent == intent);
+    assert(*record.intent == intent);
     assert(record.outcome == ExecutionOutcome::success());
     
     // The absence of forbidden fields is enforced by compilation
@@ -252,14 +256,14 @@ void test_retry_executor_with_persistence() {
     assert(records[0].attempt_id == initial_attempt.attempt_id);
     assert(!records[0].parent_attempt_id.has_value());
     assert(records[0].retry_index == 0);
-    assert(records[0].intent == intent);
+    assert(*records[0].intent == intent);
     
     // Verify second record
     assert(records[1].attempt_id == retry_attempt.attempt_id);
     assert(records[1].parent_attempt_id.has_value());
     assert(records[1].parent_attempt_id.value() == initial_attempt.attempt_id);
     assert(records[1].retry_index == 1);
-    assert(records[1].intent == intent);
+    assert(*records[1].intent == intent);
 }
 
 void test_append_only_persistence() {
@@ -297,6 +301,293 @@ void test_append_only_persistence() {
     }
 }
 
+static std::filesystem::path temp_record_file(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path;
+}
+
+static size_t count_occurrences(const std::string& haystack, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+void test_file_persistence_round_trip() {
+    auto path = temp_record_file("nx_exec_records_round_trip.log");
+    auto session_id = SessionId{"test-session"};
+    auto intent = JobExecutionSpec::create(
+        ComponentType::AudioLab,
+        "nx audio --input \"a b.wav\"\n",
+        {"nx", "audio", "--input", "a b.wav", ""},
+        RetryPolicy{3, false},
+        FailureStrategy::Continue,
+        {JobSpecHash{"dep-hash"}}
+    );
+    
+    auto initial_attempt = RetryAttempt::create_initial(session_id, "job-001");
+    auto retry_attempt = RetryAttempt::create_retry(initial_attempt);
+    
+    std::vector<ExecutionRecord> originals = {
+        ExecutionRecord::create(initial_attempt.attempt_id, std::nullopt, 0, intent,
+                                ExecutionOutcome::failed(DeterministicErrorCode::ResourceUnavailable)),
+        ExecutionRecord::create(retry_attempt.attempt_id, initial_attempt.attempt_id, 1, intent,
+                                ExecutionOutcome::success())
+    };
+    
+    {
+        FileExecutionRecorder recorder(path);
+        for (const auto& record : originals) {
+            recorder.record(record);
+        }
+    }
+    
+    FileExecutionReplaySource source(path);
+    auto loaded = source.load_all();
+    
+    assert(loaded == originals);
+    std::filesystem::remove(path);
+}
+
+void test_file_persistence_stores_each_spec_once() {
+    auto path = temp_record_file("nx_exec_records_dedup.log");
+    auto session_id = SessionId{"test-session"};
+    auto intent = JobExecutionSpec::create(
+        ComponentType::Convert,
+        "nx convert --input test.mp4 --output test.mkv",
+        {"nx", "convert", "--input", "test.mp4", "--output", "test.mkv"}
+    );
+    
+    {
+        FileExecutionRecorder recorder(path);
+        RetryExecutor executor(&recorder);
+        auto attempt = RetryAttempt::create_initial(session_id, "job-001");
+        for (int i = 0; i < 5; ++i) {
+            executor.execute_retry(intent, attempt);
+            attempt = RetryAttempt::create_retry(attempt);
+        }
+    }
+    
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    
+    // Command text appears once in the dictionary, not once per attempt
+    assert(count_occurrences(contents.str(), "nx convert --input test.mp4 --output test.mkv") == 1);
+    
+    // All loaded records share one materialized spec
+    FileExecutionReplaySource source(path);
+    auto loaded = source.load_all();
+    assert(loaded.size() == 5);
+    for (const auto& record : loaded) {
+        assert(record.intent.get() == loaded[0].intent.get());
+        assert(*record.intent == intent);
+    }
+    for (uint32_t i = 0; i < loaded.size(); ++i) {
+        assert(loaded[i].retry_index == i);
+    }
+    std::filesystem::remove(path);
+}
+
+void test_file_persistence_detects_tampered_spec() {
+    auto path = temp_record_file("nx_exec_records_tampered.log");
+    auto session_id = SessionId{"test-session"};
+    auto intent = JobExecutionSpec::create(
+        ComponentType::Convert,
+        "nx convert --input test.mp4 --output test.mkv",
+        {"nx", "convert"}
+    );
+    
+    {
+        FileExecutionRecorder recorder(path);
+        recorder.record(ExecutionRecord::create(
+            SessionJobId::create_initial(session_id, "job-001"), std::nullopt, 0, intent,
+            ExecutionOutcome::success()));
+    }
+    
+    // Alter the command text without updating the dictionary hash
+    std::string contents;
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        contents = buffer.str();
+    }
+    auto pos = contents.find("test.mkv");
+    assert(pos != std::string::npos);
+    contents.replace(pos, 8, "evil.mkv");
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << contents;
+    }
+    
+    FileExecutionReplaySource source(path);
+    bool rejected = false;
+    try {
+        source.load_all();
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    assert(rejected);
+    std::filesystem::remove(path);
+}
+
+void test_file_persistence_keeps_separator_specs_distinct() {
+    auto path = temp_record_file("nx_exec_records_separators.log");
+    auto session_id = SessionId{"test-session"};
+    
+    // Argument and dependency boundaries must survive hashing
+    auto joined = JobExecutionSpec::create(ComponentType::Convert, "nx convert", {"a,b"});
+    auto split = JobExecutionSpec::create(ComponentType::Convert, "nx convert", {"a", "b"});
+    auto joined_dep = JobExecutionSpec::create(ComponentType::Convert, "nx convert", {},
+                                               RetryPolicy{}, FailureStrategy::Halt, {JobSpecHash{"x,y"}});
+    auto split_dep = JobExecutionSpec::create(ComponentType::Convert, "nx convert", {},
+                                              RetryPolicy{}, FailureStrategy::Halt, {JobSpecHash{"x"}, JobSpecHash{"y"}});
+    assert(joined.hash != split.hash);
+    assert(joined_dep.hash != split_dep.hash);
+    
+    std::vector<ExecutionRecord> originals = {
+        ExecutionRecord::create(SessionJobId::create_initial(session_id, "job-001"), std::nullopt, 0,
+                                joined, ExecutionOutcome::success()),
+        ExecutionRecord::create(SessionJobId::create_initial(session_id, "job-002"), std::nullopt, 0,
+                                split, ExecutionOutcome::success())
+    };
+    {
+        FileExecutionRecorder recorder(path);
+        for (const auto& record : originals) {
+            recorder.record(record);
+        }
+    }
+    
+    FileExecutionReplaySource source(path);
+    auto loaded = source.load_all();
+    assert(loaded == originals);
+    assert(loaded[1].intent->arguments == split.arguments);
+    std::filesystem::remove(path);
+}
+
+void test_cursor_streams_records_in_load_all_order() {
+    auto path = temp_record_file("nx_exec_records_cursor.log");
+    auto session_id = SessionId{"test-session"};
+    
+    {
+        FileExecutionRecorder recorder(path);
+        for (int i = 0; i < 4; ++i) {
+            auto intent = JobExecutionSpec::create(
+                ComponentType::Convert,
+                "nx convert job-" + std::to_string(i % 2),
+                {"nx", "convert"}
+            );
+            recorder.record(ExecutionRecord::create(
+                SessionJobId::create_initial(session_id, "job-" + std::to_string(i)),
+                std::nullopt, 0, intent, ExecutionOutcome::success()));
+        }
+    }
+    
+    FileExecutionReplaySource file_source(path);
+    auto expected = file_source.load_all();
+    assert(expected.size() == 4);
+    
+    auto cursor = file_source.open_cursor();
+    std::vector<ExecutionRecord> streamed;
+    while (auto record = cursor->next()) {
+        streamed.push_back(std::move(record.value()));
+    }
+    assert(streamed == expected);
+    assert(!cursor->next().has_value());
+    
+    // In-memory cursor yields the same sequence without copying the store up front
+    InMemoryExecutionReplaySource memory_source(expected);
+    auto memory_cursor = memory_source.open_cursor();
+    for (const auto& record : expected) {
+        auto next = memory_cursor->next();
+        assert(next.has_value());
+        assert(next.value() == record);
+    }
+    assert(!memory_cursor->next().has_value());
+    std::filesystem::remove(path);
+}
+
+static bool load_rejected_as_malformed(const std::filesystem::path& path, const std::string& body) {
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "NX-EXECUTION-RECORDS 2\n" << body;
+    }
+    FileExecutionReplaySource source(path);
+    try {
+        source.load_all();
+    } catch (const std::runtime_error& e) {
+        return std::string(e.what()).starts_with("Malformed execution record file");
+    }
+    return false;
+}
+
+void test_file_persistence_rejects_corrupt_entries() {
+    auto path = temp_record_file("nx_exec_records_corrupt.log");
+    
+    // Oversized lengths and counts must not reach an allocation
+    assert(load_rejected_as_malformed(path, "S 99999999999999999:x\n"));
+    assert(load_rejected_as_malformed(path, "R 18446744073709551615:x\n"));
+    assert(load_rejected_as_malformed(path, "R 18446744073709551616:x\n"));
+    assert(load_rejected_as_malformed(path, "S 2:ab 0 3:cmd 9999999999999\n"));
+    assert(load_rejected_as_malformed(path, "S 2:ab 0 3:cmd 0 1 1 0 9999999999999\n"));
+    
+    // Enumerators outside their range
+    assert(load_rejected_as_malformed(path, "S 2:ab 4 3:cmd 0 1 1 0 0\n"));
+    assert(load_rejected_as_malformed(path, "S 2:ab 0 3:cmd 0 1 1 3 0\n"));
+    assert(load_rejected_as_malformed(path, "R 1:s 1:j 4294967296 0 0 2:ab 0 0\n"));
+    
+    // Out-of-range outcome on an otherwise valid record
+    auto intent = JobExecutionSpec::create(ComponentType::Convert, "nx convert", {"nx"});
+    std::filesystem::remove(path);
+    {
+        FileExecutionRecorder recorder(path);
+        recorder.record(ExecutionRecord::create(
+            SessionJobId::create_initial(SessionId{"s"}, "j"), std::nullopt, 0, intent,
+            ExecutionOutcome::success()));
+    }
+    std::string contents;
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        contents = buffer.str();
+    }
+    auto body = contents.substr(contents.find('\n') + 1);
+    auto outcome = body.rfind(" 0 0\n");
+    assert(outcome != std::string::npos);
+    assert(load_rejected_as_malformed(path, body.substr(0, outcome) + " 2 0\n"));
+    assert(load_rejected_as_malformed(path, body.substr(0, outcome) + " 1 4\n"));
+    assert(!load_rejected_as_malformed(path, body.substr(0, outcome) + " 1 3\n"));
+    std::filesystem::remove(path);
+}
+
+void test_file_recorder_refuses_foreign_files() {
+    auto path = temp_record_file("nx_exec_records_foreign.log");
+    for (const char* header : {"NX-EXECUTION-RECORDS 1\n", "not a record file\n"}) {
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out << header;
+        }
+        bool rejected = false;
+        try {
+            FileExecutionRecorder recorder(path);
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        assert(rejected);
+        
+        // Existing contents are left untouched
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        assert(buffer.str() == header);
+    }
+    std::filesystem::remove(path);
+}
+
 int main() {
     test_execution_record_is_self_sufficient();
     test_persistence_cannot_resume_partial_execution();
@@ -305,6 +596,13 @@ int main() {
     test_execution_record_contains_no_time_or_runtime_state();
     test_retry_executor_with_persistence();
     test_append_only_persistence();
+    test_file_persistence_round_trip();
+    test_file_persistence_stores_each_spec_once();
+    test_file_persistence_detects_tampered_spec();
+    test_file_persistence_keeps_separator_specs_distinct();
+    test_cursor_streams_records_in_load_all_order();
+    test_file_persistence_rejects_corrupt_entries();
+    test_file_recorder_refuses_foreign_files();
     
     return 0;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "nx/batch/RetryEngine.h"
 #include <cassert>
 #include <memory>
+#include <stdexcept>
 
 using namespace nx::batch;
 
@@ -291,8 +292,142 @@ void test_replay_detects_multiple_divergences() {
     assert(report.mismatches[1].retry_index == 1);
 }
 
+void test_replay_streams_records_without_load_all() {
+    auto session_id = SessionId{"test-session"};
+    auto intent = JobExecutionSpec::create(
+        ComponentType::Convert,
+        "nx convert --input test.mp4 --output test.mkv",
+        {"nx", "convert", "--input", "test.mp4", "--output", "test.mkv"}
+    );
+    
+    // Source that only supports streaming - full materialization is an error
+    class StreamingOnlySource : public ExecutionReplaySource {
+    public:
+        explicit StreamingOnlySource(std::vector<ExecutionRecord> records)
+            : backing_(std::move(records)) {}
+        
+        std::vector<ExecutionRecord> load_all() const override {
+            throw std::logic_error("replay must not materialize full history");
+        }
+        
+        std::unique_ptr<ExecutionRecordCursor> open_cursor() const override {
+            return backing_.open_cursor();
+        }
+        
+    private:
+        InMemoryExecutionReplaySource backing_;
+    };
+    
+    std::vector<ExecutionRecord> records;
+    auto attempt_id = SessionJobId::create_initial(session_id, "job-001");
+    for (uint32_t i = 0; i < 3; ++i) {
+        auto next_id = i == 0 ? attempt_id : SessionJobId::create_retry(attempt_id);
+        records.push_back(ExecutionRecord::create(
+            next_id,
+            i == 0 ? std::nullopt : std::optional<SessionJobId>(attempt_id),
+            i,
+            intent,
+            ExecutionOutcome::success()
+        ));
+        attempt_id = next_id;
+    }
+    
+    StreamingOnlySource source(records);
+    ReplayDriver driver(std::make_shared<RetryExecutor>());
+    
+    auto report = driver.replay_and_verify(source);
+    assert(report.deterministic_match == true);
+    assert(report.mismatches.empty());
+}
+
+void test_parallel_replay_matches_serial_report() {
+    auto session_id = SessionId{"test-session"};
+    
+    // Interleave many independent retry chains; some attempts persisted as failed
+    std::vector<ExecutionRecord> records;
+    for (uint32_t chain = 0; chain < 16; ++chain) {
+        auto input = "input" + std::to_string(chain) + ".mp4";
+        auto intent = JobExecutionSpec::create(
+            ComponentType::Convert,
+            "nx convert --input " + input,
+            {"nx", "convert", "--input", input}
+        );
+        auto attempt_id = SessionJobId::create_initial(session_id, "job-" + std::to_string(chain));
+        for (uint32_t i = 0; i < 4; ++i) {
+            bool persisted_failure = (chain + i) % 3 == 0;
+            records.push_back(ExecutionRecord::create(
+                attempt_id,
+                std::nullopt,
+                i,
+                intent,
+                persisted_failure
+                    ? ExecutionOutcome::failed(DeterministicErrorCode::ProcessingFailed)
+                    : ExecutionOutcome::success()
+            ));
+            attempt_id = SessionJobId::create_retry(attempt_id);
+        }
+    }
+    
+    InMemoryExecutionReplaySource source(records);
+    ReplayDriver driver(std::make_shared<RetryExecutor>());
+    
+    auto serial = driver.replay_and_verify(source);
+    assert(serial.deterministic_match == false);
+    assert(!serial.mismatches.empty());
+    
+    for (size_t workers : {size_t{0}, size_t{1}, size_t{2}, size_t{4}, size_t{7}}) {
+        auto parallel = driver.replay_and_verify_parallel(source, workers);
+        assert(parallel.deterministic_match == serial.deterministic_match);
+        assert(parallel.mismatches == serial.mismatches);
+    }
+}
+
+void test_parallel_replay_with_recorder_records_serially() {
+    auto session_id = SessionId{"test-session"};
+    
+    std::vector<ExecutionRecord> records;
+    for (uint32_t chain = 0; chain < 16; ++chain) {
+        auto input = "input" + std::to_string(chain) + ".mp4";
+        auto intent = JobExecutionSpec::create(
+            ComponentType::Convert,
+            "nx convert --input " + input,
+            {"nx", "convert", "--input", input}
+        );
+        auto attempt_id = SessionJobId::create_initial(session_id, "job-" + std::to_string(chain));
+        for (uint32_t i = 0; i < 4; ++i) {
+            records.push_back(ExecutionRecord::create(
+                attempt_id,
+                std::nullopt,
+                i,
+                intent,
+                ExecutionOutcome::success()
+            ));
+            attempt_id = SessionJobId::create_retry(attempt_id);
+        }
+    }
+    InMemoryExecutionReplaySource source(records);
+    
+    // Serial reference: replay attempts recorded in persisted order
+    InMemoryExecutionRecorder serial_recorder;
+    ReplayDriver serial_driver(std::make_shared<RetryExecutor>(&serial_recorder));
+    auto serial = serial_driver.replay_and_verify(source);
+    
+    // Parallel request with a recorder must not record concurrently
+    InMemoryExecutionRecorder parallel_recorder;
+    ReplayDriver parallel_driver(std::make_shared<RetryExecutor>(&parallel_recorder));
+    auto parallel = parallel_driver.replay_and_verify_parallel(source, 4);
+    
+    assert(parallel.deterministic_match == serial.deterministic_match);
+    assert(parallel.mismatches == serial.mismatches);
+    assert(parallel_recorder.get_records().size() == records.size());
+    assert(parallel_recorder.get_records() == serial_recorder.get_records());
+}
+
 int main() {
     test_replay_matches_original_execution();
+    test_replay_streams_records_without_load_all();
+    test_parallel_replay_matches_serial_report();
+    test_parallel_replay_with_recorder_records_serially();
     test_replay_detects_outcome_divergence();
     test_replay_does_not_skip_execution_based_on_past_outcomes();
     test_replay_does_not_write_persistence();
@@ -0,0 +1,312 @@
+#include "nx/batch/ResultCache.h"
+#include "nx/batch/DeterministicExecutionEngine.h"
+#include "nx/batch/BatchEngineImpl.h"
+#include <atomic>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nx::batch;
+
+// Counts executor invocations to prove cache hits skip execution
+class CountingJobExecutor : public JobExecutor {
+public:
+    mutable size_t executions = 0;
+    bool succeed = true;
+
+    JobExecutionResult execute_job(const JobExecutionSpec& spec) const override {
+        executions++;
+        return JobExecutionResult{
+            .success = succeed,
+            .message = succeed ? "Counted success" : "Counted failure",
+            .result_token = "counted_" + spec.hash.value
+        };
+    }
+};
+
+// Fixed input digests for every job
+class FixedInputDigests : public JobInputDigestProvider {
+public:
+    std::vector<std::string> digests;
+
+    std::vector<std::string> input_digests(const JobExecutionSpec&) const override {
+        return digests;
+    }
+};
+
+JobExecutionResult success_result(const std::string& token) {
+    return JobExecutionResult{.success = true, .message = "ok", .result_token = token};
+}
+
+std::filesystem::path temp_cache_file(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / ("nx_result_cache_" + name + ".cache");
+    std::filesystem::remove(path);
+    return path;
+}
+
+ExecutionGraph create_test_graph() {
+    BatchEngineImpl batch_engine;
+    std::vector<ParsedBatchCommand> commands = {
+        {"nx convert --input a.mp4 --output a.mkv", {"nx", "convert", "--input", "a.mp4", "--output", "a.mkv"}, true},
+        {"nx audio --input b.wav --output b.flac", {"nx", "audio", "--input", "b.wav", "--output", "b.flac"}, true}
+    };
+    auto session = batch_engine.create_session(commands);
+    return batch_engine.create_execution_graph(session);
+}
+
+void test_cache_key_is_content_derived() {
+    JobSpecHash spec{"abc"};
+
+    auto key1 = ResultCacheKey::create(spec, {"d1", "d2"});
+    auto key2 = ResultCacheKey::create(spec, {"d1", "d2"});
+    assert(key1 == key2);
+    assert(key1.value.size() == 64);
+
+    // Input content, input order and digest boundaries all change the key
+    assert(ResultCacheKey::create(spec, {"d1", "d3"}) != key1);
+    assert(ResultCacheKey::create(spec, {"d2", "d1"}) != key1);
+    assert(ResultCacheKey::create(spec, {"d1d2"}) != ResultCacheKey::create(spec, {"d1", "d2"}));
+    assert(ResultCacheKey::create(JobSpecHash{"abd"}, {"d1", "d2"}) != key1);
+}
+
+void test_cache_evicts_least_recently_used() {
+    ResultCache cache(ResultCacheLimits{.max_entries = 2, .max_bytes = 1024});
+
+    auto a = ResultCacheKey::create(JobSpecHash{"a"}, {});
+    auto b = ResultCacheKey::create(JobSpecHash{"b"}, {});
+    auto c = ResultCacheKey::create(JobSpecHash{"c"}, {});
+
+    cache.store(a, success_result("ta"));
+    cache.store(b, success_result("tb"));
+
+    // Touch a so b becomes least recent
+    assert(cache.lookup(a).has_value());
+
+    cache.store(c, success_result("tc"));
+    assert(cache.entry_count() == 2);
+    assert(cache.lookup(a).has_value());
+    assert(!cache.lookup(b).has_value());
+    assert(cache.lookup(c).has_value());
+}
+
+void test_cache_respects_byte_limit() {
+    auto key = ResultCacheKey::create(JobSpecHash{"a"}, {});
+    size_t one_entry = key.value.size() + 2 + 2;  // key + "ok" + token
+
+    ResultCache cache(ResultCacheLimits{.max_entries = 100, .max_bytes = one_entry * 2});
+    for (int i = 0; i < 5; ++i) {
+        cache.store(ResultCacheKey::create(JobSpecHash{std::to_string(i)}, {}),
+                    success_result("t" + std::to_string(i)));
+        assert(cache.byte_size() <= one_entry * 2);
+    }
+    assert(cache.entry_count() == 2);
+    assert(cache.lookup(ResultCacheKey::create(JobSpecHash{"4"}, {})).has_value());
+    assert(!cache.lookup(ResultCacheKey::create(JobSpecHash{"0"}, {})).has_value());
+}
+
+void test_cache_rejects_failed_results() {
+    ResultCache cache;
+    bool threw = false;
+    try {
+        cache.store(ResultCacheKey::create(JobSpecHash{"a"}, {}),
+                    JobExecutionResult{.success = false, .message = "failed", .result_token = ""});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(cache.entry_count() == 0);
+}
+
+void test_cache_persistence_round_trip() {
+    auto path = temp_cache_file("round_trip");
+
+    // Missing file loads as empty cache
+    assert(ResultCache::load(path).entry_count() == 0);
+
+    ResultCache cache;
+    auto a = ResultCacheKey::create(JobSpecHash{"a"}, {"in"});
+    auto b = ResultCacheKey::create(JobSpecHash{"b"}, {"in"});
+    cache.store(a, JobExecutionResult{.success = true, .message = "multi\nline message", .result_token = "ta"});
+    cache.store(b, success_result("tb"));
+    cache.lookup(a);  // a most recent
+    cache.save(path);
+
+    // Recency survives reload: limit of one keeps the most recent entry
+    auto restored = ResultCache::load(path, ResultCacheLimits{.max_entries = 1});
+    assert(restored.entry_count() == 1);
+    auto hit = restored.lookup(a);
+    assert(hit.has_value());
+    assert(hit->message == "multi\nline message");
+    assert(hit->result_token == "ta");
+
+    auto full = ResultCache::load(path);
+    assert(full.entry_count() == 2);
+    assert(full.byte_size() == cache.byte_size());
+
+    std::filesystem::remove(path);
+}
+
+void test_cache_concurrent_saves_use_private_temp_files() {
+    auto path = temp_cache_file("concurrent");
+
+    std::vector<ResultCache> caches(4);
+    for (size_t i = 0; i < caches.size(); ++i) {
+        for (size_t j = 0; j < 200; ++j) {
+            auto key = ResultCacheKey::create(JobSpecHash{"spec" + std::to_string(j)}, {"in"});
+            caches[i].store(key, success_result("writer" + std::to_string(i)));
+        }
+    }
+
+    // Each writer renames only its own complete file into place
+    std::vector<std::thread> writers;
+    std::atomic<size_t> failures{0};
+    for (const auto& cache : caches) {
+        writers.emplace_back([&cache, &path, &failures] {
+            for (int round = 0; round < 20; ++round) {
+                try {
+                    cache.save(path);
+                } catch (...) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    assert(failures == 0);
+
+    auto restored = ResultCache::load(path);
+    assert(restored.entry_count() == 200);
+    assert(restored.byte_size() == caches[0].byte_size());
+
+    // No temporary file is left behind
+    for (const auto& entry : std::filesystem::directory_iterator(path.parent_path())) {
+        assert(!entry.path().filename().string().starts_with(path.filename().string() + ".tmp"));
+    }
+
+    std::filesystem::remove(path);
+}
+
+void test_cache_rejects_malformed_file() {
+    auto path = temp_cache_file("malformed");
+
+    // Missing field, length beyond the file, length beyond 64 bits
+    const std::vector<std::string> bodies = {
+        "3:abc 2:ok\n",
+        "18446744073709551615:abc 2:ok 0:\n",
+        "99999999999999999999999:abc 2:ok 0:\n",
+    };
+    for (const auto& body : bodies) {
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out << "NX-RESULT-CACHE 1\n" << body;
+        }
+
+        bool threw = false;
+        try {
+            ResultCache::load(path);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    std::filesystem::remove(path);
+}
+
+void test_engine_skips_cached_jobs() {
+    auto graph = create_test_graph();
+    ResultCache cache;
+    FixedInputDigests inputs;
+    inputs.digests = {"input-v1"};
+
+    // First run: every job misses and executes
+    auto first_executor = std::make_shared<CountingJobExecutor>();
+    DeterministicExecutionEngine first(graph, first_executor, nullptr, &cache, &inputs);
+    auto first_result = first.execute_all_jobs();
+    assert(first_result.all_jobs_completed);
+    assert(first_executor->executions == 2);
+    assert(cache.entry_count() == 2);
+    for (const auto& record : first_result.trace) {
+        bool terminal = record.new_state == ExecutionState::Completed;
+        assert(record.cache == (terminal ? CacheDisposition::Miss : CacheDisposition::NotConsulted));
+    }
+
+    // Second run with unchanged inputs: every job hits, executor untouched
+    auto second_executor = std::make_shared<CountingJobExecutor>();
+    DeterministicExecutionEngine second(graph, second_executor, nullptr, &cache, &inputs);
+    auto second_result = second.execute_all_jobs();
+    assert(second_result.all_jobs_completed);
+    assert(second_executor->executions == 0);
+    assert(second_result.final_state.state_counts == first_result.final_state.state_counts);
+    for (const auto& record : second_result.trace) {
+        bool terminal = record.new_state == ExecutionState::Completed;
+        assert(record.cache == (terminal ? CacheDisposition::Hit : CacheDisposition::NotConsulted));
+    }
+
+    // Changed inputs invalidate: jobs execute again
+    inputs.digests = {"input-v2"};
+    auto third_executor = std::make_shared<CountingJobExecutor>();
+    DeterministicExecutionEngine third(graph, third_executor, nullptr, &cache, &inputs);
+    third.execute_all_jobs();
+    assert(third_executor->executions == 2);
+}
+
+void test_engine_never_caches_failures() {
+    auto graph = create_test_graph();
+    ResultCache cache;
+    FixedInputDigests inputs;
+
+    auto failing_executor = std::make_shared<CountingJobExecutor>();
+    failing_executor->succeed = false;
+    DeterministicExecutionEngine engine(graph, failing_executor, nullptr, &cache, &inputs);
+    auto result = engine.execute_all_jobs();
+    assert(!result.all_jobs_completed);
+    assert(cache.entry_count() == 0);
+    assert(result.trace.back().new_state == ExecutionState::Failed);
+    assert(result.trace.back().cache == CacheDisposition::Miss);
+}
+
+void test_engine_requires_input_digests_with_cache() {
+    auto graph = create_test_graph();
+    ResultCache cache;
+
+    bool threw = false;
+    try {
+        DeterministicExecutionEngine engine(graph, std::make_shared<CountingJobExecutor>(), nullptr, &cache);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void test_engine_without_cache_is_unchanged() {
+    auto graph = create_test_graph();
+    auto executor = std::make_shared<CountingJobExecutor>();
+    DeterministicExecutionEngine engine(graph, executor);
+    auto result = engine.execute_all_jobs();
+    assert(executor->executions == 2);
+    for (const auto& record : result.trace) {
+        assert(record.cache == CacheDisposition::NotConsulted);
+    }
+}
+
+int main() {
+    test_cache_key_is_content_derived();
+    test_cache_evicts_least_recently_used();
+    test_cache_respects_byte_limit();
+    test_cache_rejects_failed_results();
+    test_cache_persistence_round_trip();
+    test_cache_concurrent_saves_use_private_temp_files();
+    test_cache_rejects_malformed_file();
+    test_engine_skips_cached_jobs();
+    test_engine_never_caches_failures();
+    test_engine_requires_input_digests_with_cache();
+    test_engine_without_cache_is_unchanged();
+
+    return 0;
+}
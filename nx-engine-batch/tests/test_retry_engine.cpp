@@ -128,7 +128,7 @@ void test_replayed_retry_chain_executes_identically() {
             .retry_index = record.retry_index
         };
         
-        auto replay_result = replay_executor.execute_retry(record.intent, replay_attempt);
+        auto replay_result = replay_executor.execute_retry(*record.intent, replay_attempt);
         replay_results.push_back(replay_result);
     }
     
@@ -143,8 +143,8 @@ void test_replayed_retry_chain_executes_identically() {
     assert(replay_results[1].success == result2.success);
     
     // Assert intent equality across replay
-    assert(replayed_records[0].intent == intent);
-    assert(replayed_records[1].intent == intent);
+    assert(*replayed_records[0].intent == intent);
+    assert(*replayed_records[1].intent == intent);
     
     // Assert retry index ordering preserved
     assert(replayed_records[0].retry_index < replayed_records[1].retry_index);
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "nx/batch/DeterministicExecutionEngine.h"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace nx::monitor {
+
+/**
+ * Execution timeline recorder producing Chrome trace-event JSON
+ *
+ * MONITORING SEPARATION:
+ * - Timestamps come from ObservedEventContext on the observer side;
+ *   ExecutionTraceRecord stays free of wall-clock data and determinism is
+ *   unaffected
+ * - Attach directly to an engine or subscribe it to AsyncObserverBus: either
+ *   way begin/end times and thread ids are those of the executing thread
+ *
+ * OUTPUT:
+ * - One complete ("X") event per job attempt: name = job id, category =
+ *   engine, tid = executing thread, args carry session, outcome and cache
+ * - Instant events mark session completion and halts
+ * - Jobs still running when written are emitted up to the write time with
+ *   outcome "running"
+ * - Loads in chrome://tracing and ui.perfetto.dev
+ *
+ * THREAD SAFETY:
+ * - Any number of engines on different threads may share one recorder
+ */
+class ChromeTraceRecorder : public nx::batch::TimedExecutionEngineObserver {
+public:
+    ChromeTraceRecorder();
+
+    void observe_state_transition_at(const nx::batch::ExecutionTraceRecord& trace_record,
+                                     const nx::batch::ObservedEventContext& context) override;
+
+    void observe_execution_complete_at(const nx::batch::SessionId& session_id,
+                                       size_t total_jobs,
+                                       size_t successful_jobs,
+                                       const nx::batch::ObservedEventContext& context) override;
+
+    void observe_execution_halt_at(const nx::batch::SessionId& session_id,
+                                   const nx::batch::SessionJobId& failed_job_id,
+                                   size_t execution_index,
+                                   const nx::batch::ObservedEventContext& context) override;
+
+    /**
+     * Write the recorded timeline as Chrome trace-event JSON
+     */
+    void write(std::ostream& out) const;
+
+    /**
+     * Write the timeline to path (atomic replace)
+     *
+     * @throws std::runtime_error on I/O failure
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * Number of finished job spans recorded
+     */
+    size_t span_count() const;
+
+private:
+    struct Span {
+        std::string job_id;
+        std::string session_id;
+        uint32_t attempt_index;
+        size_t engine_slot;
+        uint32_t tid;
+        int64_t begin_ns;
+        std::optional<int64_t> end_ns;
+        std::string outcome;   // "running", "completed", "failed"
+        bool cache_hit = false;
+    };
+
+    struct Marker {
+        std::string name;
+        std::string session_id;
+        uint32_t tid;
+        int64_t at_ns;
+        std::string detail;
+    };
+
+    using SpanKey = std::pair<std::string, std::string>;  // (session id, job id)
+
+    std::chrono::steady_clock::time_point origin_;       // OWNED: ts = 0
+    std::chrono::system_clock::time_point origin_wall_;  // OWNED: Wall-clock time of ts = 0
+
+    mutable std::mutex mutex_;
+    std::vector<Span> spans_;                            // OWNED: Finished and open spans
+    std::map<SpanKey, size_t> open_spans_;               // OWNED: Index of running span per job
+    std::vector<Marker> markers_;                        // OWNED: Session instants
+    std::map<std::thread::id, uint32_t> thread_ids_;     // OWNED: Compact tid per thread
+
+    int64_t since_origin_ns(std::chrono::steady_clock::time_point time) const;
+    uint32_t compact_tid(std::thread::id thread);   // Requires mutex_
+};
+
+} // namespace nx::monitor
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "MetricsObserver.h"
+#include "OpenMetricsExporter.h"
+#include "RealMonitorEngine.h"
+#include <memory>
+
+namespace nx::monitor {
+
+/**
+ * Live monitoring for a process that runs execution sessions
+ *
+ * Owns the pieces such a process needs to be observable from outside:
+ * - a MetricsObserver feeding the registry, to attach to every
+ *   DeterministicExecutionEngine (directly, or behind AsyncObserverBus to
+ *   keep the job table lock off the execution thread)
+ * - a RealMonitorEngine over the same registry
+ * - an OpenMetricsExporter publishing that engine to a file and/or a
+ *   Unix-domain socket that `nx monitor` and scrapers connect to
+ *
+ * USAGE:
+ *   auto monitor = ExecutionMonitor::from_environment();
+ *   DeterministicExecutionEngine engine(graph, executor,
+ *                                       monitor ? &monitor->observer() : nullptr);
+ *
+ * LIFETIME:
+ * - Construct before the first session and destroy after the last one;
+ *   the observer must outlive every engine it is attached to
+ * - Destruction stops the exporter threads and removes the socket
+ *
+ * ERRORS:
+ * - Throws whatever OpenMetricsExporter throws for the given options
+ */
+class ExecutionMonitor {
+public:
+    /**
+     * Export the given registry (must outlive the monitor)
+     */
+    explicit ExecutionMonitor(OpenMetricsExportOptions options,
+                              MetricsRegistry& registry = MetricsRegistry::global());
+
+    ExecutionMonitor(const ExecutionMonitor&) = delete;
+    ExecutionMonitor& operator=(const ExecutionMonitor&) = delete;
+
+    /**
+     * Monitor configured from NX_MONITOR_SOCKET / NX_MONITOR_METRICS_FILE
+     * over the process-wide registry
+     *
+     * @return nullptr when neither variable is set
+     */
+    static std::unique_ptr<ExecutionMonitor> from_environment();
+
+    /**
+     * Observer to attach to execution engines
+     */
+    nx::batch::TimedExecutionEngineObserver& observer();
+
+    /**
+     * Exporter publishing the observed state
+     */
+    OpenMetricsExporter& exporter();
+
+private:
+    MetricsObserver observer_;       // OWNED: Feeds the registry
+    RealMonitorEngine engine_;       // OWNED: Reads the registry
+    OpenMetricsExporter exporter_;   // OWNED: Publishes engine_
+};
+
+} // namespace nx::monitor
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "MonitorEngine.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace nx::monitor {
+
+/**
+ * Lock-free log-bucketed latency histogram (HDR-style)
+ *
+ * BUCKETING:
+ * - Values below kSubBuckets microseconds get one exact bucket each
+ * - Every further power of two is split into kSubBuckets linear buckets,
+ *   so any bucket's width is at most 1/kSubBuckets of its lower bound
+ *   (12.5% worst-case relative error) over the full uint64_t range
+ *
+ * CONCURRENCY:
+ * - record() is a handful of relaxed atomic updates; any thread may record
+ * - summarize() may run concurrently with writers and sees each sample
+ *   either completely or not at all in the bucket counts
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t kSubBucketBits = 3;
+    static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+    static constexpr size_t kBucketCount = kSubBuckets + (64 - kSubBucketBits) * kSubBuckets;
+
+    /**
+     * Record one latency sample in microseconds
+     */
+    void record(uint64_t value_us);
+
+    /**
+     * Count, extrema, percentiles and non-empty buckets
+     * Percentiles report the upper bound of the containing bucket, capped at max.
+     */
+    LatencyStats summarize() const;
+
+    /**
+     * Clear all samples; must not run concurrently with writers
+     */
+    void reset();
+
+    static size_t bucket_index(uint64_t value_us);
+    static uint64_t bucket_upper_bound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_{UINT64_MAX};
+    std::atomic<uint64_t> max_{0};
+};
+
+} // namespace nx::monitor
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "MetricsRegistry.h"
+#include "nx/batch/DeterministicExecutionEngine.h"
+
+namespace nx::monitor {
+
+/**
+ * Execution engine observer that feeds the live metrics registry
+ * 
+ * MONITORING SEPARATION:
+ * - Reads trace records only; never touches execution state
+ * - Per transition cost is a few atomic increments plus one short
+ *   per-shard job table update, so observation does not delay execution
+ * - Latency uses the emitting time of each event, so the observer may be
+ *   attached directly or subscribed to AsyncObserverBus
+ * - Several engines may share one registry concurrently
+ */
+class MetricsObserver : public nx::batch::TimedExecutionEngineObserver {
+public:
+    explicit MetricsObserver(MetricsRegistry& registry = MetricsRegistry::global());
+    
+    void observe_state_transition_at(const nx::batch::ExecutionTraceRecord& trace_record,
+                                     const nx::batch::ObservedEventContext& context) override;
+    
+    void observe_execution_complete_at(const nx::batch::SessionId& session_id,
+                                       size_t total_jobs,
+                                       size_t successful_jobs,
+                                       const nx::batch::ObservedEventContext& context) override;
+    
+    void observe_execution_halt_at(const nx::batch::SessionId& session_id,
+                                   const nx::batch::SessionJobId& failed_job_id,
+                                   size_t execution_index,
+                                   const nx::batch::ObservedEventContext& context) override;
+
+private:
+    MetricsRegistry& registry_;  // REFERENCED: Shared metrics registry
+};
+
+} // namespace nx::monitor
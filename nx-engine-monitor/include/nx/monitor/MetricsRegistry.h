@@ -0,0 +1,261 @@
+#pragma once
+
+#include "LatencyHistogram.h"
+#include "MonitorEngine.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nx::monitor {
+
+/**
+ * Number of engine slots tracked by MetricsRegistry
+ * Slots 0..3 follow nx::batch::ComponentType order, the last slot collects
+ * jobs without a known component.
+ */
+inline constexpr size_t kMonitorEngineSlots = 5;
+
+/**
+ * Job state as tracked by the metrics registry
+ */
+enum class MonitoredJobState {
+    Running,
+    Completed,
+    Failed
+};
+
+/**
+ * Per-engine counters read from one registry snapshot
+ *
+ * All counters are monotonic; in_flight is derived from them so it can
+ * never be observed as negative.
+ */
+struct EngineCounters {
+    uint64_t started = 0;       // Jobs that entered Running
+    uint64_t completed = 0;     // Jobs that reached Completed
+    uint64_t failed = 0;        // Jobs that reached Failed
+
+    uint64_t in_flight() const {
+        uint64_t finished = completed + failed;
+        return started > finished ? started - finished : 0;
+    }
+};
+
+/**
+ * Point-in-time view of the metrics registry
+ */
+struct MetricsSnapshot {
+    std::array<EngineCounters, kMonitorEngineSlots> engines{};  // Indexed by engine slot
+    uint64_t cache_hits = 0;
+    uint64_t sessions_completed = 0;
+    uint64_t sessions_halted = 0;
+
+    uint64_t running() const;
+    uint64_t completed() const;
+    uint64_t failed() const;
+};
+
+/**
+ * Live execution metrics shared between execution observers and monitor readers
+ *
+ * CONCURRENCY MODEL:
+ * - Counters are lock-free: writers do one relaxed and one release increment
+ *   per transition on a cache-line-aligned shard chosen per writer thread
+ * - snapshot() sums a fixed number of shards (O(1) in the number of jobs)
+ *   and never blocks writers
+ * - Terminal counters are read before started counters, so every snapshot
+ *   satisfies completed + failed <= started for each engine
+ * - The per-job table used by jobs()/job() is NOT lock-free: each transition
+ *   also takes one of kShardCount job-table mutexes (sharded by job id) and
+ *   allocates when a job is first seen. status()/stats() never take it. To
+ *   keep it off the execution thread, subscribe MetricsObserver to
+ *   AsyncObserverBus (latencies still use the execution-thread emit time)
+ *
+ * JOB TABLE:
+ * - Jobs are keyed by (session id, job id), so sessions that reuse job
+ *   names are tracked separately
+ * - Bounded by max_tracked_jobs: once a shard is full, its oldest finished
+ *   jobs are evicted first; running jobs are never evicted
+ *
+ * TIMING:
+ * - Job latency (Running to terminal) is measured with steady_clock in the
+ *   monitor layer, from the time each transition was emitted (taken on the
+ *   execution thread, also behind AsyncObserverBus); execution traces stay
+ *   free of wall-clock data
+ * - Latencies go to one LatencyHistogram per engine slot
+ */
+class MetricsRegistry {
+public:
+    static constexpr size_t kEngineSlots = kMonitorEngineSlots;
+    static constexpr size_t kUnattributedSlot = kEngineSlots - 1;
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kDefaultMaxTrackedJobs = 262144;
+
+    /**
+     * @param max_tracked_jobs Finished jobs kept for jobs()/job() (at least one per shard)
+     */
+    explicit MetricsRegistry(size_t max_tracked_jobs = kDefaultMaxTrackedJobs);
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    /**
+     * Process-wide registry used by default observers and RealMonitorEngine
+     */
+    static MetricsRegistry& global();
+
+    /**
+     * Display name of engine slot, matching MonitorEngine::engines() names
+     */
+    static std::string_view engine_name(size_t engine_slot);
+
+    /**
+     * Record a job state transition
+     *
+     * @param session_id Execution session of the job
+     * @param job_id Job identity within its session
+     * @param engine_slot Engine slot (values >= kEngineSlots map to kUnattributedSlot)
+     * @param state State the job entered
+     * @param cache_hit Result was served from the result cache
+     * @param emitted_at Time the transition happened on the execution thread
+     */
+    void record_transition(std::string_view session_id, std::string_view job_id,
+                           size_t engine_slot, MonitoredJobState state,
+                           bool cache_hit = false,
+                           std::chrono::steady_clock::time_point emitted_at = std::chrono::steady_clock::now());
+
+    /**
+     * Record end of an execution session
+     */
+    void record_session_end(bool halted);
+
+    /**
+     * Consistent counter snapshot, O(kShardCount * kEngineSlots)
+     */
+    MetricsSnapshot snapshot() const;
+
+    /**
+     * Per-engine latency histograms and throughput
+     * Lists the four named engines always and Unattributed only when used.
+     */
+    MonitorStats stats() const;
+
+    /**
+     * Latest known state of every tracked job, ordered by session id then job id
+     */
+    std::vector<JobSummary> jobs() const;
+
+    /**
+     * Latest known state of one job
+     * Without a session id, the most recently started job of that id wins.
+     */
+    std::optional<JobDetail> job(const std::string& job_id,
+                                 std::optional<std::string_view> session_id = std::nullopt) const;
+
+    /**
+     * Number of jobs currently held in the job table
+     */
+    size_t tracked_jobs() const;
+
+    size_t max_tracked_jobs() const noexcept { return shard_capacity_ * kShardCount; }
+
+    /**
+     * Number of queued eviction entries, including stale ones
+     * Stays within twice the job table (or max_tracked_jobs, if larger)
+     */
+    size_t eviction_backlog() const;
+
+    /**
+     * Clear all counters and tracked jobs
+     * Must not run concurrently with writers
+     */
+    void reset();
+
+private:
+    struct alignas(64) CounterShard {
+        std::array<std::atomic<uint64_t>, kEngineSlots> started{};
+        std::array<std::atomic<uint64_t>, kEngineSlots> completed{};
+        std::array<std::atomic<uint64_t>, kEngineSlots> failed{};
+        std::atomic<uint64_t> cache_hits{0};
+        std::atomic<uint64_t> sessions_completed{0};
+        std::atomic<uint64_t> sessions_halted{0};
+    };
+
+    struct JobRecord {
+        size_t engine_slot;
+        MonitoredJobState state;
+        std::chrono::system_clock::time_point started_at;
+        std::optional<std::chrono::system_clock::time_point> finished_at;
+        std::chrono::steady_clock::time_point started_steady;  // Latency origin
+        uint64_t finish_sequence = 0;                          // Matches the live eviction entry
+    };
+
+    struct JobKey {
+        std::string session_id;
+        std::string job_id;
+    };
+
+    struct JobKeyView {
+        std::string_view session_id;
+        std::string_view job_id;
+    };
+
+    // Transparent hash/equality so (session, job) view lookups do not allocate
+    struct JobKeyHash {
+        using is_transparent = void;
+        size_t operator()(const JobKeyView& key) const;
+        size_t operator()(const JobKey& key) const { return (*this)(JobKeyView{key.session_id, key.job_id}); }
+    };
+
+    struct JobKeyEqual {
+        using is_transparent = void;
+        static JobKeyView view(const JobKey& key) { return {key.session_id, key.job_id}; }
+        static JobKeyView view(const JobKeyView& key) { return key; }
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return view(a).session_id == view(b).session_id && view(a).job_id == view(b).job_id;
+        }
+    };
+
+    using JobTable = std::unordered_map<JobKey, JobRecord, JobKeyHash, JobKeyEqual>;
+
+    // Finished job in eviction order; stale when the job has since restarted or finished again.
+    // Keys live in map nodes, so the pointer survives rehashing until that job is evicted.
+    struct FinishedEntry {
+        const JobKey* key;
+        uint64_t finish_sequence;
+    };
+
+    struct alignas(64) JobShard {
+        mutable std::mutex mutex;
+        JobTable jobs;
+        std::deque<FinishedEntry> finished;   // Oldest first
+        uint64_t next_finish_sequence = 1;
+    };
+
+    size_t shard_capacity_;                    // Jobs kept per job shard
+    std::array<CounterShard, kShardCount> counter_shards_;
+    std::array<JobShard, kShardCount> job_shards_;
+    std::array<LatencyHistogram, kEngineSlots> latency_;
+
+    // Throughput window in steady_clock nanoseconds
+    std::atomic<int64_t> first_start_ns_{INT64_MAX};
+    std::atomic<int64_t> last_finish_ns_{INT64_MIN};
+
+    CounterShard& writer_shard();
+    JobShard& job_shard(std::string_view job_id);
+    const JobShard& job_shard(std::string_view job_id) const;
+    void evict_finished(JobShard& shard);   // Requires shard.mutex
+    // Job the entry still evicts, or jobs.end() when stale; requires shard.mutex
+    static JobTable::const_iterator find_live(const JobShard& shard, const FinishedEntry& entry);
+};
+
+} // namespace nx::monitor
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <optional>
@@ -22,6 +23,7 @@ struct JobSummary {
     std::string job_id;
     std::string engine;
     std::string state;   // "queued", "running", "completed", "failed"
+    std::string session_id{};   // Execution session the job belongs to
 };
 
 struct JobDetail {
@@ -30,12 +32,57 @@ struct JobDetail {
     std::string state;
     std::string created_at;
     std::optional<std::string> completed_at;
+    std::string session_id{};
 };
 
 struct SystemStatus {
     bool healthy;
     size_t active_jobs;
     size_t completed_jobs;
+    size_t failed_jobs = 0;
+};
+
+struct LatencyBucket {
+    uint64_t upper_bound_us;   // Inclusive upper bound of the bucket
+    uint64_t count;            // Samples in this bucket (not cumulative)
+};
+
+struct LatencyStats {
+    uint64_t count = 0;
+    uint64_t sum_us = 0;
+    uint64_t min_us = 0;
+    uint64_t p50_us = 0;
+    uint64_t p90_us = 0;
+    uint64_t p99_us = 0;
+    uint64_t p999_us = 0;
+    uint64_t max_us = 0;
+    std::vector<LatencyBucket> buckets;  // Non-empty buckets, ascending
+};
+
+struct EngineStats {
+    std::string engine;
+    uint64_t started = 0;
+    uint64_t completed = 0;
+    uint64_t failed = 0;
+    uint64_t in_flight = 0;          // Started but not yet finished
+    double jobs_per_second = 0.0;
+    LatencyStats latency;
+};
+
+struct ProfileZoneStats {
+    std::string zone;                // NX_PROFILE_ZONE name, e.g. "JobGraph::finalize"
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+};
+
+struct MonitorStats {
+    double window_seconds = 0.0;     // First job start to last job finish
+    uint64_t jobs_finished = 0;
+    double jobs_per_second = 0.0;
+    std::vector<EngineStats> engines;
+    std::vector<ProfileZoneStats> profile_zones;  // Empty unless built with NX_ENABLE_PROFILING
+    uint64_t profile_samples_dropped = 0;
 };
 
 class MonitorEngine {
@@ -45,8 +92,19 @@ public:
     virtual SystemStatus status() const = 0;
     virtual std::vector<JobSummary> jobs() const = 0;
     virtual std::optional<JobDetail> job(const std::string& job_id) const = 0;
+
+    // Job of one execution session; job() alone answers the most recently started match
+    virtual std::optional<JobDetail> job_in_session(const std::string& job_id,
+                                                    const std::string& session_id) const {
+        auto detail = job(job_id);
+        if (detail && detail->session_id != session_id) {
+            return std::nullopt;
+        }
+        return detail;
+    }
     virtual std::vector<EngineInfo> engines() const = 0;
     virtual EngineVersion version() const = 0;
+    virtual MonitorStats stats() const = 0;
 };
 
 } // namespace nx::monitor
\ No newline at end of file
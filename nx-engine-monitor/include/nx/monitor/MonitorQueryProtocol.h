@@ -0,0 +1,69 @@
+#pragma once
+
+#include "MonitorEngine.h"
+#include <string>
+#include <string_view>
+
+namespace nx::monitor {
+
+/**
+ * Operations a monitor client can ask a live process for
+ */
+enum class MonitorQueryKind {
+    Status,
+    Jobs,
+    Job,
+    Engines,
+    Version,
+    Stats
+};
+
+/**
+ * One monitor query
+ */
+struct MonitorQuery {
+    MonitorQueryKind kind = MonitorQueryKind::Status;
+    std::string job_id;       // Job only
+    std::string session_id;   // Job only; empty selects the most recently started match
+};
+
+/**
+ * Monitor query wire format served on the OpenMetricsExporter socket
+ *
+ * EXCHANGE:
+ * - The client sends one JSON object terminated by a newline, e.g.
+ *   {"query":"job","job_id":"job_3","session_id":"session_1"}
+ * - The process answers with one JSON object and closes the connection:
+ *   {"ok":true,"result":<value>} or {"ok":false,"error":"<message>"}
+ *
+ * ENCODING:
+ * - Only strings, unsigned integers, booleans, objects and arrays are used,
+ *   so both ends share the nx-core streaming JSON writer and reader
+ * - MonitorStats travels as window_ns plus counts; the reader derives
+ *   jobs_per_second exactly as MetricsRegistry::stats() does
+ * - Absent optionals (JobDetail::completed_at, a missing job) are omitted
+ */
+std::string encode_monitor_query(const MonitorQuery& query);
+
+/**
+ * Parse a query line
+ *
+ * @throws nx::batchflow::JsonParseError on malformed JSON
+ * @throws std::invalid_argument on an unknown query or missing job_id
+ */
+MonitorQuery decode_monitor_query(std::string_view request);
+
+/**
+ * Answer a query line against engine
+ *
+ * Never throws: malformed requests and engine failures produce an
+ * {"ok":false,...} response.
+ */
+std::string answer_monitor_query(const MonitorEngine& engine, std::string_view request);
+
+/**
+ * {"ok":false,"error":"<message>"} response line, for requests turned away unanswered
+ */
+std::string monitor_query_error(std::string_view message);
+
+} // namespace nx::monitor
@@ -11,6 +11,7 @@ public:
     std::optional<JobDetail> job(const std::string& job_id) const override;
     std::vector<EngineInfo> engines() const override;
     EngineVersion version() const override;
+    MonitorStats stats() const override;
 };
 
 } // namespace nx::monitor
\ No newline at end of file
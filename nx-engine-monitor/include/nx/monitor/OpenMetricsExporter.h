@@ -0,0 +1,164 @@
+#pragma once
+
+#include "MonitorEngine.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace nx::monitor {
+
+/**
+ * Render MonitorEngine state in OpenMetrics text format
+ *
+ * Families (label engine="<name>" unless noted):
+ * - nx_monitor_healthy                      gauge, no labels
+ * - nx_jobs_started/completed/failed_total  counters
+ * - nx_jobs_in_flight                       gauge (per-engine queue depth)
+ * - nx_job_throughput_jobs_per_second       gauge
+ * - nx_job_latency_seconds                  histogram (cumulative buckets, +Inf, _count, _sum)
+ *   with the same le bounds for every engine on every render: 2^k - 1 us
+ *   for k = 4..32 (0.000015 s .. 4294.967295 s), which are exact
+ *   LatencyHistogram bucket edges
+ * - nx_profile_zone_calls/seconds_total     counters, label zone="<name>"
+ * - nx_profile_zone_max_seconds             gauge, label zone="<name>"
+ * - nx_profile_samples_dropped_total        counter, no labels
+ *   (profile families appear only when profiling zones have recorded samples)
+ *
+ * Output is deterministic for a given engine state and ends with "# EOF".
+ */
+std::string render_openmetrics(const MonitorEngine& engine);
+
+/**
+ * Environment variable naming the exporter socket of a session-running process
+ * `nx monitor` reads live state from this socket.
+ */
+inline constexpr const char* kMonitorSocketEnv = "NX_MONITOR_SOCKET";
+
+/**
+ * Environment variable naming the OpenMetrics file a session-running process rewrites
+ */
+inline constexpr const char* kMonitorMetricsFileEnv = "NX_MONITOR_METRICS_FILE";
+
+/**
+ * Where OpenMetricsExporter publishes rendered metrics
+ * At least one of file_path / socket_path must be set.
+ */
+struct OpenMetricsExportOptions {
+    std::filesystem::path file_path;                // Atomically replaced every interval
+    std::filesystem::path socket_path;              // Unix-domain socket answering each connection
+    std::chrono::milliseconds interval{1000};       // Re-render period
+};
+
+/**
+ * Background OpenMetrics publisher for a MonitorEngine
+ *
+ * THREADING:
+ * - A render thread re-renders the engine every interval into a fresh
+ *   immutable buffer and, when configured, rewrites file_path via a
+ *   temporary file and rename (readers never see a partial file)
+ * - A socket thread multiplexes all connections and answers each scrape
+ *   with the latest buffer; the scrape copies a shared pointer and
+ *   writes without blocking as the client drains it, so it never renders
+ *   or waits on another client (a reader stalled for 1 s is dropped)
+ * - A query thread answers monitor queries from the engine, so a slow
+ *   query never delays scrapes; at most kMaxQueuedQueries wait for it
+ * - None of them touches the execution thread; the engine is only read
+ *
+ * SOCKET PROTOCOL:
+ * - A request starting with "GET " gets an HTTP/1.0 response with the
+ *   OpenMetrics content type (curl --unix-socket, Prometheus via proxy)
+ * - A request starting with '{' is a monitor query line (see
+ *   MonitorQueryProtocol.h); it is answered from the engine at request
+ *   time rather than from the pre-rendered buffer, or rejected with an
+ *   {"ok":false,...} response when the query queue is full
+ * - Any other client receives the raw exposition and the connection
+ *   closes; it is answered as soon as it sends a byte that starts no
+ *   request (e.g. "\n") or shuts down its write side, and otherwise
+ *   after a 10 ms grace period, which delays no other client
+ *
+ * ERRORS:
+ * - Constructor throws std::invalid_argument without any destination
+ * - Constructor throws std::runtime_error if the socket cannot be bound
+ *   (or sockets are unsupported on the platform)
+ * - An existing socket_path is only removed when it is a socket nobody is
+ *   accepting on; a non-socket or a live exporter there throws instead
+ */
+class OpenMetricsExporter {
+public:
+    static constexpr size_t kMaxQueuedQueries = 64;
+
+    OpenMetricsExporter(const MonitorEngine& engine, OpenMetricsExportOptions options);
+    ~OpenMetricsExporter();
+
+    OpenMetricsExporter(const OpenMetricsExporter&) = delete;
+    OpenMetricsExporter& operator=(const OpenMetricsExporter&) = delete;
+
+    /**
+     * Latest rendered exposition (never empty once constructed)
+     */
+    std::shared_ptr<const std::string> current() const;
+
+    /**
+     * Re-render immediately and publish to the file, if configured
+     */
+    void refresh();
+
+    /**
+     * Number of scrapes answered on the socket
+     */
+    uint64_t scrape_count() const;
+
+    /**
+     * Number of monitor queries answered on the socket
+     */
+    uint64_t query_count() const;
+
+private:
+    const MonitorEngine& engine_;                           // REFERENCED: Observed engine
+    OpenMetricsExportOptions options_;                      // OWNED: Destinations and interval
+
+    mutable std::mutex buffer_mutex_;
+    std::shared_ptr<const std::string> buffer_;             // OWNED: Pre-rendered exposition
+
+    std::mutex refresh_mutex_;                              // Serializes render + file publish
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<uint64_t> scrapes_{0};
+    std::atomic<uint64_t> queries_{0};
+
+    std::mutex query_mutex_;
+    std::condition_variable query_cv_;
+    std::deque<std::pair<int, std::string>> query_queue_;  // OWNED: Client fd and query line
+
+    // Connection owned by the socket thread
+    struct Client {
+        int fd;
+        std::string request;                              // Bytes received so far
+        std::chrono::steady_clock::time_point deadline;   // Request grace, then write timeout
+        std::shared_ptr<const std::string> body;          // Set once answering a scrape
+        std::string header;                               // HTTP header sent ahead of body
+        size_t sent = 0;                                  // Bytes of header + body written
+    };
+
+    int listen_fd_ = -1;
+    std::thread render_thread_;
+    std::thread socket_thread_;
+    std::thread query_thread_;
+
+    void render_loop();
+    void socket_loop();
+    void query_loop();
+    bool dispatch(Client& client, bool final);
+    bool send_scrape(Client& client);
+    void write_file(const std::string& content) const;
+};
+
+} // namespace nx::monitor
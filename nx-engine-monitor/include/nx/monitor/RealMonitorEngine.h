@@ -1,16 +1,49 @@
 #pragma once
 
 #include "MonitorEngine.h"
+#include "MetricsRegistry.h"
 
 namespace nx::monitor {
 
+/**
+ * Monitor engine backed by a live MetricsRegistry
+ * 
+ * status() reads one registry snapshot (O(1) in the number of jobs) and
+ * never blocks the execution threads that feed the registry.
+ */
 class RealMonitorEngine : public MonitorEngine {
 public:
+    /**
+     * Observe the process-wide registry
+     */
+    RealMonitorEngine();
+    
+    /**
+     * Observe a specific registry (must outlive the engine)
+     */
+    explicit RealMonitorEngine(const MetricsRegistry& registry);
+    
     SystemStatus status() const override;
     std::vector<JobSummary> jobs() const override;
     std::optional<JobDetail> job(const std::string& job_id) const override;
+    std::optional<JobDetail> job_in_session(const std::string& job_id,
+                                            const std::string& session_id) const override;
     std::vector<EngineInfo> engines() const override;
     EngineVersion version() const override;
+    
+    /**
+     * Registry job statistics plus the process-wide NX_PROFILE_ZONE profile
+     * (collecting drains the per-thread profiling rings)
+     */
+    MonitorStats stats() const override;
+    
+    /**
+     * Full counter snapshot including per-engine in-flight gauges
+     */
+    MetricsSnapshot metrics() const;
+
+private:
+    const MetricsRegistry* registry_;  // REFERENCED: Live metrics source
 };
 
-} // namespace nx::monitor
\ No newline at end of file
+} // namespace nx::monitor
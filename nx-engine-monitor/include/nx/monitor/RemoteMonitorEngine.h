@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MonitorEngine.h"
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace nx::monitor {
+
+/**
+ * Live monitor source could not be reached or answered with an error
+ */
+class MonitorSourceError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * Monitor engine reading another process through its exporter socket
+ *
+ * The state of running sessions lives in the process that executes them
+ * (see ExecutionMonitor); a separate `nx monitor` process has an empty
+ * registry of its own. This engine forwards every call as one monitor query
+ * (MonitorQueryProtocol.h) to that process's OpenMetricsExporter socket, so
+ * each result reflects the live process at call time.
+ *
+ * ERRORS:
+ * - Every query throws MonitorSourceError when the socket cannot be
+ *   reached, times out, or the process answers with an error
+ */
+class RemoteMonitorEngine : public MonitorEngine {
+public:
+    explicit RemoteMonitorEngine(std::filesystem::path socket_path);
+
+    /**
+     * Engine for the socket named by NX_MONITOR_SOCKET
+     *
+     * @return nullptr when the variable is unset or empty
+     */
+    static std::unique_ptr<RemoteMonitorEngine> from_environment();
+
+    SystemStatus status() const override;
+    std::vector<JobSummary> jobs() const override;
+    std::optional<JobDetail> job(const std::string& job_id) const override;
+    std::optional<JobDetail> job_in_session(const std::string& job_id,
+                                            const std::string& session_id) const override;
+    std::vector<EngineInfo> engines() const override;
+    EngineVersion version() const override;
+    MonitorStats stats() const override;
+
+    /**
+     * Latest OpenMetrics exposition published by the process
+     */
+    std::string metrics_text() const;
+
+    const std::filesystem::path& socket_path() const;
+
+private:
+    std::filesystem::path socket_path_;  // OWNED: Exporter socket of the live process
+
+    std::string exchange(const std::string& request) const;
+};
+
+} // namespace nx::monitor
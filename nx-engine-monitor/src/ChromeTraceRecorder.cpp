@@ -0,0 +1,226 @@
+#include "nx/monitor/ChromeTraceRecorder.h"
+#include "nx/monitor/MetricsRegistry.h"
+#include "nx_batchflow_json.h"
+#include "nx_temp_file.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+
+namespace nx::monitor {
+
+namespace {
+
+// Trace-event timestamps are microseconds; keep nanosecond precision as decimals
+std::string format_micros(int64_t nanoseconds) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%" PRId64 ".%03" PRId64, nanoseconds / 1000, nanoseconds % 1000);
+    return buffer;
+}
+
+std::string format_wall_clock(std::chrono::system_clock::time_point time) {
+    std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &seconds);
+#else
+    gmtime_r(&seconds, &utc);
+#endif
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return buffer;
+}
+
+} // namespace
+
+ChromeTraceRecorder::ChromeTraceRecorder()
+    : origin_(std::chrono::steady_clock::now())
+    , origin_wall_(std::chrono::system_clock::now()) {
+}
+
+int64_t ChromeTraceRecorder::since_origin_ns(std::chrono::steady_clock::time_point time) const {
+    // Events emitted before the recorder existed are pinned to ts = 0
+    return std::max<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time - origin_).count(), 0);
+}
+
+uint32_t ChromeTraceRecorder::compact_tid(std::thread::id thread) {
+    auto [it, inserted] = thread_ids_.emplace(thread, static_cast<uint32_t>(thread_ids_.size() + 1));
+    return it->second;
+}
+
+void ChromeTraceRecorder::observe_state_transition_at(const nx::batch::ExecutionTraceRecord& trace_record,
+                                                      const nx::batch::ObservedEventContext& context) {
+    int64_t at = since_origin_ns(context.emitted_at);
+    SpanKey key{trace_record.job_id.session.value, trace_record.job_id.job_value};
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (trace_record.new_state == nx::batch::ExecutionState::Running) {
+        size_t engine_slot = static_cast<size_t>(trace_record.component);
+        open_spans_[key] = spans_.size();
+        spans_.push_back(Span{
+            .job_id = trace_record.job_id.job_value,
+            .session_id = trace_record.job_id.session.value,
+            .attempt_index = trace_record.job_id.attempt_index,
+            .engine_slot = engine_slot,
+            .tid = compact_tid(context.thread),
+            .begin_ns = at,
+            .end_ns = std::nullopt,
+            .outcome = "running"
+        });
+        return;
+    }
+
+    auto it = open_spans_.find(key);
+    if (it == open_spans_.end()) {
+        return;  // Terminal transition without an observed start
+    }
+    Span& span = spans_[it->second];
+    span.end_ns = at;
+    span.outcome = trace_record.new_state == nx::batch::ExecutionState::Completed ? "completed" : "failed";
+    span.cache_hit = trace_record.cache == nx::batch::CacheDisposition::Hit;
+    open_spans_.erase(it);
+}
+
+void ChromeTraceRecorder::observe_execution_complete_at(const nx::batch::SessionId& session_id,
+                                                        size_t total_jobs,
+                                                        size_t successful_jobs,
+                                                        const nx::batch::ObservedEventContext& context) {
+    int64_t at = since_origin_ns(context.emitted_at);
+    std::lock_guard<std::mutex> lock(mutex_);
+    markers_.push_back(Marker{
+        "session complete", session_id.value, compact_tid(context.thread), at,
+        std::to_string(successful_jobs) + "/" + std::to_string(total_jobs) + " jobs succeeded"
+    });
+}
+
+void ChromeTraceRecorder::observe_execution_halt_at(const nx::batch::SessionId& session_id,
+                                                    const nx::batch::SessionJobId& failed_job_id,
+                                                    size_t execution_index,
+                                                    const nx::batch::ObservedEventContext& context) {
+    int64_t at = since_origin_ns(context.emitted_at);
+    std::lock_guard<std::mutex> lock(mutex_);
+    markers_.push_back(Marker{
+        "session halted", session_id.value, compact_tid(context.thread), at,
+        "failed job " + failed_job_id.job_value + " at index " + std::to_string(execution_index)
+    });
+}
+
+size_t ChromeTraceRecorder::span_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return spans_.size() - open_spans_.size();
+}
+
+void ChromeTraceRecorder::write(std::ostream& out) const {
+    int64_t written_at = since_origin_ns(std::chrono::steady_clock::now());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Emit in begin order so the file is stable for identical timelines
+    std::vector<const Span*> ordered;
+    ordered.reserve(spans_.size());
+    for (const auto& span : spans_) ordered.push_back(&span);
+    std::stable_sort(ordered.begin(), ordered.end(),
+                     [](const Span* a, const Span* b) { return a->begin_ns < b->begin_ns; });
+
+    std::vector<std::pair<uint32_t, std::thread::id>> threads;
+    for (const auto& [thread, tid] : thread_ids_) threads.emplace_back(tid, thread);
+    std::sort(threads.begin(), threads.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::string document;
+    document.reserve(256 + spans_.size() * 192 + markers_.size() * 128);
+    nx::batchflow::JsonWriter json(document);
+
+    json.begin_object();
+    json.key("traceEvents");
+    json.begin_array();
+
+    json.begin_object();
+    json.key("ph"); json.value("M");
+    json.key("pid"); json.value(uint64_t{1});
+    json.key("tid"); json.value(uint64_t{0});
+    json.key("name"); json.value("process_name");
+    json.key("args"); json.begin_object(); json.key("name"); json.value("nx batch execution"); json.end_object();
+    json.end_object();
+
+    for (const auto& [tid, thread] : threads) {
+        json.begin_object();
+        json.key("ph"); json.value("M");
+        json.key("pid"); json.value(uint64_t{1});
+        json.key("tid"); json.value(uint64_t{tid});
+        json.key("name"); json.value("thread_name");
+        json.key("args"); json.begin_object();
+        json.key("name"); json.value("execution thread " + std::to_string(tid));
+        json.end_object();
+        json.end_object();
+    }
+    for (const Span* span : ordered) {
+        int64_t end = span->end_ns.value_or(written_at);
+        json.begin_object();
+        json.key("ph"); json.value("X");
+        json.key("pid"); json.value(uint64_t{1});
+        json.key("tid"); json.value(uint64_t{span->tid});
+        json.key("ts"); json.raw_value(format_micros(span->begin_ns));
+        json.key("dur"); json.raw_value(format_micros(std::max<int64_t>(end - span->begin_ns, 0)));
+        json.key("name"); json.value(span->job_id);
+        json.key("cat"); json.value(MetricsRegistry::engine_name(span->engine_slot));
+        json.key("args"); json.begin_object();
+        json.key("session"); json.value(span->session_id);
+        json.key("attempt"); json.value(uint64_t{span->attempt_index});
+        json.key("outcome"); json.value(span->outcome);
+        json.key("cache_hit"); json.value(span->cache_hit);
+        json.end_object();
+        json.end_object();
+    }
+    for (const auto& marker : markers_) {
+        json.begin_object();
+        json.key("ph"); json.value("i");
+        json.key("s"); json.value("p");
+        json.key("pid"); json.value(uint64_t{1});
+        json.key("tid"); json.value(uint64_t{marker.tid});
+        json.key("ts"); json.raw_value(format_micros(marker.at_ns));
+        json.key("name"); json.value(marker.name);
+        json.key("args"); json.begin_object();
+        json.key("session"); json.value(marker.session_id);
+        json.key("detail"); json.value(marker.detail);
+        json.end_object();
+        json.end_object();
+    }
+    json.end_array();
+
+    json.key("displayTimeUnit"); json.value("ms");
+    json.key("otherData"); json.begin_object();
+    json.key("origin_utc"); json.value(format_wall_clock(origin_wall_));
+    json.end_object();
+    json.end_object();
+    document.push_back('\n');
+
+    out.write(document.data(), static_cast<std::streamsize>(document.size()));
+}
+
+void ChromeTraceRecorder::save(const std::filesystem::path& path) const {
+    // Private temp name: concurrent saves to one path must not share it
+    auto temp_path = nx::core::unique_temp_path(path);
+    try {
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                throw std::runtime_error("Cannot write trace file: " + temp_path.string());
+            }
+            write(file);
+            if (!file.flush()) {
+                throw std::runtime_error("Cannot write trace file: " + temp_path.string());
+            }
+        }
+        std::filesystem::rename(temp_path, path);
+    } catch (...) {
+        std::error_code ignored;
+        std::filesystem::remove(temp_path, ignored);
+        throw;
+    }
+}
+
+} // namespace nx::monitor
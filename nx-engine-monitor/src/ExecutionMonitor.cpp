@@ -0,0 +1,34 @@
+#include "nx/monitor/ExecutionMonitor.h"
+#include <cstdlib>
+
+namespace nx::monitor {
+
+ExecutionMonitor::ExecutionMonitor(OpenMetricsExportOptions options, MetricsRegistry& registry)
+    : observer_(registry)
+    , engine_(registry)
+    , exporter_(engine_, std::move(options)) {
+}
+
+std::unique_ptr<ExecutionMonitor> ExecutionMonitor::from_environment() {
+    OpenMetricsExportOptions options;
+    if (const char* socket_path = std::getenv(kMonitorSocketEnv); socket_path && *socket_path) {
+        options.socket_path = socket_path;
+    }
+    if (const char* file_path = std::getenv(kMonitorMetricsFileEnv); file_path && *file_path) {
+        options.file_path = file_path;
+    }
+    if (options.socket_path.empty() && options.file_path.empty()) {
+        return nullptr;
+    }
+    return std::make_unique<ExecutionMonitor>(std::move(options));
+}
+
+nx::batch::TimedExecutionEngineObserver& ExecutionMonitor::observer() {
+    return observer_;
+}
+
+OpenMetricsExporter& ExecutionMonitor::exporter() {
+    return exporter_;
+}
+
+} // namespace nx::monitor
@@ -0,0 +1,86 @@
+#include "nx/monitor/LatencyHistogram.h"
+#include <algorithm>
+#include <bit>
+
+namespace nx::monitor {
+
+size_t LatencyHistogram::bucket_index(uint64_t value_us) {
+    if (value_us < kSubBuckets) {
+        return static_cast<size_t>(value_us);
+    }
+    size_t exponent = static_cast<size_t>(std::bit_width(value_us)) - 1;  // >= kSubBucketBits
+    size_t shift = exponent - kSubBucketBits;
+    size_t sub_bucket = static_cast<size_t>(value_us >> shift) - kSubBuckets;
+    return kSubBuckets + shift * kSubBuckets + sub_bucket;
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(size_t index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    size_t shift = (index - kSubBuckets) / kSubBuckets;
+    uint64_t sub_bucket = (index - kSubBuckets) % kSubBuckets;
+    uint64_t lower = (kSubBuckets + sub_bucket) << shift;
+    return lower + ((uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::record(uint64_t value_us) {
+    buckets_[bucket_index(value_us)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value_us, std::memory_order_relaxed);
+
+    uint64_t current = min_.load(std::memory_order_relaxed);
+    while (value_us < current && !min_.compare_exchange_weak(current, value_us, std::memory_order_relaxed)) {
+    }
+    current = max_.load(std::memory_order_relaxed);
+    while (value_us > current && !max_.compare_exchange_weak(current, value_us, std::memory_order_relaxed)) {
+    }
+}
+
+LatencyStats LatencyHistogram::summarize() const {
+    LatencyStats stats;
+
+    // Buckets are the source of truth for count so percentiles stay self-consistent
+    std::array<uint64_t, kBucketCount> counts;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        stats.count += counts[i];
+        if (counts[i] > 0) {
+            stats.buckets.push_back({bucket_upper_bound(i), counts[i]});
+        }
+    }
+    if (stats.count == 0) {
+        return stats;
+    }
+    stats.sum_us = sum_.load(std::memory_order_relaxed);
+    stats.max_us = max_.load(std::memory_order_relaxed);
+    stats.min_us = std::min(min_.load(std::memory_order_relaxed), stats.max_us);
+
+    auto percentile = [&](uint64_t numerator, uint64_t denominator) {
+        // Smallest bucket whose cumulative count reaches ceil(count * p)
+        uint64_t rank = std::max<uint64_t>(1, (stats.count * numerator + denominator - 1) / denominator);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return std::clamp(bucket_upper_bound(i), stats.min_us, stats.max_us);
+            }
+        }
+        return stats.max_us;
+    };
+    stats.p50_us = percentile(50, 100);
+    stats.p90_us = percentile(90, 100);
+    stats.p99_us = percentile(99, 100);
+    stats.p999_us = percentile(999, 1000);
+    return stats;
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(UINT64_MAX, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace nx::monitor
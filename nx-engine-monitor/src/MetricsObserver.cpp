@@ -0,0 +1,45 @@
+#include "nx/monitor/MetricsObserver.h"
+
+namespace nx::monitor {
+
+MetricsObserver::MetricsObserver(MetricsRegistry& registry)
+    : registry_(registry) {
+}
+
+void MetricsObserver::observe_state_transition_at(const nx::batch::ExecutionTraceRecord& trace_record,
+                                                  const nx::batch::ObservedEventContext& context) {
+    MonitoredJobState state;
+    switch (trace_record.new_state) {
+        case nx::batch::ExecutionState::Running:
+            state = MonitoredJobState::Running;
+            break;
+        case nx::batch::ExecutionState::Completed:
+            state = MonitoredJobState::Completed;
+            break;
+        case nx::batch::ExecutionState::Failed:
+            state = MonitoredJobState::Failed;
+            break;
+        default:
+            return;  // Planned is the initial state, not a transition target
+    }
+    
+    registry_.record_transition(trace_record.job_id.session.value, trace_record.job_id.job_value,
+                                static_cast<size_t>(trace_record.component), state,
+                                trace_record.cache == nx::batch::CacheDisposition::Hit, context.emitted_at);
+}
+
+void MetricsObserver::observe_execution_complete_at(const nx::batch::SessionId& /* session_id */,
+                                                    size_t /* total_jobs */,
+                                                    size_t /* successful_jobs */,
+                                                    const nx::batch::ObservedEventContext& /* context */) {
+    registry_.record_session_end(false);
+}
+
+void MetricsObserver::observe_execution_halt_at(const nx::batch::SessionId& /* session_id */,
+                                                const nx::batch::SessionJobId& /* failed_job_id */,
+                                                size_t /* execution_index */,
+                                                const nx::batch::ObservedEventContext& /* context */) {
+    registry_.record_session_end(true);
+}
+
+} // namespace nx::monitor
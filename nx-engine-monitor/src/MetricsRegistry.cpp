@@ -0,0 +1,354 @@
+#include "nx/monitor/MetricsRegistry.h"
+#include <algorithm>
+#include <ctime>
+#include <functional>
+#include <thread>
+
+namespace nx::monitor {
+
+namespace {
+
+constexpr std::string_view kEngineNames[kMonitorEngineSlots] = {
+    "NX-Convert Pro",
+    "NX-AudioLab",
+    "NX-VideoTrans",
+    "NX-MetaFix",
+    "Unattributed"
+};
+
+std::string_view state_name(MonitoredJobState state) {
+    switch (state) {
+        case MonitoredJobState::Running: return "running";
+        case MonitoredJobState::Completed: return "completed";
+        case MonitoredJobState::Failed: return "failed";
+    }
+    return "unknown";
+}
+
+// ISO-8601 UTC with second precision, e.g. 2024-01-01T00:00:00Z
+std::string format_timestamp(std::chrono::system_clock::time_point time) {
+    std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &seconds);
+#else
+    gmtime_r(&seconds, &utc);
+#endif
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return buffer;
+}
+
+void store_min(std::atomic<int64_t>& target, int64_t value) {
+    int64_t current = target.load(std::memory_order_relaxed);
+    while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void store_max(std::atomic<int64_t>& target, int64_t value) {
+    int64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+uint64_t MetricsSnapshot::running() const {
+    uint64_t total = 0;
+    for (const auto& engine : engines) total += engine.in_flight();
+    return total;
+}
+
+uint64_t MetricsSnapshot::completed() const {
+    uint64_t total = 0;
+    for (const auto& engine : engines) total += engine.completed;
+    return total;
+}
+
+uint64_t MetricsSnapshot::failed() const {
+    uint64_t total = 0;
+    for (const auto& engine : engines) total += engine.failed;
+    return total;
+}
+
+MetricsRegistry::MetricsRegistry(size_t max_tracked_jobs)
+    : shard_capacity_(std::max<size_t>(max_tracked_jobs / kShardCount, 1)) {
+}
+
+MetricsRegistry& MetricsRegistry::global() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+std::string_view MetricsRegistry::engine_name(size_t engine_slot) {
+    return kEngineNames[std::min(engine_slot, kUnattributedSlot)];
+}
+
+MetricsRegistry::CounterShard& MetricsRegistry::writer_shard() {
+    // Each writer thread keeps to one shard, so concurrent sessions rarely share a cache line
+    static thread_local const size_t shard_index =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) % kShardCount;
+    return counter_shards_[shard_index];
+}
+
+size_t MetricsRegistry::JobKeyHash::operator()(const JobKeyView& key) const {
+    size_t hash = std::hash<std::string_view>{}(key.job_id);
+    return hash ^ (std::hash<std::string_view>{}(key.session_id) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+}
+
+// Sharded by job id alone so job() without a session searches one shard
+MetricsRegistry::JobShard& MetricsRegistry::job_shard(std::string_view job_id) {
+    return job_shards_[std::hash<std::string_view>{}(job_id) % kShardCount];
+}
+
+const MetricsRegistry::JobShard& MetricsRegistry::job_shard(std::string_view job_id) const {
+    return job_shards_[std::hash<std::string_view>{}(job_id) % kShardCount];
+}
+
+void MetricsRegistry::record_transition(std::string_view session_id, std::string_view job_id,
+                                        size_t engine_slot, MonitoredJobState state,
+                                        bool cache_hit, std::chrono::steady_clock::time_point emitted_at) {
+    engine_slot = std::min(engine_slot, kUnattributedSlot);
+    // Wall-clock equivalent of the emit time, for display only
+    auto emitted_wall = std::chrono::system_clock::now() -
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::steady_clock::now() - emitted_at);
+    int64_t emitted_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(emitted_at.time_since_epoch()).count();
+
+    // started is bumped before the terminal counter of the same job (release), and
+    // snapshot() acquires terminal counters first, keeping finished <= started
+    CounterShard& counters = writer_shard();
+    switch (state) {
+        case MonitoredJobState::Running:
+            counters.started[engine_slot].fetch_add(1, std::memory_order_relaxed);
+            break;
+        case MonitoredJobState::Completed:
+            counters.completed[engine_slot].fetch_add(1, std::memory_order_release);
+            break;
+        case MonitoredJobState::Failed:
+            counters.failed[engine_slot].fetch_add(1, std::memory_order_release);
+            break;
+    }
+    if (cache_hit) {
+        counters.cache_hits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::optional<std::chrono::steady_clock::duration> latency;
+    {
+        JobShard& shard = job_shard(job_id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.jobs.find(JobKeyView{session_id, job_id});
+        if (it == shard.jobs.end()) {
+            it = shard.jobs.emplace(JobKey{std::string(session_id), std::string(job_id)},
+                                    JobRecord{engine_slot, state, emitted_wall, std::nullopt, emitted_at}).first;
+        } else if (state != MonitoredJobState::Running && it->second.state == MonitoredJobState::Running) {
+            latency = emitted_at - it->second.started_steady;
+        }
+        JobRecord& record = it->second;
+        record.engine_slot = engine_slot;
+        record.state = state;
+        if (state == MonitoredJobState::Running) {
+            record.started_at = emitted_wall;
+            record.started_steady = emitted_at;
+            record.finished_at.reset();
+        } else {
+            record.finished_at = emitted_wall;
+            record.finish_sequence = shard.next_finish_sequence++;
+            shard.finished.push_back({&it->first, record.finish_sequence});
+            evict_finished(shard);
+        }
+    }
+
+    if (state == MonitoredJobState::Running) {
+        store_min(first_start_ns_, emitted_ns);
+        return;
+    }
+    store_max(last_finish_ns_, emitted_ns);
+    if (latency) {
+        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(*latency).count();
+        latency_[engine_slot].record(static_cast<uint64_t>(std::max<int64_t>(micros, 0)));
+    }
+}
+
+MetricsRegistry::JobTable::const_iterator MetricsRegistry::find_live(const JobShard& shard, const FinishedEntry& entry) {
+    auto it = shard.jobs.find(*entry.key);
+    if (it != shard.jobs.end() && it->second.state != MonitoredJobState::Running &&
+        it->second.finish_sequence == entry.finish_sequence) {
+        return it;
+    }
+    return shard.jobs.end();
+}
+
+void MetricsRegistry::evict_finished(JobShard& shard) {
+    while (shard.jobs.size() > shard_capacity_ && !shard.finished.empty()) {
+        FinishedEntry entry = shard.finished.front();
+        shard.finished.pop_front();
+        auto it = find_live(shard, entry);
+        if (it != shard.jobs.end()) {
+            shard.jobs.erase(it);
+        }
+    }
+    // Jobs that finish repeatedly leave stale entries behind live ones; at most one
+    // entry per job is live, so compacting past twice the table keeps pushes O(1) amortized
+    if (shard.finished.size() > 2 * std::max(shard.jobs.size(), shard_capacity_)) {
+        std::erase_if(shard.finished, [&shard](const FinishedEntry& entry) {
+            return find_live(shard, entry) == shard.jobs.end();
+        });
+    }
+}
+
+void MetricsRegistry::record_session_end(bool halted) {
+    CounterShard& counters = writer_shard();
+    if (halted) {
+        counters.sessions_halted.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        counters.sessions_completed.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    MetricsSnapshot snapshot;
+
+    for (const auto& shard : counter_shards_) {
+        for (size_t slot = 0; slot < kEngineSlots; ++slot) {
+            snapshot.engines[slot].completed += shard.completed[slot].load(std::memory_order_acquire);
+            snapshot.engines[slot].failed += shard.failed[slot].load(std::memory_order_acquire);
+        }
+        snapshot.cache_hits += shard.cache_hits.load(std::memory_order_relaxed);
+        snapshot.sessions_completed += shard.sessions_completed.load(std::memory_order_relaxed);
+        snapshot.sessions_halted += shard.sessions_halted.load(std::memory_order_relaxed);
+    }
+    for (const auto& shard : counter_shards_) {
+        for (size_t slot = 0; slot < kEngineSlots; ++slot) {
+            snapshot.engines[slot].started += shard.started[slot].load(std::memory_order_relaxed);
+        }
+    }
+
+    return snapshot;
+}
+
+MonitorStats MetricsRegistry::stats() const {
+    MonitorStats stats;
+    MetricsSnapshot counters = snapshot();
+
+    int64_t first_start = first_start_ns_.load(std::memory_order_relaxed);
+    int64_t last_finish = last_finish_ns_.load(std::memory_order_relaxed);
+    if (last_finish > first_start) {
+        stats.window_seconds = static_cast<double>(last_finish - first_start) / 1e9;
+    }
+    stats.jobs_finished = counters.completed() + counters.failed();
+    if (stats.window_seconds > 0.0) {
+        stats.jobs_per_second = static_cast<double>(stats.jobs_finished) / stats.window_seconds;
+    }
+
+    for (size_t slot = 0; slot < kEngineSlots; ++slot) {
+        const EngineCounters& engine = counters.engines[slot];
+        if (slot == kUnattributedSlot && engine.started + engine.completed + engine.failed == 0) {
+            continue;
+        }
+        EngineStats engine_stats;
+        engine_stats.engine = std::string(engine_name(slot));
+        engine_stats.started = engine.started;
+        engine_stats.completed = engine.completed;
+        engine_stats.failed = engine.failed;
+        engine_stats.in_flight = engine.in_flight();
+        if (stats.window_seconds > 0.0) {
+            engine_stats.jobs_per_second =
+                static_cast<double>(engine.completed + engine.failed) / stats.window_seconds;
+        }
+        engine_stats.latency = latency_[slot].summarize();
+        stats.engines.push_back(std::move(engine_stats));
+    }
+    return stats;
+}
+
+std::vector<JobSummary> MetricsRegistry::jobs() const {
+    std::vector<JobSummary> summaries;
+    for (const auto& shard : job_shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& [key, record] : shard.jobs) {
+            summaries.push_back({
+                .job_id = key.job_id,
+                .engine = std::string(engine_name(record.engine_slot)),
+                .state = std::string(state_name(record.state)),
+                .session_id = key.session_id
+            });
+        }
+    }
+    std::sort(summaries.begin(), summaries.end(), [](const JobSummary& a, const JobSummary& b) {
+        return a.session_id != b.session_id ? a.session_id < b.session_id : a.job_id < b.job_id;
+    });
+    return summaries;
+}
+
+std::optional<JobDetail> MetricsRegistry::job(const std::string& job_id,
+                                              std::optional<std::string_view> session_id) const {
+    const JobShard& shard = job_shard(job_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    JobTable::const_iterator found = shard.jobs.end();
+    if (session_id) {
+        found = shard.jobs.find(JobKeyView{*session_id, job_id});
+    } else {
+        for (auto it = shard.jobs.begin(); it != shard.jobs.end(); ++it) {
+            if (it->first.job_id == job_id &&
+                (found == shard.jobs.end() || it->second.started_steady > found->second.started_steady)) {
+                found = it;
+            }
+        }
+    }
+    if (found == shard.jobs.end()) {
+        return std::nullopt;
+    }
+    const JobRecord& record = found->second;
+    return JobDetail{
+        .job_id = job_id,
+        .engine = std::string(engine_name(record.engine_slot)),
+        .state = std::string(state_name(record.state)),
+        .created_at = format_timestamp(record.started_at),
+        .completed_at = record.finished_at ? std::optional<std::string>(format_timestamp(*record.finished_at))
+                                           : std::nullopt,
+        .session_id = found->first.session_id
+    };
+}
+
+size_t MetricsRegistry::tracked_jobs() const {
+    size_t total = 0;
+    for (const auto& shard : job_shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.jobs.size();
+    }
+    return total;
+}
+
+size_t MetricsRegistry::eviction_backlog() const {
+    size_t total = 0;
+    for (const auto& shard : job_shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.finished.size();
+    }
+    return total;
+}
+
+void MetricsRegistry::reset() {
+    for (auto& shard : counter_shards_) {
+        for (size_t slot = 0; slot < kEngineSlots; ++slot) {
+            shard.started[slot].store(0, std::memory_order_relaxed);
+            shard.completed[slot].store(0, std::memory_order_relaxed);
+            shard.failed[slot].store(0, std::memory_order_relaxed);
+        }
+        shard.cache_hits.store(0, std::memory_order_relaxed);
+        shard.sessions_completed.store(0, std::memory_order_relaxed);
+        shard.sessions_halted.store(0, std::memory_order_relaxed);
+    }
+    for (auto& shard : job_shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.finished.clear();
+        shard.jobs.clear();
+    }
+    for (auto& histogram : latency_) {
+        histogram.reset();
+    }
+    first_start_ns_.store(INT64_MAX, std::memory_order_relaxed);
+    last_finish_ns_.store(INT64_MIN, std::memory_order_relaxed);
+}
+
+} // namespace nx::monitor
@@ -0,0 +1,298 @@
+#include "nx/monitor/MonitorQueryProtocol.h"
+#include "nx_batchflow_json.h"
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace nx::monitor {
+
+namespace {
+
+using nx::batchflow::JsonReader;
+using nx::batchflow::JsonWriter;
+
+constexpr std::pair<MonitorQueryKind, std::string_view> kQueryNames[] = {
+    {MonitorQueryKind::Status, "status"},
+    {MonitorQueryKind::Jobs, "jobs"},
+    {MonitorQueryKind::Job, "job"},
+    {MonitorQueryKind::Engines, "engines"},
+    {MonitorQueryKind::Version, "version"},
+    {MonitorQueryKind::Stats, "stats"},
+};
+
+std::string_view query_name(MonitorQueryKind kind) {
+    for (const auto& [candidate, name] : kQueryNames) {
+        if (candidate == kind) return name;
+    }
+    return "status";
+}
+
+void write_job_summary(JsonWriter& json, const JobSummary& job) {
+    json.begin_object();
+    json.key("job_id");
+    json.value(job.job_id);
+    json.key("session_id");
+    json.value(job.session_id);
+    json.key("engine");
+    json.value(job.engine);
+    json.key("state");
+    json.value(job.state);
+    json.end_object();
+}
+
+void write_job_detail(JsonWriter& json, const JobDetail& job) {
+    json.begin_object();
+    json.key("job_id");
+    json.value(job.job_id);
+    json.key("session_id");
+    json.value(job.session_id);
+    json.key("engine");
+    json.value(job.engine);
+    json.key("state");
+    json.value(job.state);
+    json.key("created_at");
+    json.value(job.created_at);
+    if (job.completed_at) {
+        json.key("completed_at");
+        json.value(*job.completed_at);
+    }
+    json.end_object();
+}
+
+void write_latency(JsonWriter& json, const LatencyStats& latency) {
+    json.begin_object();
+    json.key("count");
+    json.value(latency.count);
+    json.key("sum_us");
+    json.value(latency.sum_us);
+    json.key("min_us");
+    json.value(latency.min_us);
+    json.key("p50_us");
+    json.value(latency.p50_us);
+    json.key("p90_us");
+    json.value(latency.p90_us);
+    json.key("p99_us");
+    json.value(latency.p99_us);
+    json.key("p999_us");
+    json.value(latency.p999_us);
+    json.key("max_us");
+    json.value(latency.max_us);
+    json.key("buckets");
+    json.begin_array();
+    for (const auto& bucket : latency.buckets) {
+        json.begin_array();
+        json.value(bucket.upper_bound_us);
+        json.value(bucket.count);
+        json.end_array();
+    }
+    json.end_array();
+    json.end_object();
+}
+
+void write_stats(JsonWriter& json, const MonitorStats& stats) {
+    json.begin_object();
+    json.key("window_ns");
+    json.value(static_cast<uint64_t>(std::llround(stats.window_seconds * 1e9)));
+    json.key("jobs_finished");
+    json.value(stats.jobs_finished);
+    json.key("engines");
+    json.begin_array();
+    for (const auto& engine : stats.engines) {
+        json.begin_object();
+        json.key("engine");
+        json.value(engine.engine);
+        json.key("started");
+        json.value(engine.started);
+        json.key("completed");
+        json.value(engine.completed);
+        json.key("failed");
+        json.value(engine.failed);
+        json.key("in_flight");
+        json.value(engine.in_flight);
+        json.key("latency");
+        write_latency(json, engine.latency);
+        json.end_object();
+    }
+    json.end_array();
+    json.key("profile_samples_dropped");
+    json.value(stats.profile_samples_dropped);
+    json.key("profile_zones");
+    json.begin_array();
+    for (const auto& zone : stats.profile_zones) {
+        json.begin_object();
+        json.key("zone");
+        json.value(zone.zone);
+        json.key("count");
+        json.value(zone.count);
+        json.key("total_ns");
+        json.value(zone.total_ns);
+        json.key("max_ns");
+        json.value(zone.max_ns);
+        json.end_object();
+    }
+    json.end_array();
+    json.end_object();
+}
+
+void write_result(JsonWriter& json, const MonitorEngine& engine, const MonitorQuery& query) {
+    switch (query.kind) {
+        case MonitorQueryKind::Status: {
+            SystemStatus status = engine.status();
+            json.begin_object();
+            json.key("healthy");
+            json.value(status.healthy);
+            json.key("active_jobs");
+            json.value(static_cast<uint64_t>(status.active_jobs));
+            json.key("completed_jobs");
+            json.value(static_cast<uint64_t>(status.completed_jobs));
+            json.key("failed_jobs");
+            json.value(static_cast<uint64_t>(status.failed_jobs));
+            json.end_object();
+            break;
+        }
+        case MonitorQueryKind::Jobs:
+            json.begin_array();
+            for (const auto& job : engine.jobs()) {
+                write_job_summary(json, job);
+            }
+            json.end_array();
+            break;
+        case MonitorQueryKind::Job: {
+            auto job = query.session_id.empty()
+                ? engine.job(query.job_id)
+                : engine.job_in_session(query.job_id, query.session_id);
+            json.begin_object();
+            if (job) {
+                json.key("job");
+                write_job_detail(json, *job);
+            }
+            json.end_object();
+            break;
+        }
+        case MonitorQueryKind::Engines:
+            json.begin_array();
+            for (const auto& info : engine.engines()) {
+                json.begin_object();
+                json.key("name");
+                json.value(info.name);
+                json.key("version");
+                json.value(info.version);
+                json.key("available");
+                json.value(info.available);
+                json.end_object();
+            }
+            json.end_array();
+            break;
+        case MonitorQueryKind::Version: {
+            EngineVersion version = engine.version();
+            json.begin_object();
+            json.key("name");
+            json.value(version.name);
+            json.key("version");
+            json.value(version.version);
+            json.key("build_id");
+            json.value(version.build_id);
+            json.end_object();
+            break;
+        }
+        case MonitorQueryKind::Stats:
+            write_stats(json, engine.stats());
+            break;
+    }
+}
+
+} // namespace
+
+std::string encode_monitor_query(const MonitorQuery& query) {
+    std::string line;
+    JsonWriter json(line);
+    json.begin_object();
+    json.key("query");
+    json.value(query_name(query.kind));
+    if (query.kind == MonitorQueryKind::Job) {
+        json.key("job_id");
+        json.value(query.job_id);
+        if (!query.session_id.empty()) {
+            json.key("session_id");
+            json.value(query.session_id);
+        }
+    }
+    json.end_object();
+    line += '\n';
+    return line;
+}
+
+MonitorQuery decode_monitor_query(std::string_view request) {
+    JsonReader reader(request);
+    MonitorQuery query;
+    bool has_kind = false;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "query") {
+            std::string_view name = reader.read_string();
+            for (const auto& [kind, candidate] : kQueryNames) {
+                if (candidate == name) {
+                    query.kind = kind;
+                    has_kind = true;
+                }
+            }
+            if (!has_kind) {
+                throw std::invalid_argument("unknown monitor query: " + std::string(name));
+            }
+        } else if (key == "job_id") {
+            query.job_id = reader.read_string();
+        } else if (key == "session_id") {
+            query.session_id = reader.read_string();
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.expect_end();
+
+    if (!has_kind) {
+        throw std::invalid_argument("monitor query without \"query\"");
+    }
+    if (query.kind == MonitorQueryKind::Job && query.job_id.empty()) {
+        throw std::invalid_argument("job query without \"job_id\"");
+    }
+    return query;
+}
+
+std::string answer_monitor_query(const MonitorEngine& engine, std::string_view request) {
+    std::string response;
+    try {
+        MonitorQuery query = decode_monitor_query(request);
+        std::string result;
+        JsonWriter result_json(result);
+        write_result(result_json, engine, query);
+
+        JsonWriter json(response);
+        json.begin_object();
+        json.key("ok");
+        json.value(true);
+        json.key("result");
+        json.raw_value(result);
+        json.end_object();
+        response += '\n';
+    } catch (const std::exception& e) {
+        response = monitor_query_error(e.what());
+    }
+    return response;
+}
+
+std::string monitor_query_error(std::string_view message) {
+    std::string response;
+    JsonWriter json(response);
+    json.begin_object();
+    json.key("ok");
+    json.value(false);
+    json.key("error");
+    json.value(message);
+    json.end_object();
+    response += '\n';
+    return response;
+}
+
+} // namespace nx::monitor
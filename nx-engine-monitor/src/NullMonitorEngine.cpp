@@ -6,7 +6,8 @@ SystemStatus NullMonitorEngine::status() const {
     return {
         .healthy = true,
         .active_jobs = 0,
-        .completed_jobs = 0
+        .completed_jobs = 0,
+        .failed_jobs = 0
     };
 }
 
@@ -36,4 +37,8 @@ EngineVersion NullMonitorEngine::version() const {
     };
 }
 
+MonitorStats NullMonitorEngine::stats() const {
+    return {};
+}
+
 } // namespace nx::monitor
\ No newline at end of file
@@ -0,0 +1,550 @@
+#include "nx/monitor/OpenMetricsExporter.h"
+#include "nx/monitor/MonitorQueryProtocol.h"
+#include "nx_temp_file.h"
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace nx::monitor {
+
+namespace {
+
+constexpr const char* kContentType = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+constexpr size_t kMaxQuerySize = 64 * 1024;
+
+// How long a client that has sent nothing may still turn out to be HTTP or a query
+constexpr std::chrono::milliseconds kRequestGrace{10};
+// How long a started monitor query line may take to arrive in full
+constexpr std::chrono::milliseconds kQueryLineTimeout{1000};
+// How long a scrape client may take to drain its response
+constexpr std::chrono::milliseconds kScrapeWriteTimeout{1000};
+
+// Exported le bounds are 2^k - 1 microseconds: every power of two starts a new
+// LatencyHistogram bucket, so these coincide with internal bucket edges and the
+// cumulative counts are exact rather than interpolated
+constexpr unsigned kLatencyBoundFirstExponent = 4;   // 15 us
+constexpr unsigned kLatencyBoundLastExponent = 32;   // ~71.6 min
+
+// Label values escape backslash, double quote and newline
+std::string escape_label(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        switch (c) {
+            case '\\': escaped += "\\\\"; break;
+            case '"': escaped += "\\\""; break;
+            case '\n': escaped += "\\n"; break;
+            default: escaped += c;
+        }
+    }
+    return escaped;
+}
+
+// Exact decimal seconds from integer microseconds, e.g. 1500 -> 0.0015
+std::string micros_to_seconds(uint64_t micros) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%" PRIu64 ".%06" PRIu64, micros / 1000000, micros % 1000000);
+    std::string text = buffer;
+    while (text.back() == '0') text.pop_back();
+    if (text.back() == '.') text.pop_back();
+    return text;
+}
+
+// Exact decimal seconds from integer nanoseconds, e.g. 1500 -> 0.0000015
+std::string nanos_to_seconds(uint64_t nanos) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%" PRIu64 ".%09" PRIu64, nanos / 1000000000, nanos % 1000000000);
+    std::string text = buffer;
+    while (text.back() == '0') text.pop_back();
+    if (text.back() == '.') text.pop_back();
+    return text;
+}
+
+std::string format_double(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+    return buffer;
+}
+
+void append_family(std::string& out, const char* name, const char* type, const char* help,
+                   const char* unit = nullptr) {
+    out += "# TYPE ";
+    out += name;
+    out += ' ';
+    out += type;
+    out += '\n';
+    if (unit) {
+        out += "# UNIT ";
+        out += name;
+        out += ' ';
+        out += unit;
+        out += '\n';
+    }
+    out += "# HELP ";
+    out += name;
+    out += ' ';
+    out += help;
+    out += '\n';
+}
+
+void append_sample(std::string& out, const std::string& name, const std::string& labels, const std::string& value) {
+    out += name;
+    if (!labels.empty()) {
+        out += '{';
+        out += labels;
+        out += '}';
+    }
+    out += ' ';
+    out += value;
+    out += '\n';
+}
+
+#ifndef _WIN32
+bool send_all(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t sent = ::send(fd, data, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+// Clear a stale socket left by a previous run, refusing to touch anything else:
+// a regular file or directory at the path, or a socket another exporter is
+// still accepting on, makes the constructor throw instead of unlinking it
+void claim_socket_path(const std::string& path, const sockaddr_un& address) {
+    struct stat info {};
+    if (::lstat(path.c_str(), &info) != 0) {
+        if (errno == ENOENT) return;
+        throw std::system_error(errno, std::generic_category(), "OpenMetricsExporter: lstat " + path);
+    }
+    if (!S_ISSOCK(info.st_mode)) {
+        throw std::runtime_error("OpenMetricsExporter: " + path + " exists and is not a socket");
+    }
+
+    int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) {
+        throw std::system_error(errno, std::generic_category(), "OpenMetricsExporter: socket()");
+    }
+    int connected = ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+    int error = errno;
+    ::close(probe);
+    if (connected == 0) {
+        throw std::runtime_error("OpenMetricsExporter: another process is listening on " + path);
+    }
+    if (error != ECONNREFUSED) {
+        throw std::system_error(error, std::generic_category(), "OpenMetricsExporter: probe " + path);
+    }
+    if (::unlink(path.c_str()) != 0 && errno != ENOENT) {
+        throw std::system_error(errno, std::generic_category(), "OpenMetricsExporter: unlink " + path);
+    }
+}
+#endif
+
+} // namespace
+
+std::string render_openmetrics(const MonitorEngine& engine) {
+    SystemStatus status = engine.status();
+    MonitorStats stats = engine.stats();
+
+    std::string out;
+    out.reserve(1024 + stats.engines.size() * 1024);
+
+    append_family(out, "nx_monitor_healthy", "gauge", "Monitor engine health (1 = healthy).");
+    append_sample(out, "nx_monitor_healthy", "", status.healthy ? "1" : "0");
+
+    std::vector<std::string> labels;
+    labels.reserve(stats.engines.size());
+    for (const auto& engine_stats : stats.engines) {
+        labels.push_back("engine=\"" + escape_label(engine_stats.engine) + "\"");
+    }
+
+    append_family(out, "nx_jobs_started", "counter", "Jobs that entered Running.");
+    for (size_t i = 0; i < stats.engines.size(); ++i) {
+        append_sample(out, "nx_jobs_started_total", labels[i], std::to_string(stats.engines[i].started));
+    }
+    append_family(out, "nx_jobs_completed", "counter", "Jobs that reached Completed.");
+    for (size_t i = 0; i < stats.engines.size(); ++i) {
+        append_sample(out, "nx_jobs_completed_total", labels[i], std::to_string(stats.engines[i].completed));
+    }
+    append_family(out, "nx_jobs_failed", "counter", "Jobs that reached Failed.");
+    for (size_t i = 0; i < stats.engines.size(); ++i) {
+        append_sample(out, "nx_jobs_failed_total", labels[i], std::to_string(stats.engines[i].failed));
+    }
+    append_family(out, "nx_jobs_in_flight", "gauge", "Jobs currently running per engine.");
+    for (size_t i = 0; i < stats.engines.size(); ++i) {
+        append_sample(out, "nx_jobs_in_flight", labels[i], std::to_string(stats.engines[i].in_flight));
+    }
+    append_family(out, "nx_job_throughput_jobs_per_second", "gauge",
+                  "Finished jobs per second over the observed window.");
+    for (size_t i = 0; i < stats.engines.size(); ++i) {
+        append_sample(out, "nx_job_throughput_jobs_per_second", labels[i],
+                      format_double(stats.engines[i].jobs_per_second));
+    }
+
+    append_family(out, "nx_job_latency_seconds", "histogram", "Job time from Running to a terminal state.",
+                  "seconds");
+    for (size_t i = 0; i < stats.engines.size(); ++i) {
+        const LatencyStats& latency = stats.engines[i].latency;
+        uint64_t cumulative = 0;
+        auto bucket = latency.buckets.begin();
+        for (unsigned exponent = kLatencyBoundFirstExponent; exponent <= kLatencyBoundLastExponent; ++exponent) {
+            const uint64_t bound_us = (uint64_t{1} << exponent) - 1;
+            for (; bucket != latency.buckets.end() && bucket->upper_bound_us <= bound_us; ++bucket) {
+                cumulative += bucket->count;
+            }
+            append_sample(out, "nx_job_latency_seconds_bucket",
+                          labels[i] + ",le=\"" + micros_to_seconds(bound_us) + "\"",
+                          std::to_string(cumulative));
+        }
+        append_sample(out, "nx_job_latency_seconds_bucket", labels[i] + ",le=\"+Inf\"",
+                      std::to_string(latency.count));
+        append_sample(out, "nx_job_latency_seconds_count", labels[i], std::to_string(latency.count));
+        append_sample(out, "nx_job_latency_seconds_sum", labels[i], micros_to_seconds(latency.sum_us));
+    }
+
+    if (!stats.profile_zones.empty()) {
+        std::vector<std::string> zone_labels;
+        zone_labels.reserve(stats.profile_zones.size());
+        for (const auto& zone : stats.profile_zones) {
+            zone_labels.push_back("zone=\"" + escape_label(zone.zone) + "\"");
+        }
+        append_family(out, "nx_profile_zone_calls", "counter", "Times each profiling zone was entered.");
+        for (size_t i = 0; i < stats.profile_zones.size(); ++i) {
+            append_sample(out, "nx_profile_zone_calls_total", zone_labels[i],
+                          std::to_string(stats.profile_zones[i].count));
+        }
+        append_family(out, "nx_profile_zone_seconds", "counter", "Total time spent inside each profiling zone.",
+                      "seconds");
+        for (size_t i = 0; i < stats.profile_zones.size(); ++i) {
+            append_sample(out, "nx_profile_zone_seconds_total", zone_labels[i],
+                          nanos_to_seconds(stats.profile_zones[i].total_ns));
+        }
+        append_family(out, "nx_profile_zone_max_seconds", "gauge", "Longest single pass through each profiling zone.",
+                      "seconds");
+        for (size_t i = 0; i < stats.profile_zones.size(); ++i) {
+            append_sample(out, "nx_profile_zone_max_seconds", zone_labels[i],
+                          nanos_to_seconds(stats.profile_zones[i].max_ns));
+        }
+        append_family(out, "nx_profile_samples_dropped", "counter", "Profiling samples overwritten before collection.");
+        append_sample(out, "nx_profile_samples_dropped_total", "", std::to_string(stats.profile_samples_dropped));
+    }
+
+    out += "# EOF\n";
+    return out;
+}
+
+OpenMetricsExporter::OpenMetricsExporter(const MonitorEngine& engine, OpenMetricsExportOptions options)
+    : engine_(engine)
+    , options_(std::move(options)) {
+    if (options_.file_path.empty() && options_.socket_path.empty()) {
+        throw std::invalid_argument("OpenMetricsExporter requires a file path or socket path");
+    }
+
+    refresh();
+
+    if (!options_.socket_path.empty()) {
+#ifdef _WIN32
+        throw std::runtime_error("OpenMetricsExporter: Unix-domain sockets are not supported on this platform");
+#else
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        const std::string path = options_.socket_path.string();
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("OpenMetricsExporter: socket path too long: " + path);
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        claim_socket_path(path, address);
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "OpenMetricsExporter: socket()");
+        }
+        if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(listen_fd_, 16) != 0) {
+            int error = errno;
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+            throw std::system_error(error, std::generic_category(), "OpenMetricsExporter: bind " + path);
+        }
+        socket_thread_ = std::thread([this] { socket_loop(); });
+        query_thread_ = std::thread([this] { query_loop(); });
+#endif
+    }
+
+    render_thread_ = std::thread([this] { render_loop(); });
+}
+
+OpenMetricsExporter::~OpenMetricsExporter() {
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        stopping_.store(true);
+    }
+    stop_cv_.notify_all();
+    query_cv_.notify_all();
+    if (render_thread_.joinable()) render_thread_.join();
+    if (socket_thread_.joinable()) socket_thread_.join();
+    if (query_thread_.joinable()) query_thread_.join();
+#ifndef _WIN32
+    if (listen_fd_ >= 0) {
+        ::close(listen_fd_);
+        ::unlink(options_.socket_path.string().c_str());
+    }
+#endif
+}
+
+std::shared_ptr<const std::string> OpenMetricsExporter::current() const {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    return buffer_;
+}
+
+void OpenMetricsExporter::refresh() {
+    std::lock_guard<std::mutex> refresh_lock(refresh_mutex_);
+    auto rendered = std::make_shared<const std::string>(render_openmetrics(engine_));
+    {
+        std::lock_guard<std::mutex> lock(buffer_mutex_);
+        buffer_ = rendered;
+    }
+    if (!options_.file_path.empty()) {
+        write_file(*rendered);
+    }
+}
+
+uint64_t OpenMetricsExporter::scrape_count() const {
+    return scrapes_.load(std::memory_order_relaxed);
+}
+
+uint64_t OpenMetricsExporter::query_count() const {
+    return queries_.load(std::memory_order_relaxed);
+}
+
+void OpenMetricsExporter::render_loop() {
+    std::unique_lock<std::mutex> lock(stop_mutex_);
+    while (!stop_cv_.wait_for(lock, options_.interval, [this] { return stopping_.load(); })) {
+        lock.unlock();
+        try {
+            refresh();
+        } catch (const std::exception&) {
+            // Keep serving the previous buffer; the next interval retries
+        }
+        lock.lock();
+    }
+}
+
+void OpenMetricsExporter::write_file(const std::string& content) const {
+    // Private temp name: another exporter or a crashed run may target the same file
+    auto temp_path = nx::core::unique_temp_path(options_.file_path);
+    try {
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!file || !file.write(content.data(), static_cast<std::streamsize>(content.size())) || !file.flush()) {
+                throw std::runtime_error("OpenMetricsExporter: cannot write " + temp_path.string());
+            }
+        }
+        std::filesystem::rename(temp_path, options_.file_path);
+    } catch (...) {
+        std::error_code ignored;
+        std::filesystem::remove(temp_path, ignored);
+        throw;
+    }
+}
+
+void OpenMetricsExporter::socket_loop() {
+#ifndef _WIN32
+    using Clock = std::chrono::steady_clock;
+    std::vector<Client> clients;
+    std::vector<pollfd> fds;
+
+    while (!stopping_.load()) {
+        // Wake for the nearest client deadline, or every 100 ms to observe stopping_
+        auto now = Clock::now();
+        auto wait = std::chrono::milliseconds(100);
+        for (const auto& client : clients) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(client.deadline - now);
+            wait = std::clamp(left, std::chrono::milliseconds(0), wait);
+        }
+
+        fds.assign(1, pollfd{listen_fd_, POLLIN, 0});
+        for (const auto& client : clients) {
+            fds.push_back(pollfd{client.fd, static_cast<short>(client.body ? POLLOUT : POLLIN), 0});
+        }
+        if (::poll(fds.data(), fds.size(), static_cast<int>(wait.count())) < 0) {
+            continue;
+        }
+
+        // Advance clients that sent data, drained output or hung up; time out the rest
+        now = Clock::now();
+        size_t kept = 0;
+        for (size_t i = 0; i < clients.size(); ++i) {
+            Client& client = clients[i];
+            bool done;
+            if (client.body) {
+                done = fds[i + 1].revents ? send_scrape(client) : false;
+                if (!done && now >= client.deadline) {
+                    ::close(client.fd);   // Stalled reader
+                    done = true;
+                }
+            } else {
+                bool closed = false;
+                if (fds[i + 1].revents) {
+                    char buffer[512];
+                    ssize_t received = ::recv(client.fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+                    if (received > 0) {
+                        if (client.request.empty() && buffer[0] == '{') {
+                            client.deadline = now + kQueryLineTimeout;
+                        }
+                        client.request.append(buffer, static_cast<size_t>(received));
+                    } else if (received == 0 || (errno != EAGAIN && errno != EINTR)) {
+                        closed = true;
+                    }
+                }
+                done = dispatch(client, closed || now >= client.deadline);
+            }
+            if (!done) {
+                clients[kept++] = std::move(client);
+            }
+        }
+        clients.resize(kept);
+
+        if (fds[0].revents & POLLIN) {
+            int client_fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (client_fd >= 0) {
+                // Bounds blocking query answers; scrapes are written without blocking
+                timeval send_timeout{1, 0};
+                ::setsockopt(client_fd, SOL_SOCKET, SO_SNDTIMEO, &send_timeout, sizeof(send_timeout));
+                clients.push_back(Client{client_fd, {}, now + kRequestGrace, nullptr, {}, 0});
+            }
+        }
+    }
+
+    for (const auto& client : clients) {
+        ::close(client.fd);
+    }
+#endif
+}
+
+// Answers or hands off a client once its request is known; false keeps it with the socket thread
+bool OpenMetricsExporter::dispatch(Client& client, bool final) {
+#ifndef _WIN32
+    const std::string& request = client.request;
+    if (!request.empty() && request[0] == '{') {
+        // Monitor query: the query thread reads the engine, so scrapes never wait on it
+        auto end = request.find('\n');
+        if (end == std::string::npos && request.size() < kMaxQuerySize && !final) {
+            return false;
+        }
+        bool queued = false;
+        {
+            std::lock_guard<std::mutex> lock(query_mutex_);
+            if (query_queue_.size() < kMaxQueuedQueries) {
+                query_queue_.emplace_back(client.fd, request.substr(0, end));
+                queued = true;
+            }
+        }
+        if (queued) {
+            query_cv_.notify_one();
+        } else {
+            // Best effort: the answer fits an empty socket buffer, and a full one is not waited on
+            std::string response = monitor_query_error("monitor query queue full");
+            ::send(client.fd, response.data(), response.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+            ::close(client.fd);
+        }
+        return true;
+    }
+
+    static constexpr std::string_view kGet = "GET ";
+    bool http = request.starts_with(kGet);
+    if (!http && kGet.starts_with(request) && !final) {
+        return false;   // Nothing yet, or a prefix of "GET "
+    }
+
+    client.body = current();
+    if (http) {
+        client.header = "HTTP/1.0 200 OK\r\nContent-Type: ";
+        client.header += kContentType;
+        client.header += "\r\nContent-Length: " + std::to_string(client.body->size()) +
+                         "\r\nConnection: close\r\n\r\n";
+    }
+    client.deadline = std::chrono::steady_clock::now() + kScrapeWriteTimeout;
+    return send_scrape(client);
+#else
+    (void)client;
+    (void)final;
+    return true;
+#endif
+}
+
+// Writes as much of a scrape as the socket takes; true once it is complete or failed
+bool OpenMetricsExporter::send_scrape(Client& client) {
+#ifndef _WIN32
+    const size_t total = client.header.size() + client.body->size();
+    while (client.sent < total) {
+        std::string_view rest = client.sent < client.header.size()
+            ? std::string_view(client.header).substr(client.sent)
+            : std::string_view(*client.body).substr(client.sent - client.header.size());
+        ssize_t sent = ::send(client.fd, rest.data(), rest.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return false;
+            break;
+        }
+        client.sent += static_cast<size_t>(sent);
+    }
+    if (client.sent == total) {
+        scrapes_.fetch_add(1, std::memory_order_relaxed);
+    }
+    ::close(client.fd);
+#else
+    (void)client;
+#endif
+    return true;
+}
+
+void OpenMetricsExporter::query_loop() {
+#ifndef _WIN32
+    std::unique_lock<std::mutex> lock(query_mutex_);
+    while (true) {
+        query_cv_.wait(lock, [this] { return stopping_.load() || !query_queue_.empty(); });
+        if (query_queue_.empty()) {
+            return;
+        }
+        auto [client_fd, line] = std::move(query_queue_.front());
+        query_queue_.pop_front();
+        if (stopping_.load()) {
+            ::close(client_fd);
+            continue;
+        }
+        lock.unlock();
+
+        std::string response = answer_monitor_query(engine_, line);
+        if (send_all(client_fd, response.data(), response.size())) {
+            queries_.fetch_add(1, std::memory_order_relaxed);
+        }
+        ::close(client_fd);
+
+        lock.lock();
+    }
+#endif
+}
+
+} // namespace nx::monitor
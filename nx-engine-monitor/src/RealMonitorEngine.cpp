@@ -1,21 +1,58 @@
 #include "nx/monitor/RealMonitorEngine.h"
+#include "nx_profile.h"
 
 namespace nx::monitor {
 
+RealMonitorEngine::RealMonitorEngine()
+    : registry_(&MetricsRegistry::global()) {
+}
+
+RealMonitorEngine::RealMonitorEngine(const MetricsRegistry& registry)
+    : registry_(&registry) {
+}
+
 SystemStatus RealMonitorEngine::status() const {
+    auto snapshot = registry_->snapshot();
     return {
         .healthy = true,
-        .active_jobs = 0,
-        .completed_jobs = 0
+        .active_jobs = snapshot.running(),
+        .completed_jobs = snapshot.completed(),
+        .failed_jobs = snapshot.failed()
     };
 }
 
 std::vector<JobSummary> RealMonitorEngine::jobs() const {
-    return {};
+    return registry_->jobs();
+}
+
+std::optional<JobDetail> RealMonitorEngine::job(const std::string& job_id) const {
+    return registry_->job(job_id);
+}
+
+std::optional<JobDetail> RealMonitorEngine::job_in_session(const std::string& job_id,
+                                                           const std::string& session_id) const {
+    return registry_->job(job_id, session_id);
+}
+
+MonitorStats RealMonitorEngine::stats() const {
+    MonitorStats stats = registry_->stats();
+    
+    auto profile = nx::profile::collect();
+    stats.profile_samples_dropped = profile.dropped;
+    stats.profile_zones.reserve(profile.zones.size());
+    for (auto& zone : profile.zones) {
+        stats.profile_zones.push_back({
+            .zone = std::move(zone.name),
+            .count = zone.count,
+            .total_ns = zone.total_ns,
+            .max_ns = zone.max_ns
+        });
+    }
+    return stats;
 }
 
-std::optional<JobDetail> RealMonitorEngine::job(const std::string&) const {
-    return std::nullopt;
+MetricsSnapshot RealMonitorEngine::metrics() const {
+    return registry_->snapshot();
 }
 
 std::vector<EngineInfo> RealMonitorEngine::engines() const {
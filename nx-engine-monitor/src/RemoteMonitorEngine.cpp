@@ -0,0 +1,366 @@
+#include "nx/monitor/RemoteMonitorEngine.h"
+#include "nx/monitor/MonitorQueryProtocol.h"
+#include "nx/monitor/OpenMetricsExporter.h"
+#include "nx_batchflow_json.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <utility>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace nx::monitor {
+
+namespace {
+
+using nx::batchflow::JsonReader;
+
+// A live process answers within milliseconds; a hung one must not hang the CLI
+constexpr time_t kReplyTimeoutSeconds = 5;
+
+std::string read_owned_string(JsonReader& reader) {
+    return std::string(reader.read_string());
+}
+
+SystemStatus read_status(JsonReader& reader) {
+    SystemStatus status{.healthy = false, .active_jobs = 0, .completed_jobs = 0, .failed_jobs = 0};
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "healthy") status.healthy = reader.read_bool();
+        else if (key == "active_jobs") status.active_jobs = reader.read_uint();
+        else if (key == "completed_jobs") status.completed_jobs = reader.read_uint();
+        else if (key == "failed_jobs") status.failed_jobs = reader.read_uint();
+        else reader.skip_value();
+    }
+    return status;
+}
+
+JobSummary read_job_summary(JsonReader& reader) {
+    JobSummary job;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "job_id") job.job_id = read_owned_string(reader);
+        else if (key == "session_id") job.session_id = read_owned_string(reader);
+        else if (key == "engine") job.engine = read_owned_string(reader);
+        else if (key == "state") job.state = read_owned_string(reader);
+        else reader.skip_value();
+    }
+    return job;
+}
+
+JobDetail read_job_detail(JsonReader& reader) {
+    JobDetail job;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "job_id") job.job_id = read_owned_string(reader);
+        else if (key == "session_id") job.session_id = read_owned_string(reader);
+        else if (key == "engine") job.engine = read_owned_string(reader);
+        else if (key == "state") job.state = read_owned_string(reader);
+        else if (key == "created_at") job.created_at = read_owned_string(reader);
+        else if (key == "completed_at") job.completed_at = read_owned_string(reader);
+        else reader.skip_value();
+    }
+    return job;
+}
+
+std::optional<JobDetail> read_job_lookup(JsonReader& reader) {
+    std::optional<JobDetail> job;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "job") job = read_job_detail(reader);
+        else reader.skip_value();
+    }
+    return job;
+}
+
+LatencyStats read_latency(JsonReader& reader) {
+    LatencyStats latency;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "count") latency.count = reader.read_uint();
+        else if (key == "sum_us") latency.sum_us = reader.read_uint();
+        else if (key == "min_us") latency.min_us = reader.read_uint();
+        else if (key == "p50_us") latency.p50_us = reader.read_uint();
+        else if (key == "p90_us") latency.p90_us = reader.read_uint();
+        else if (key == "p99_us") latency.p99_us = reader.read_uint();
+        else if (key == "p999_us") latency.p999_us = reader.read_uint();
+        else if (key == "max_us") latency.max_us = reader.read_uint();
+        else if (key == "buckets") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                LatencyBucket bucket{};
+                reader.begin_array();
+                if (!reader.next_element()) reader.fail("expected bucket upper bound");
+                bucket.upper_bound_us = reader.read_uint();
+                if (!reader.next_element()) reader.fail("expected bucket count");
+                bucket.count = reader.read_uint();
+                if (reader.next_element()) reader.fail("unexpected bucket field");
+                latency.buckets.push_back(bucket);
+            }
+        } else {
+            reader.skip_value();
+        }
+    }
+    return latency;
+}
+
+MonitorStats read_stats(JsonReader& reader) {
+    MonitorStats stats;
+    uint64_t window_ns = 0;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "window_ns") {
+            window_ns = reader.read_uint();
+        } else if (key == "jobs_finished") {
+            stats.jobs_finished = reader.read_uint();
+        } else if (key == "engines") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                EngineStats engine;
+                reader.begin_object();
+                std::string_view engine_key;
+                while (reader.next_key(engine_key)) {
+                    if (engine_key == "engine") engine.engine = read_owned_string(reader);
+                    else if (engine_key == "started") engine.started = reader.read_uint();
+                    else if (engine_key == "completed") engine.completed = reader.read_uint();
+                    else if (engine_key == "failed") engine.failed = reader.read_uint();
+                    else if (engine_key == "in_flight") engine.in_flight = reader.read_uint();
+                    else if (engine_key == "latency") engine.latency = read_latency(reader);
+                    else reader.skip_value();
+                }
+                stats.engines.push_back(std::move(engine));
+            }
+        } else if (key == "profile_samples_dropped") {
+            stats.profile_samples_dropped = reader.read_uint();
+        } else if (key == "profile_zones") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                ProfileZoneStats zone;
+                reader.begin_object();
+                std::string_view zone_key;
+                while (reader.next_key(zone_key)) {
+                    if (zone_key == "zone") zone.zone = read_owned_string(reader);
+                    else if (zone_key == "count") zone.count = reader.read_uint();
+                    else if (zone_key == "total_ns") zone.total_ns = reader.read_uint();
+                    else if (zone_key == "max_ns") zone.max_ns = reader.read_uint();
+                    else reader.skip_value();
+                }
+                stats.profile_zones.push_back(std::move(zone));
+            }
+        } else {
+            reader.skip_value();
+        }
+    }
+
+    // Same derivation as MetricsRegistry::stats()
+    stats.window_seconds = static_cast<double>(window_ns) / 1e9;
+    if (stats.window_seconds > 0.0) {
+        stats.jobs_per_second = static_cast<double>(stats.jobs_finished) / stats.window_seconds;
+        for (auto& engine : stats.engines) {
+            engine.jobs_per_second = static_cast<double>(engine.completed + engine.failed) / stats.window_seconds;
+        }
+    }
+    return stats;
+}
+
+std::vector<EngineInfo> read_engines(JsonReader& reader) {
+    std::vector<EngineInfo> engines;
+    reader.begin_array();
+    while (reader.next_element()) {
+        EngineInfo info{.name = {}, .version = {}, .available = false};
+        reader.begin_object();
+        std::string_view key;
+        while (reader.next_key(key)) {
+            if (key == "name") info.name = read_owned_string(reader);
+            else if (key == "version") info.version = read_owned_string(reader);
+            else if (key == "available") info.available = reader.read_bool();
+            else reader.skip_value();
+        }
+        engines.push_back(std::move(info));
+    }
+    return engines;
+}
+
+EngineVersion read_version(JsonReader& reader) {
+    EngineVersion version;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "name") version.name = read_owned_string(reader);
+        else if (key == "version") version.version = read_owned_string(reader);
+        else if (key == "build_id") version.build_id = read_owned_string(reader);
+        else reader.skip_value();
+    }
+    return version;
+}
+
+// Unwrap {"ok":true,"result":...} / {"ok":false,"error":"..."}
+template <typename ReadResult>
+auto read_response(const std::string& response, ReadResult&& read_result) {
+    using Result = decltype(read_result(std::declval<JsonReader&>()));
+    std::optional<Result> result;
+    bool ok = false;
+    std::string error = "response without result";
+    try {
+        JsonReader reader(response);
+        reader.begin_object();
+        std::string_view key;
+        while (reader.next_key(key)) {
+            if (key == "ok") ok = reader.read_bool();
+            else if (key == "result") result = read_result(reader);
+            else if (key == "error") error = read_owned_string(reader);
+            else reader.skip_value();
+        }
+        reader.expect_end();
+    } catch (const nx::batchflow::JsonParseError& e) {
+        throw MonitorSourceError(std::string("malformed monitor response: ") + e.what());
+    }
+    if (!ok || !result) {
+        throw MonitorSourceError("monitor query failed: " + error);
+    }
+    return std::move(*result);
+}
+
+MonitorQuery job_query(const std::string& job_id, const std::string& session_id) {
+    MonitorQuery query;
+    query.kind = MonitorQueryKind::Job;
+    query.job_id = job_id;
+    query.session_id = session_id;
+    return query;
+}
+
+MonitorQuery simple_query(MonitorQueryKind kind) {
+    MonitorQuery query;
+    query.kind = kind;
+    return query;
+}
+
+} // namespace
+
+RemoteMonitorEngine::RemoteMonitorEngine(std::filesystem::path socket_path)
+    : socket_path_(std::move(socket_path)) {
+}
+
+std::unique_ptr<RemoteMonitorEngine> RemoteMonitorEngine::from_environment() {
+    const char* socket_path = std::getenv(kMonitorSocketEnv);
+    if (!socket_path || !*socket_path) {
+        return nullptr;
+    }
+    return std::make_unique<RemoteMonitorEngine>(socket_path);
+}
+
+const std::filesystem::path& RemoteMonitorEngine::socket_path() const {
+    return socket_path_;
+}
+
+SystemStatus RemoteMonitorEngine::status() const {
+    return read_response(exchange(encode_monitor_query(simple_query(MonitorQueryKind::Status))), read_status);
+}
+
+std::vector<JobSummary> RemoteMonitorEngine::jobs() const {
+    return read_response(exchange(encode_monitor_query(simple_query(MonitorQueryKind::Jobs))),
+                         [](JsonReader& reader) {
+                             std::vector<JobSummary> jobs;
+                             reader.begin_array();
+                             while (reader.next_element()) {
+                                 jobs.push_back(read_job_summary(reader));
+                             }
+                             return jobs;
+                         });
+}
+
+std::optional<JobDetail> RemoteMonitorEngine::job(const std::string& job_id) const {
+    return read_response(exchange(encode_monitor_query(job_query(job_id, {}))), read_job_lookup);
+}
+
+std::optional<JobDetail> RemoteMonitorEngine::job_in_session(const std::string& job_id,
+                                                             const std::string& session_id) const {
+    return read_response(exchange(encode_monitor_query(job_query(job_id, session_id))), read_job_lookup);
+}
+
+std::vector<EngineInfo> RemoteMonitorEngine::engines() const {
+    return read_response(exchange(encode_monitor_query(simple_query(MonitorQueryKind::Engines))), read_engines);
+}
+
+EngineVersion RemoteMonitorEngine::version() const {
+    return read_response(exchange(encode_monitor_query(simple_query(MonitorQueryKind::Version))), read_version);
+}
+
+MonitorStats RemoteMonitorEngine::stats() const {
+    return read_response(exchange(encode_monitor_query(simple_query(MonitorQueryKind::Stats))), read_stats);
+}
+
+std::string RemoteMonitorEngine::metrics_text() const {
+    // Any request that is neither HTTP nor a query gets the raw exposition
+    return exchange("\n");
+}
+
+std::string RemoteMonitorEngine::exchange(const std::string& request) const {
+#ifdef _WIN32
+    (void)request;
+    throw MonitorSourceError("Unix-domain sockets are not supported on this platform");
+#else
+    const std::string path = socket_path_.string();
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw MonitorSourceError("monitor socket path too long: " + path);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw MonitorSourceError("cannot create socket: " + std::string(std::strerror(errno)));
+    }
+    timeval timeout{kReplyTimeoutSeconds, 0};
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    auto fail = [&](const std::string& what) {
+        int error = errno;
+        ::close(fd);
+        throw MonitorSourceError(what + " " + path + ": " + std::strerror(error));
+    };
+
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        fail("cannot reach monitor source");
+    }
+    for (size_t sent = 0; sent < request.size();) {
+        ssize_t written = ::send(fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            fail("cannot send monitor query to");
+        }
+        sent += static_cast<size_t>(written);
+    }
+    ::shutdown(fd, SHUT_WR);
+
+    std::string response;
+    char buffer[4096];
+    while (true) {
+        ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (received == 0) break;
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            fail("no reply from monitor source");
+        }
+        response.append(buffer, static_cast<size_t>(received));
+    }
+    ::close(fd);
+    return response;
+#endif
+}
+
+} // namespace nx::monitor
@@ -0,0 +1,185 @@
+#include "nx/monitor/ChromeTraceRecorder.h"
+#include "nx/monitor/MetricsObserver.h"
+#include "nx/batch/AsyncObserverBus.h"
+#include "nx/batch/BatchEngineImpl.h"
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nx::monitor;
+using namespace nx::batch;
+
+namespace {
+
+class FailingJobExecutor : public JobExecutor {
+public:
+    JobExecutionResult execute_job(const JobExecutionSpec&) const override {
+        return JobExecutionResult{.success = false, .message = "fail", .result_token = ""};
+    }
+};
+
+ExecutionGraph create_graph(const std::string& prefix, size_t job_count) {
+    BatchEngineImpl batch_engine;
+    std::vector<ParsedBatchCommand> commands;
+    for (size_t i = 0; i < job_count; ++i) {
+        std::string in = prefix + std::to_string(i) + ".mp4";
+        std::string out = prefix + std::to_string(i) + ".mkv";
+        commands.push_back({"nx convert --input " + in + " --output " + out,
+                            {"nx", "convert", "--input", in, "--output", out}, true});
+    }
+    auto session = batch_engine.create_session(commands);
+    return batch_engine.create_execution_graph(session);
+}
+
+size_t count_occurrences(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+void test_single_session_timeline() {
+    std::cout << "Testing single session timeline...\n";
+    ChromeTraceRecorder recorder;
+    auto graph = create_graph("a", 3);
+    
+    DeterministicExecutionEngine engine(graph, std::make_shared<StubJobExecutor>(), &recorder);
+    auto result = engine.execute_all_jobs();
+    assert(result.all_jobs_completed);
+    assert(recorder.span_count() == 3);
+    
+    std::ostringstream out;
+    recorder.write(out);
+    std::string json = out.str();
+    
+    assert(json.starts_with("{\"traceEvents\":["));
+    assert(json.find("\"displayTimeUnit\":\"ms\"") != std::string::npos);
+    assert(count_occurrences(json, "\"ph\":\"X\"") == 3);
+    assert(count_occurrences(json, "\"outcome\":\"completed\"") == 3);
+    assert(count_occurrences(json, "\"name\":\"thread_name\"") == 1);
+    assert(json.find("\"cat\":\"NX-Convert Pro\"") != std::string::npos);
+    assert(json.find("\"name\":\"session complete\"") != std::string::npos);
+    
+    // The deterministic trace itself carries no timing
+    DeterministicExecutionEngine plain(graph, std::make_shared<StubJobExecutor>());
+    assert(plain.execute_all_jobs().trace == result.trace);
+    std::cout << "✓ One complete event per job\n";
+}
+
+void test_concurrent_engines_get_distinct_threads() {
+    std::cout << "Testing concurrent engines...\n";
+    ChromeTraceRecorder recorder;
+    auto first = create_graph("x", 4);
+    auto second = create_graph("y", 4);
+    
+    std::thread worker_a([&] {
+        DeterministicExecutionEngine engine(first, std::make_shared<StubJobExecutor>(), &recorder);
+        engine.execute_all_jobs();
+    });
+    std::thread worker_b([&] {
+        DeterministicExecutionEngine engine(second, std::make_shared<StubJobExecutor>(), &recorder);
+        engine.execute_all_jobs();
+    });
+    worker_a.join();
+    worker_b.join();
+    
+    assert(recorder.span_count() == 8);
+    std::ostringstream out;
+    recorder.write(out);
+    std::string json = out.str();
+    assert(count_occurrences(json, "\"name\":\"thread_name\"") == 2);
+    assert(json.find("\"tid\":1,") != std::string::npos);
+    assert(json.find("\"tid\":2,") != std::string::npos);
+    std::cout << "✓ Each executing thread gets its own track\n";
+}
+
+void test_behind_observer_bus_keeps_execution_threads() {
+    std::cout << "Testing recorder behind AsyncObserverBus...\n";
+    ChromeTraceRecorder recorder;
+    MetricsRegistry registry;
+    MetricsObserver metrics(registry);
+    AsyncObserverBus bus({&recorder, &metrics}, {.capacity = 64, .overflow = ObserverOverflowPolicy::Block});
+    auto first = create_graph("p", 4);
+    auto second = create_graph("q", 4);
+    
+    std::thread worker_a([&] {
+        DeterministicExecutionEngine engine(first, std::make_shared<StubJobExecutor>(), &bus);
+        engine.execute_all_jobs();
+    });
+    std::thread worker_b([&] {
+        DeterministicExecutionEngine engine(second, std::make_shared<StubJobExecutor>(), &bus);
+        engine.execute_all_jobs();
+    });
+    worker_a.join();
+    worker_b.join();
+    bus.flush();
+    
+    // Two execution tracks, not one drain-thread track
+    assert(recorder.span_count() == 8);
+    std::ostringstream out;
+    recorder.write(out);
+    assert(count_occurrences(out.str(), "\"name\":\"thread_name\"") == 2);
+    assert(registry.snapshot().completed() == 8);
+    std::cout << "✓ Bus delivery keeps execution times and threads\n";
+}
+
+void test_halt_and_save() {
+    std::cout << "Testing halt marker and save...\n";
+    ChromeTraceRecorder recorder;
+    auto graph = create_graph("f", 2);
+    
+    DeterministicExecutionEngine engine(graph, std::make_shared<FailingJobExecutor>(), &recorder);
+    auto result = engine.execute_all_jobs();
+    assert(!result.all_jobs_completed);
+    
+    auto path = std::filesystem::temp_directory_path() / "nx_chrome_trace_test.json";
+    recorder.save(path);
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    std::string json = content.str();
+    
+    assert(count_occurrences(json, "\"outcome\":\"failed\"") == 1);
+    assert(json.find("\"name\":\"session halted\"") != std::string::npos);
+    assert(json.ends_with("}}\n"));
+    
+    // A failed save throws and removes its temporary file
+    auto blocked = std::filesystem::temp_directory_path() / "nx_chrome_trace_blocked.json";
+    std::filesystem::create_directories(blocked / "child");
+    bool threw = false;
+    try {
+        recorder.save(blocked);
+    } catch (const std::exception&) {
+        threw = true;
+    }
+    assert(threw);
+    std::filesystem::remove_all(blocked);
+    
+    // No temporary file is left behind
+    for (const auto& entry : std::filesystem::directory_iterator(path.parent_path())) {
+        auto name = entry.path().filename().string();
+        assert(!name.starts_with(path.filename().string() + ".tmp"));
+        assert(!name.starts_with(blocked.filename().string() + ".tmp"));
+    }
+    std::filesystem::remove(path);
+    std::cout << "✓ Failed jobs and halts are visible\n";
+}
+
+int main() {
+    test_single_session_timeline();
+    test_concurrent_engines_get_distinct_threads();
+    test_behind_observer_bus_keeps_execution_threads();
+    test_halt_and_save();
+    
+    std::cout << "All Chrome trace recorder tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include "nx/monitor/ExecutionMonitor.h"
+#include "nx/batch/BatchEngineImpl.h"
+#include <cassert>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace nx::monitor;
+using namespace nx::batch;
+
+namespace {
+
+std::filesystem::path temp_path(const std::string& name) {
+    return std::filesystem::temp_directory_path() / (name + "_" + std::to_string(::getpid()));
+}
+
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+ExecutionGraph create_graph(size_t job_count) {
+    BatchEngineImpl batch_engine;
+    std::vector<ParsedBatchCommand> commands;
+    for (size_t i = 0; i < job_count; ++i) {
+        std::string in = "clip" + std::to_string(i) + ".mp4";
+        std::string out = "clip" + std::to_string(i) + ".mkv";
+        commands.push_back({"nx convert --input " + in + " --output " + out,
+                            {"nx", "convert", "--input", in, "--output", out}, true});
+    }
+    auto session = batch_engine.create_session(commands);
+    return batch_engine.create_execution_graph(session);
+}
+
+} // namespace
+
+void test_session_reaches_exporter() {
+    std::cout << "Testing sessions reach the exporter...\n";
+    MetricsRegistry registry;
+    auto path = temp_path("nx_execution_monitor.prom");
+    OpenMetricsExportOptions options;
+    options.file_path = path;
+
+    {
+        ExecutionMonitor monitor(options, registry);
+        auto graph = create_graph(3);
+        DeterministicExecutionEngine engine(graph, std::make_shared<StubJobExecutor>(), &monitor.observer());
+        assert(engine.execute_all_jobs().all_jobs_completed);
+
+        monitor.exporter().refresh();
+        std::string content = read_file(path);
+        assert(content.find("nx_jobs_completed_total{engine=\"NX-Convert Pro\"} 3\n") != std::string::npos);
+        assert(content == *monitor.exporter().current());
+    }
+    std::filesystem::remove(path);
+    std::cout << "✓ Observed sessions are published\n";
+}
+
+void test_from_environment() {
+    std::cout << "Testing environment configuration...\n";
+    ::unsetenv(kMonitorSocketEnv);
+    ::unsetenv(kMonitorMetricsFileEnv);
+    assert(ExecutionMonitor::from_environment() == nullptr);
+
+    auto path = temp_path("nx_execution_monitor_env.prom");
+    ::setenv(kMonitorMetricsFileEnv, path.c_str(), 1);
+    {
+        auto monitor = ExecutionMonitor::from_environment();
+        assert(monitor != nullptr);
+        assert(std::filesystem::exists(path));
+    }
+    ::unsetenv(kMonitorMetricsFileEnv);
+    std::filesystem::remove(path);
+    std::cout << "✓ Monitor enabled only when configured\n";
+}
+
+int main() {
+    test_session_reaches_exporter();
+    test_from_environment();
+
+    std::cout << "All execution monitor tests passed!\n";
+    return 0;
+}
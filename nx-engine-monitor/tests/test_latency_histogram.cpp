@@ -0,0 +1,99 @@
+#include "nx/monitor/LatencyHistogram.h"
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace nx::monitor;
+
+void test_bucket_bounds() {
+    std::cout << "Testing bucket bounds...\n";
+    
+    // Small values are exact
+    for (uint64_t value = 0; value < LatencyHistogram::kSubBuckets; ++value) {
+        assert(LatencyHistogram::bucket_index(value) == value);
+        assert(LatencyHistogram::bucket_upper_bound(value) == value);
+    }
+    
+    // Every value lands in a bucket whose bounds contain it, within 12.5%
+    std::vector<uint64_t> samples = {8, 9, 15, 16, 17, 100, 1000, 12345, 999999, 1ULL << 40, UINT64_MAX};
+    for (uint64_t value : samples) {
+        size_t index = LatencyHistogram::bucket_index(value);
+        assert(index < LatencyHistogram::kBucketCount);
+        uint64_t upper = LatencyHistogram::bucket_upper_bound(index);
+        uint64_t lower = index == 0 ? 0 : LatencyHistogram::bucket_upper_bound(index - 1) + 1;
+        assert(lower <= value && value <= upper);
+        assert(upper - lower <= lower / LatencyHistogram::kSubBuckets);
+    }
+    assert(LatencyHistogram::bucket_index(UINT64_MAX) == LatencyHistogram::kBucketCount - 1);
+    
+    std::cout << "✓ Bucket bounds contain their values\n";
+}
+
+void test_percentiles() {
+    std::cout << "Testing percentiles...\n";
+    auto histogram = std::make_unique<LatencyHistogram>();
+    
+    assert(histogram->summarize().count == 0);
+    assert(histogram->summarize().buckets.empty());
+    
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram->record(value);
+    }
+    auto stats = histogram->summarize();
+    assert(stats.count == 1000);
+    assert(stats.sum_us == 500500);
+    assert(stats.min_us == 1);
+    assert(stats.max_us == 1000);
+    
+    // Reported percentile is the bucket upper bound: never below, at most 12.5% above
+    assert(stats.p50_us >= 500 && stats.p50_us <= 500 + 500 / 8);
+    assert(stats.p90_us >= 900 && stats.p90_us <= 900 + 900 / 8);
+    assert(stats.p99_us >= 990 && stats.p99_us <= 1000);
+    assert(stats.p999_us == 1000);
+    
+    uint64_t bucket_total = 0;
+    for (size_t i = 0; i < stats.buckets.size(); ++i) {
+        bucket_total += stats.buckets[i].count;
+        if (i > 0) assert(stats.buckets[i - 1].upper_bound_us < stats.buckets[i].upper_bound_us);
+    }
+    assert(bucket_total == stats.count);
+    
+    histogram->reset();
+    assert(histogram->summarize().count == 0);
+    std::cout << "✓ Percentiles are within bucket precision\n";
+}
+
+void test_concurrent_recording() {
+    std::cout << "Testing concurrent recording...\n";
+    auto histogram = std::make_unique<LatencyHistogram>();
+    constexpr int kThreads = 4;
+    constexpr uint64_t kPerThread = 10000;
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&histogram] {
+            for (uint64_t i = 0; i < kPerThread; ++i) {
+                histogram->record(i % 5000);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    
+    auto stats = histogram->summarize();
+    assert(stats.count == kThreads * kPerThread);
+    assert(stats.min_us == 0);
+    assert(stats.max_us == 4999);
+    std::cout << "✓ No samples lost under concurrent writers\n";
+}
+
+int main() {
+    test_bucket_bounds();
+    test_percentiles();
+    test_concurrent_recording();
+    
+    std::cout << "All latency histogram tests passed!\n";
+    return 0;
+}
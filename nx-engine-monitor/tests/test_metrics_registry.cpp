@@ -0,0 +1,300 @@
+#include "nx/monitor/MetricsObserver.h"
+#include "nx/monitor/MetricsRegistry.h"
+#include "nx/monitor/RealMonitorEngine.h"
+#include "nx/batch/BatchEngineImpl.h"
+#include <atomic>
+#include <chrono>
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nx::monitor;
+using namespace nx::batch;
+
+void test_empty_registry_snapshot() {
+    std::cout << "Testing empty registry snapshot...\n";
+    MetricsRegistry registry;
+    
+    auto snapshot = registry.snapshot();
+    assert(snapshot.running() == 0);
+    assert(snapshot.completed() == 0);
+    assert(snapshot.failed() == 0);
+    assert(snapshot.cache_hits == 0);
+    assert(registry.jobs().empty());
+    assert(!registry.job("missing").has_value());
+    std::cout << "✓ Empty registry reports zero counters\n";
+}
+
+void test_transition_counting() {
+    std::cout << "Testing transition counting...\n";
+    MetricsRegistry registry;
+    
+    registry.record_transition("session_1", "job_a", 0, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_b", 1, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_c", 99, MonitoredJobState::Running);  // Out of range → unattributed
+    registry.record_transition("session_1", "job_a", 0, MonitoredJobState::Completed, true);
+    registry.record_transition("session_1", "job_b", 1, MonitoredJobState::Failed);
+    registry.record_session_end(true);
+    
+    auto snapshot = registry.snapshot();
+    assert(snapshot.running() == 1);
+    assert(snapshot.completed() == 1);
+    assert(snapshot.failed() == 1);
+    assert(snapshot.cache_hits == 1);
+    assert(snapshot.sessions_halted == 1);
+    assert(snapshot.sessions_completed == 0);
+    assert(snapshot.engines[0].started == 1 && snapshot.engines[0].in_flight() == 0);
+    assert(snapshot.engines[1].failed == 1);
+    assert(snapshot.engines[MetricsRegistry::kUnattributedSlot].in_flight() == 1);
+    
+    registry.reset();
+    assert(registry.snapshot().running() == 0);
+    assert(registry.jobs().empty());
+    std::cout << "✓ Counters follow recorded transitions\n";
+}
+
+void test_job_table_queries() {
+    std::cout << "Testing job table queries...\n";
+    MetricsRegistry registry;
+    
+    registry.record_transition("session_1", "job_2", 0, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_1", 2, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_1", 2, MonitoredJobState::Completed);
+    
+    auto jobs = registry.jobs();
+    assert(jobs.size() == 2);
+    assert(jobs[0].job_id == "job_1" && jobs[0].state == "completed");
+    assert(jobs[1].job_id == "job_2" && jobs[1].state == "running");
+    
+    auto detail = registry.job("job_1");
+    assert(detail.has_value());
+    assert(detail->state == "completed");
+    assert(detail->engine == MetricsRegistry::engine_name(2));
+    assert(!detail->created_at.empty());
+    assert(detail->completed_at.has_value());
+    
+    auto running = registry.job("job_2");
+    assert(running.has_value() && !running->completed_at.has_value());
+    std::cout << "✓ jobs() is ordered by id and job() reports latest state\n";
+}
+
+void test_concurrent_snapshots_stay_consistent() {
+    std::cout << "Testing concurrent snapshot consistency...\n";
+    MetricsRegistry registry;
+    constexpr int kWriters = 4;
+    constexpr int kJobsPerWriter = 2000;
+    
+    std::atomic<bool> done{false};
+    std::atomic<bool> inconsistent{false};
+    std::thread reader([&] {
+        while (!done.load()) {
+            auto snapshot = registry.snapshot();
+            for (const auto& engine : snapshot.engines) {
+                if (engine.completed + engine.failed > engine.started) {
+                    inconsistent.store(true);
+                }
+            }
+        }
+    });
+    
+    std::vector<std::thread> writers;
+    for (int w = 0; w < kWriters; ++w) {
+        writers.emplace_back([&registry, w] {
+            for (int i = 0; i < kJobsPerWriter; ++i) {
+                std::string job_id = "w" + std::to_string(w) + "_" + std::to_string(i);
+                size_t slot = static_cast<size_t>(i) % MetricsRegistry::kEngineSlots;
+                registry.record_transition("session_1", job_id, slot, MonitoredJobState::Running);
+                registry.record_transition("session_1", job_id, slot,
+                    i % 7 == 0 ? MonitoredJobState::Failed : MonitoredJobState::Completed);
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    done.store(true);
+    reader.join();
+    
+    assert(!inconsistent.load());
+    auto snapshot = registry.snapshot();
+    assert(snapshot.running() == 0);
+    assert(snapshot.completed() + snapshot.failed() == kWriters * kJobsPerWriter);
+    assert(registry.jobs().size() == kWriters * kJobsPerWriter);
+    std::cout << "✓ Snapshots never report more finished than started jobs\n";
+}
+
+void test_observer_tracks_engine_execution() {
+    std::cout << "Testing observer driven by execution engine...\n";
+    MetricsRegistry registry;
+    MetricsObserver observer(registry);
+    
+    BatchEngineImpl batch_engine;
+    std::vector<ParsedBatchCommand> commands = {
+        {"nx convert --input a.mp4 --output a.mkv", {"nx", "convert", "--input", "a.mp4", "--output", "a.mkv"}, true},
+        {"nx convert --input b.mp4 --output b.mkv", {"nx", "convert", "--input", "b.mp4", "--output", "b.mkv"}, true}
+    };
+    auto session = batch_engine.create_session(commands);
+    auto execution_graph = batch_engine.create_execution_graph(session);
+    
+    DeterministicExecutionEngine engine(execution_graph, std::make_shared<StubJobExecutor>(), &observer);
+    auto result = engine.execute_all_jobs();
+    assert(result.all_jobs_completed);
+    
+    auto snapshot = registry.snapshot();
+    assert(snapshot.completed() == 2);
+    assert(snapshot.running() == 0);
+    assert(snapshot.sessions_completed == 1);
+    assert(snapshot.engines[static_cast<size_t>(ComponentType::Convert)].completed == 2);
+    
+    for (const auto& record : result.trace) {
+        assert(record.component == ComponentType::Convert);
+    }
+    
+    RealMonitorEngine monitor(registry);
+    auto status = monitor.status();
+    assert(status.completed_jobs == 2);
+    assert(status.active_jobs == 0);
+    assert(status.failed_jobs == 0);
+    assert(monitor.jobs().size() == 2);
+    assert(monitor.job(result.trace.front().job_id.job_value).has_value());
+    std::cout << "✓ Observer feeds registry and RealMonitorEngine reads it\n";
+}
+
+void test_latency_and_throughput_stats() {
+    std::cout << "Testing latency and throughput stats...\n";
+    MetricsRegistry registry;
+    
+    auto empty = registry.stats();
+    assert(empty.jobs_finished == 0);
+    assert(empty.jobs_per_second == 0.0);
+    assert(empty.engines.size() == MetricsRegistry::kEngineSlots - 1);  // Unattributed hidden until used
+    
+    registry.record_transition("session_1", "fast", 0, MonitoredJobState::Running);
+    registry.record_transition("session_1", "fast", 0, MonitoredJobState::Completed);
+    registry.record_transition("session_1", "slow", 1, MonitoredJobState::Running);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    registry.record_transition("session_1", "slow", 1, MonitoredJobState::Failed);
+    registry.record_transition("session_1", "orphan", 99, MonitoredJobState::Completed);  // Never seen running
+    
+    auto stats = registry.stats();
+    assert(stats.jobs_finished == 3);
+    assert(stats.window_seconds > 0.0);
+    assert(stats.jobs_per_second > 0.0);
+    assert(stats.engines.size() == MetricsRegistry::kEngineSlots);
+    
+    const auto& convert = stats.engines[0];
+    assert(convert.engine == MetricsRegistry::engine_name(0));
+    assert(convert.completed == 1);
+    assert(convert.latency.count == 1);
+    
+    const auto& audio = stats.engines[1];
+    assert(audio.failed == 1);
+    assert(audio.latency.count == 1);
+    assert(audio.latency.max_us >= 5000);
+    
+    // A terminal transition without a recorded start has no latency sample
+    assert(stats.engines[MetricsRegistry::kUnattributedSlot].completed == 1);
+    assert(stats.engines[MetricsRegistry::kUnattributedSlot].latency.count == 0);
+    
+    RealMonitorEngine monitor(registry);
+    assert(monitor.stats().jobs_finished == 3);
+    
+    registry.reset();
+    assert(registry.stats().jobs_finished == 0);
+    assert(registry.stats().window_seconds == 0.0);
+    std::cout << "✓ Latency histograms and throughput follow transitions\n";
+}
+
+void test_sessions_sharing_job_names() {
+    std::cout << "Testing sessions that reuse job names...\n";
+    MetricsRegistry registry;
+    auto t0 = std::chrono::steady_clock::now();
+    using std::chrono::milliseconds;
+    
+    registry.record_transition("session_a", "job_1", 0, MonitoredJobState::Running, false, t0);
+    registry.record_transition("session_b", "job_1", 0, MonitoredJobState::Running, false, t0 + milliseconds(100));
+    registry.record_transition("session_a", "job_1", 0, MonitoredJobState::Completed, false, t0 + milliseconds(200));
+    
+    // Latency is measured from session A's own start, not session B's
+    auto latency = registry.stats().engines[0].latency;
+    assert(latency.count == 1);
+    assert(latency.min_us >= 200000);
+    
+    auto jobs = registry.jobs();
+    assert(jobs.size() == 2);
+    assert(jobs[0].session_id == "session_a" && jobs[0].state == "completed");
+    assert(jobs[1].session_id == "session_b" && jobs[1].state == "running");
+    
+    assert(registry.job("job_1", "session_a")->state == "completed");
+    assert(registry.job("job_1", "session_b")->state == "running");
+    assert(registry.job("job_1")->session_id == "session_b");   // Most recently started
+    assert(!registry.job("job_1", "session_c").has_value());
+    std::cout << "✓ Jobs are keyed by session and job id\n";
+}
+
+void test_job_table_is_bounded() {
+    std::cout << "Testing job table bound...\n";
+    constexpr size_t kShards = MetricsRegistry::kShardCount;
+    MetricsRegistry registry(64);
+    assert(registry.max_tracked_jobs() == 64);
+    
+    for (int i = 0; i < 1000; ++i) {
+        std::string job_id = "done_" + std::to_string(i);
+        registry.record_transition("session_1", job_id, 0, MonitoredJobState::Running);
+        registry.record_transition("session_1", job_id, 0, MonitoredJobState::Completed);
+    }
+    assert(registry.tracked_jobs() <= 64);
+    assert(registry.snapshot().completed() == 1000);   // Counters are not bounded
+    assert(registry.job("done_999").has_value());     // Newest finished jobs are kept
+    
+    // Running jobs are never evicted, even past the bound
+    for (int i = 0; i < 200; ++i) {
+        registry.record_transition("session_2", "live_" + std::to_string(i), 1, MonitoredJobState::Running);
+    }
+    for (int i = 0; i < 200; ++i) {
+        assert(registry.job("live_" + std::to_string(i), "session_2")->state == "running");
+    }
+    
+    // A job that finishes twice is evicted once, by its latest finish
+    MetricsRegistry small(kShards);
+    small.record_transition("session_3", "retry", 2, MonitoredJobState::Running);
+    small.record_transition("session_3", "retry", 2, MonitoredJobState::Failed);
+    small.record_transition("session_3", "retry", 2, MonitoredJobState::Running);
+    small.record_transition("session_3", "retry", 2, MonitoredJobState::Completed);
+    assert(small.job("retry", "session_3")->state == "completed");
+    for (int i = 0; i < 100; ++i) {
+        std::string job_id = "after_" + std::to_string(i);
+        small.record_transition("session_3", job_id, 2, MonitoredJobState::Running);
+        small.record_transition("session_3", job_id, 2, MonitoredJobState::Completed);
+    }
+    assert(small.tracked_jobs() <= kShards);
+    assert(!small.job("retry", "session_3").has_value());
+
+    // Restarting and finishing the same job forever does not grow the eviction queue
+    MetricsRegistry looping(64);
+    looping.record_transition("session_4", "anchor", 3, MonitoredJobState::Running);
+    looping.record_transition("session_4", "anchor", 3, MonitoredJobState::Completed);
+    for (int i = 0; i < 10000; ++i) {
+        looping.record_transition("session_4", "loop", 3, MonitoredJobState::Running);
+        looping.record_transition("session_4", "loop", 3, MonitoredJobState::Completed);
+    }
+    assert(looping.eviction_backlog() <= 2 * looping.max_tracked_jobs());
+    assert(looping.job("anchor", "session_4")->state == "completed");
+    assert(looping.job("loop", "session_4")->state == "completed");
+    std::cout << "✓ Finished jobs are evicted oldest first\n";
+}
+
+int main() {
+    test_empty_registry_snapshot();
+    test_transition_counting();
+    test_job_table_queries();
+    test_concurrent_snapshots_stay_consistent();
+    test_observer_tracks_engine_execution();
+    test_latency_and_throughput_stats();
+    test_sessions_sharing_job_names();
+    test_job_table_is_bounded();
+    
+    std::cout << "All metrics registry tests passed!\n";
+    return 0;
+}
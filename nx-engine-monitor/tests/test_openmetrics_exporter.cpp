@@ -0,0 +1,464 @@
+#include "nx/monitor/OpenMetricsExporter.h"
+#include "nx/monitor/LatencyHistogram.h"
+#include "nx/monitor/MetricsRegistry.h"
+#include "nx/monitor/MonitorQueryProtocol.h"
+#include "nx/monitor/RealMonitorEngine.h"
+#include "nx_profile.h"
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+using namespace nx::monitor;
+
+namespace {
+
+std::filesystem::path temp_path(const std::string& name) {
+    return std::filesystem::temp_directory_path() / (name + "_" + std::to_string(::getpid()));
+}
+
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+std::string scrape(const std::filesystem::path& socket_path, const std::string& request) {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    assert(fd >= 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    int connected = ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    assert(connected == 0);
+    if (!request.empty()) {
+        ::send(fd, request.data(), request.size(), 0);
+    }
+    std::string response;
+    char buffer[4096];
+    ssize_t received;
+    while ((received = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+        response.append(buffer, static_cast<size_t>(received));
+    }
+    ::close(fd);
+    return response;
+}
+
+void populate(MetricsRegistry& registry) {
+    registry.record_transition("session_1", "job_1", 0, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_1", 0, MonitoredJobState::Completed);
+    registry.record_transition("session_1", "job_2", 0, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_3", 2, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_3", 2, MonitoredJobState::Failed);
+}
+
+// Blocks jobs queries until released, to prove scrapes do not queue behind them
+class BlockingJobsEngine : public RealMonitorEngine {
+public:
+    using RealMonitorEngine::RealMonitorEngine;
+
+    mutable std::atomic<bool> entered{false};
+    std::atomic<bool> released{false};
+
+    std::vector<JobSummary> jobs() const override {
+        entered = true;
+        while (!released) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return RealMonitorEngine::jobs();
+    }
+};
+
+} // namespace
+
+void test_render_format() {
+    std::cout << "Testing OpenMetrics rendering...\n";
+    MetricsRegistry registry;
+    populate(registry);
+    RealMonitorEngine engine(registry);
+    
+    std::string text = render_openmetrics(engine);
+    assert(text == render_openmetrics(engine));  // Deterministic for unchanged state
+    assert(text.starts_with("# TYPE nx_monitor_healthy gauge\n"));
+    assert(text.ends_with("# EOF\n"));
+    assert(text.find("nx_jobs_started_total{engine=\"NX-Convert Pro\"} 2\n") != std::string::npos);
+    assert(text.find("nx_jobs_completed_total{engine=\"NX-Convert Pro\"} 1\n") != std::string::npos);
+    assert(text.find("nx_jobs_in_flight{engine=\"NX-Convert Pro\"} 1\n") != std::string::npos);
+    assert(text.find("nx_jobs_failed_total{engine=\"NX-VideoTrans\"} 1\n") != std::string::npos);
+    assert(text.find("# UNIT nx_job_latency_seconds seconds\n") != std::string::npos);
+    assert(text.find("nx_job_latency_seconds_bucket{engine=\"NX-Convert Pro\",le=\"+Inf\"} 1\n") != std::string::npos);
+    assert(text.find("nx_job_latency_seconds_count{engine=\"NX-AudioLab\"} 0\n") != std::string::npos);
+    
+    // Histogram buckets are cumulative and end at the total count
+    std::istringstream lines(text);
+    std::string line;
+    uint64_t previous = 0;
+    const std::string prefix = "nx_job_latency_seconds_bucket{engine=\"NX-VideoTrans\"";
+    bool saw_inf = false;
+    while (std::getline(lines, line)) {
+        if (!line.starts_with(prefix)) continue;
+        uint64_t value = std::stoull(line.substr(line.rfind(' ') + 1));
+        assert(value >= previous);
+        previous = value;
+        saw_inf = saw_inf || line.find("le=\"+Inf\"") != std::string::npos;
+    }
+    assert(saw_inf && previous == 1);
+    std::cout << "✓ Exposition follows OpenMetrics text format\n";
+}
+
+void test_fixed_bucket_layout() {
+    std::cout << "Testing fixed latency bucket layout...\n";
+    MetricsRegistry registry;
+    RealMonitorEngine engine(registry);
+    
+    auto le_bounds = [](const std::string& text) {
+        std::map<std::string, std::vector<std::string>> bounds;
+        std::istringstream lines(text);
+        std::string line;
+        const std::string prefix = "nx_job_latency_seconds_bucket{engine=\"";
+        while (std::getline(lines, line)) {
+            if (!line.starts_with(prefix)) continue;
+            std::string engine_name = line.substr(prefix.size(), line.find('"', prefix.size()) - prefix.size());
+            size_t le = line.find("le=\"") + 4;
+            bounds[engine_name].push_back(line.substr(le, line.find('"', le) - le));
+        }
+        return bounds;
+    };
+    
+    auto empty = le_bounds(render_openmetrics(engine));
+    assert(empty.size() == engine.stats().engines.size());
+    const std::vector<std::string> layout = empty.begin()->second;
+    assert(layout.size() == 30);
+    assert(layout.front() == "0.000015");
+    assert(layout[layout.size() - 2] == "4294.967295");
+    assert(layout.back() == "+Inf");
+    
+    // Samples landing in different buckets do not change the layout
+    auto record_latency = [&](const std::string& job_id, size_t slot, std::chrono::microseconds latency) {
+        auto started = std::chrono::steady_clock::now();
+        registry.record_transition("session_1", job_id, slot, MonitoredJobState::Running, false, started);
+        registry.record_transition("session_1", job_id, slot, MonitoredJobState::Completed, false, started + latency);
+    };
+    record_latency("fast", 0, std::chrono::microseconds(3));
+    record_latency("medium", 0, std::chrono::microseconds(1500));
+    record_latency("slow", 2, std::chrono::microseconds(90000000));
+    std::string text = render_openmetrics(engine);
+    for (const auto& [engine_name, bounds] : le_bounds(text)) {
+        assert(bounds == layout);
+    }
+    assert(text.find("nx_job_latency_seconds_bucket{engine=\"NX-Convert Pro\",le=\"0.000015\"} 1\n") != std::string::npos);
+    assert(text.find("nx_job_latency_seconds_bucket{engine=\"NX-Convert Pro\",le=\"0.001023\"} 1\n") != std::string::npos);
+    assert(text.find("nx_job_latency_seconds_bucket{engine=\"NX-Convert Pro\",le=\"0.002047\"} 2\n") != std::string::npos);
+    assert(text.find("nx_job_latency_seconds_bucket{engine=\"NX-VideoTrans\",le=\"67.108863\"} 0\n") != std::string::npos);
+    assert(text.find("nx_job_latency_seconds_bucket{engine=\"NX-VideoTrans\",le=\"134.217727\"} 1\n") != std::string::npos);
+    
+    // Each bound closes a histogram bucket, so cumulative counts are exact
+    for (unsigned exponent = 4; exponent <= 32; ++exponent) {
+        uint64_t bound = (uint64_t{1} << exponent) - 1;
+        size_t index = LatencyHistogram::bucket_index(bound);
+        assert(LatencyHistogram::bucket_upper_bound(index) == bound);
+        assert(LatencyHistogram::bucket_index(bound + 1) == index + 1);
+    }
+    std::cout << "✓ Every engine exports the same exact le bounds\n";
+}
+
+void test_requires_destination() {
+    std::cout << "Testing exporter requires a destination...\n";
+    MetricsRegistry registry;
+    RealMonitorEngine engine(registry);
+    bool threw = false;
+    try {
+        OpenMetricsExporter exporter(engine, {});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "✓ Missing destination rejected\n";
+}
+
+void test_file_export() {
+    std::cout << "Testing file export...\n";
+    MetricsRegistry registry;
+    RealMonitorEngine engine(registry);
+    auto path = temp_path("nx_openmetrics.prom");
+    std::filesystem::remove(path);
+    
+    OpenMetricsExportOptions options;
+    options.file_path = path;
+    options.interval = std::chrono::milliseconds(10);
+    
+    {
+        OpenMetricsExporter exporter(engine, options);
+        assert(read_file(path) == *exporter.current());
+        
+        populate(registry);
+        exporter.refresh();
+        std::string content = read_file(path);
+        assert(content.find("nx_jobs_completed_total{engine=\"NX-Convert Pro\"} 1\n") != std::string::npos);
+        
+        // The render thread picks up new state on its own
+        registry.record_transition("session_1", "job_2", 0, MonitoredJobState::Completed);
+        for (int i = 0; i < 200; ++i) {
+            if (read_file(path).find("nx_jobs_completed_total{engine=\"NX-Convert Pro\"} 2\n") != std::string::npos) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        assert(read_file(path).find("nx_jobs_completed_total{engine=\"NX-Convert Pro\"} 2\n") != std::string::npos);
+    }
+    
+    // No temporary file is left behind
+    for (const auto& entry : std::filesystem::directory_iterator(path.parent_path())) {
+        assert(!entry.path().filename().string().starts_with(path.filename().string() + ".tmp"));
+    }
+    std::filesystem::remove(path);
+    std::cout << "✓ File rewritten atomically on interval\n";
+}
+
+void test_socket_export() {
+    std::cout << "Testing socket export...\n";
+    MetricsRegistry registry;
+    populate(registry);
+    RealMonitorEngine engine(registry);
+    auto path = temp_path("nx_openmetrics.sock");
+    
+    OpenMetricsExportOptions options;
+    options.socket_path = path;
+    
+    {
+        OpenMetricsExporter exporter(engine, options);
+        
+        std::string raw = scrape(path, "\n");
+        assert(raw == *exporter.current());
+        
+        std::string http = scrape(path, "GET /metrics HTTP/1.0\r\n\r\n");
+        assert(http.starts_with("HTTP/1.0 200 OK\r\n"));
+        assert(http.find("Content-Type: application/openmetrics-text") != std::string::npos);
+        assert(http.ends_with(*exporter.current()));
+        
+        assert(exporter.scrape_count() == 2);
+    }
+    assert(!std::filesystem::exists(path));
+    std::cout << "✓ Socket serves raw and HTTP scrapes\n";
+}
+
+void test_scrapes_do_not_wait_on_other_clients() {
+    std::cout << "Testing scrapes alongside slow clients...\n";
+    MetricsRegistry registry;
+    populate(registry);
+    BlockingJobsEngine engine(registry);
+    auto path = temp_path("nx_openmetrics_busy.sock");
+
+    OpenMetricsExportOptions options;
+    options.socket_path = path;
+
+    {
+        OpenMetricsExporter exporter(engine, options);
+
+        // A jobs query held inside the engine
+        MonitorQuery jobs_query;
+        jobs_query.kind = MonitorQueryKind::Jobs;
+        std::string jobs_response;
+        std::thread query([&] { jobs_response = scrape(path, encode_monitor_query(jobs_query)); });
+        while (!engine.entered) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // A client that connects and sends nothing yet
+        int idle = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        int connected = ::connect(idle, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        assert(connected == 0);
+
+        // Raw and HTTP scrapes are still answered while both are outstanding
+        assert(scrape(path, "\n") == *exporter.current());
+        assert(scrape(path, "GET /metrics HTTP/1.0\r\n\r\n").ends_with(*exporter.current()));
+        assert(exporter.query_count() == 0);
+
+        // The silent client gets the raw exposition once its grace period ends
+        std::string idle_response;
+        char buffer[4096];
+        ssize_t received;
+        while ((received = ::recv(idle, buffer, sizeof(buffer), 0)) > 0) {
+            idle_response.append(buffer, static_cast<size_t>(received));
+        }
+        ::close(idle);
+        assert(idle_response == *exporter.current());
+
+        engine.released = true;
+        query.join();
+        assert(jobs_response.starts_with("{\"ok\":true"));
+        assert(exporter.query_count() == 1);
+        assert(exporter.scrape_count() == 3);
+    }
+    assert(!std::filesystem::exists(path));
+    std::cout << "✓ Queries and silent clients never delay scrapes\n";
+}
+
+void test_query_queue_is_bounded() {
+    std::cout << "Testing query queue bound...\n";
+    MetricsRegistry registry;
+    populate(registry);
+    BlockingJobsEngine engine(registry);
+    auto path = temp_path("nx_openmetrics_queue.sock");
+
+    OpenMetricsExportOptions options;
+    options.socket_path = path;
+
+    {
+        OpenMetricsExporter exporter(engine, options);
+        MonitorQuery jobs_query;
+        jobs_query.kind = MonitorQueryKind::Jobs;
+        const std::string line = encode_monitor_query(jobs_query);
+
+        // The query thread is held inside the engine...
+        std::string held_response;
+        std::thread held([&] { held_response = scrape(path, line); });
+        while (!engine.entered) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // ...so only kMaxQueuedQueries more can wait; the one past the bound is turned away
+        std::vector<int> waiting;
+        for (size_t i = 0; i <= OpenMetricsExporter::kMaxQueuedQueries; ++i) {
+            int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+            int connected = ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+            assert(connected == 0);
+            ::send(fd, line.data(), line.size(), 0);
+            waiting.push_back(fd);
+        }
+        assert(scrape(path, "\n") == *exporter.current());   // Scrapes are still served
+
+        engine.released = true;
+        held.join();
+        assert(held_response.starts_with("{\"ok\":true"));
+        size_t answered = 0;
+        size_t rejected = 0;
+        for (int fd : waiting) {
+            std::string response;
+            char buffer[4096];
+            ssize_t received;
+            while ((received = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+                response.append(buffer, static_cast<size_t>(received));
+            }
+            ::close(fd);
+            answered += response.starts_with("{\"ok\":true");
+            rejected += response == "{\"ok\":false,\"error\":\"monitor query queue full\"}\n";
+        }
+        assert(answered == OpenMetricsExporter::kMaxQueuedQueries);
+        assert(rejected == 1);
+        assert(exporter.query_count() == OpenMetricsExporter::kMaxQueuedQueries + 1);
+    }
+    assert(!std::filesystem::exists(path));
+    std::cout << "✓ Queries past the queue bound are rejected\n";
+}
+
+void test_socket_path_safety() {
+    std::cout << "Testing socket path safety...\n";
+    MetricsRegistry registry;
+    RealMonitorEngine engine(registry);
+    auto path = temp_path("nx_openmetrics_claim.sock");
+    std::filesystem::remove(path);
+    OpenMetricsExportOptions options;
+    options.socket_path = path;
+    
+    // A regular file at the path is never unlinked
+    std::ofstream(path) << "keep me";
+    bool threw = false;
+    try {
+        OpenMetricsExporter exporter(engine, options);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(read_file(path) == "keep me");
+    std::filesystem::remove(path);
+    
+    // A stale socket nobody accepts on is replaced
+    {
+        int stale = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        int bound = ::bind(stale, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        assert(bound == 0);
+        ::close(stale);
+        assert(std::filesystem::is_socket(path));
+    }
+    {
+        OpenMetricsExporter exporter(engine, options);
+        assert(scrape(path, "\n") == *exporter.current());
+        
+        // A live exporter keeps its socket
+        threw = false;
+        try {
+            OpenMetricsExporter second(engine, options);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+        assert(scrape(path, "\n") == *exporter.current());
+    }
+    assert(!std::filesystem::exists(path));
+    std::cout << "✓ Only stale sockets are replaced\n";
+}
+
+void test_profile_zone_export() {
+    std::cout << "Testing profiling zone export...\n";
+    MetricsRegistry registry;
+    RealMonitorEngine engine(registry);
+    
+    nx::profile::reset();
+    assert(render_openmetrics(engine).find("nx_profile_zone") == std::string::npos);
+    
+    for (int i = 0; i < 3; ++i) {
+        nx::profile::Zone zone("JobGraph::finalize");
+    }
+    auto stats = engine.stats();
+    assert(stats.profile_zones.size() == 1);
+    assert(stats.profile_zones[0].zone == "JobGraph::finalize");
+    assert(stats.profile_zones[0].count == 3);
+    
+    std::string text = render_openmetrics(engine);
+    assert(text.find("# TYPE nx_profile_zone_calls counter\n") != std::string::npos);
+    assert(text.find("nx_profile_zone_calls_total{zone=\"JobGraph::finalize\"} 3\n") != std::string::npos);
+    assert(text.find("nx_profile_zone_seconds_total{zone=\"JobGraph::finalize\"} ") != std::string::npos);
+    assert(text.find("nx_profile_samples_dropped_total 0\n") != std::string::npos);
+    assert(text.ends_with("# EOF\n"));
+    
+    nx::profile::reset();
+    std::cout << "✓ Profiling zones exported as OpenMetrics families\n";
+}
+
+int main() {
+    test_render_format();
+    test_fixed_bucket_layout();
+    test_profile_zone_export();
+    test_requires_destination();
+    test_file_export();
+    test_socket_export();
+    test_scrapes_do_not_wait_on_other_clients();
+    test_query_queue_is_bounded();
+    test_socket_path_safety();
+    
+    std::cout << "All OpenMetrics exporter tests passed!\n";
+    return 0;
+}
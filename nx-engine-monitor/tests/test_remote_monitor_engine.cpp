@@ -0,0 +1,140 @@
+#include "nx/monitor/RemoteMonitorEngine.h"
+#include "nx/monitor/MetricsRegistry.h"
+#include "nx/monitor/MonitorQueryProtocol.h"
+#include "nx/monitor/OpenMetricsExporter.h"
+#include "nx/monitor/RealMonitorEngine.h"
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+using namespace nx::monitor;
+
+namespace {
+
+std::filesystem::path temp_path(const std::string& name) {
+    return std::filesystem::temp_directory_path() / (name + "_" + std::to_string(::getpid()));
+}
+
+OpenMetricsExportOptions socket_options(const std::filesystem::path& path) {
+    OpenMetricsExportOptions options;
+    options.socket_path = path;
+    return options;
+}
+
+void populate(MetricsRegistry& registry) {
+    auto started = std::chrono::steady_clock::now();
+    registry.record_transition("session_1", "job_1", 0, MonitoredJobState::Running, false, started);
+    registry.record_transition("session_1", "job_1", 0, MonitoredJobState::Completed, false,
+                               started + std::chrono::microseconds(1500));
+    registry.record_transition("session_1", "job_2", 2, MonitoredJobState::Running);
+    registry.record_transition("session_1", "job_2", 2, MonitoredJobState::Failed);
+    registry.record_transition("session_2", "job_1", 1, MonitoredJobState::Running);
+}
+
+} // namespace
+
+void test_matches_local_engine() {
+    std::cout << "Testing remote engine matches the served engine...\n";
+    MetricsRegistry registry;
+    populate(registry);
+    RealMonitorEngine local(registry);
+    auto path = temp_path("nx_remote_monitor.sock");
+    OpenMetricsExporter exporter(local, socket_options(path));
+    RemoteMonitorEngine remote(path);
+
+    SystemStatus expected_status = local.status();
+    SystemStatus status = remote.status();
+    assert(status.healthy == expected_status.healthy);
+    assert(status.active_jobs == 1);
+    assert(status.completed_jobs == expected_status.completed_jobs);
+    assert(status.failed_jobs == expected_status.failed_jobs);
+
+    auto jobs = remote.jobs();
+    auto expected_jobs = local.jobs();
+    assert(jobs.size() == expected_jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        assert(jobs[i].job_id == expected_jobs[i].job_id);
+        assert(jobs[i].session_id == expected_jobs[i].session_id);
+        assert(jobs[i].engine == expected_jobs[i].engine);
+        assert(jobs[i].state == expected_jobs[i].state);
+    }
+
+    auto finished = remote.job_in_session("job_1", "session_1");
+    assert(finished && finished->state == "completed" && finished->completed_at.has_value());
+    assert(*finished->completed_at == *local.job_in_session("job_1", "session_1")->completed_at);
+    auto latest = remote.job("job_1");
+    assert(latest && latest->session_id == "session_2" && !latest->completed_at.has_value());
+    assert(!remote.job("missing").has_value());
+    assert(!remote.job_in_session("job_2", "session_2").has_value());
+
+    MonitorStats stats = remote.stats();
+    MonitorStats expected_stats = local.stats();
+    assert(stats.jobs_finished == 2);
+    assert(stats.engines.size() == expected_stats.engines.size());
+    assert(stats.engines[0].latency.count == 1);
+    assert(stats.engines[0].latency.p50_us == expected_stats.engines[0].latency.p50_us);
+    assert(stats.engines[0].latency.buckets.size() == 1);
+    assert(stats.engines[0].in_flight == 0);
+    assert(stats.engines[1].in_flight == 1);
+
+    assert(remote.engines().size() == local.engines().size());
+    assert(remote.version().build_id == local.version().build_id);
+    assert(remote.metrics_text() == *exporter.current());
+    assert(exporter.query_count() == 9);
+    std::cout << "✓ Remote queries reproduce the served engine\n";
+}
+
+void test_query_errors() {
+    std::cout << "Testing query errors...\n";
+    MetricsRegistry registry;
+    RealMonitorEngine engine(registry);
+
+    assert(answer_monitor_query(engine, "{\"query\":\"status\"}").starts_with("{\"ok\":true,"));
+    assert(answer_monitor_query(engine, "{\"query\":\"restart\"}").starts_with("{\"ok\":false,"));
+    assert(answer_monitor_query(engine, "{\"query\":\"job\"}").starts_with("{\"ok\":false,"));
+    assert(answer_monitor_query(engine, "{\"query\":").starts_with("{\"ok\":false,"));
+
+    MonitorQuery query;
+    query.kind = MonitorQueryKind::Job;
+    query.job_id = "job \"quoted\"";
+    query.session_id = "session_1";
+    MonitorQuery decoded = decode_monitor_query(encode_monitor_query(query));
+    assert(decoded.kind == MonitorQueryKind::Job);
+    assert(decoded.job_id == query.job_id);
+    assert(decoded.session_id == query.session_id);
+
+    // No process behind the socket
+    RemoteMonitorEngine remote(temp_path("nx_remote_monitor_missing.sock"));
+    bool threw = false;
+    try {
+        remote.status();
+    } catch (const MonitorSourceError&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "✓ Query errors reported\n";
+}
+
+void test_from_environment() {
+    std::cout << "Testing environment lookup...\n";
+    ::unsetenv(kMonitorSocketEnv);
+    assert(RemoteMonitorEngine::from_environment() == nullptr);
+    ::setenv(kMonitorSocketEnv, "/tmp/nx.sock", 1);
+    auto remote = RemoteMonitorEngine::from_environment();
+    assert(remote && remote->socket_path() == "/tmp/nx.sock");
+    ::unsetenv(kMonitorSocketEnv);
+    std::cout << "✓ Socket taken from NX_MONITOR_SOCKET\n";
+}
+
+int main() {
+    test_matches_local_engine();
+    test_query_errors();
+    test_from_environment();
+
+    std::cout << "All remote monitor engine tests passed!\n";
+    return 0;
+}
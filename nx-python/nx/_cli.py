@@ -1,11 +1,20 @@
 """
 Core CLI invocation mechanism for Phase 14B bindings.
-Implements exec-based subprocess strategy.
+
+Commands are sent to one long-lived `nx-cli serve` child process, which
+dispatches each request exactly like a one-shot `nx-cli <args>` run and
+returns its exit code, stdout and stderr. If the executable refuses `serve`,
+or the session breaks before a request is written, the call falls back to
+spawning `nx-cli <args>` directly. A request the child already received is
+never executed a second time.
 """
 
-import subprocess
+import atexit
 import json
-from typing import List, Dict, Any
+import os
+import subprocess
+import threading
+from typing import List, Dict, Any, Optional, Tuple
 from ._cli_resolver import find_nx_cli_executable
 
 
@@ -23,38 +32,199 @@ class CLIOutputError(Exception):
     pass
 
 
-def invoke_cli(args: List[str]) -> Dict[str, Any]:
+# Exit code reported when the serve child dies mid-request (CliError::InternalError)
+_SESSION_FAILURE_EXIT_CODE = 99
+
+
+class _SessionError(Exception):
     """
-    Invoke nx CLI with given arguments and return parsed JSON output.
+    Serve session broke down.
     
-    Args:
-        args: CLI arguments (excluding 'nx' binary name)
+    request_sent tells whether the child may have received the request; only
+    unsent requests may be retried another way.
+    """
+    
+    def __init__(self, message: str, request_sent: bool):
+        self.request_sent = request_sent
+        super().__init__(message)
+
+
+class _ServeUnsupported(Exception):
+    """The executable does not answer as an `nx-cli serve` session."""
+    pass
+
+
+class _CliSession:
+    """
+    One `nx-cli serve` child process exchanging NDJSON over pipes.
+    
+    Requests are issued one at a time; the caller serializes access.
+    """
+    
+    def __init__(self, cli_path: str):
+        self.cli_path = cli_path
+        self.cwd = os.getcwd()
+        self.env = dict(os.environ)
+        self._next_id = 0
+        self._process = subprocess.Popen(
+            [cli_path, "serve"],
+            env=self.env,
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.DEVNULL,
+            text=True,
+            bufsize=1
+        )
+        self._handshake()
+    
+    def _handshake(self):
+        """
+        Confirm the child speaks the serve protocol before any real request.
         
-    Returns:
-        Parsed JSON output as dict
+        An empty object is rejected by `serve` with an InvalidCommand
+        response and executes nothing; an executable without `serve` exits
+        instead of answering.
+        """
+        try:
+            self._process.stdin.write("{}\n")
+            self._process.stdin.flush()
+            line = self._process.stdout.readline()
+            response = json.loads(line) if line else None
+        except (OSError, ValueError):
+            response = None
+        if not isinstance(response, dict) or "exit_code" not in response:
+            self.close()
+            raise _ServeUnsupported(f"{self.cli_path} does not support serve")
+    
+    def is_usable(self, cli_path: str) -> bool:
+        """
+        Child is alive and matches the executable, working directory and
+        environment a one-shot run would get now (e.g. NX_MONITOR_SOCKET).
+        """
+        return (self._process.poll() is None
+                and self.cli_path == cli_path
+                and self.cwd == os.getcwd()
+                and self.env == dict(os.environ))
+    
+    def invoke(self, args: List[str]) -> Tuple[int, str, str]:
+        request_id = self._next_id
+        self._next_id += 1
+        request = json.dumps({"id": request_id, "args": args})
+        try:
+            self._process.stdin.write(request + "\n")
+            self._process.stdin.flush()
+        except (OSError, ValueError) as e:
+            # Child was gone before it could read this request
+            raise _SessionError(f"serve session write failed: {e}", request_sent=False)
         
-    Raises:
-        CLIError: CLI returned non-zero exit code
-        CLIOutputError: CLI output was not valid JSON
+        try:
+            line = self._process.stdout.readline()
+        except (OSError, ValueError) as e:
+            raise _SessionError(f"serve session read failed: {e}", request_sent=True)
+        if not line:
+            try:
+                status = self._process.wait(timeout=1)
+            except subprocess.TimeoutExpired:
+                status = None
+            raise _SessionError(f"serve session closed during request (status {status})",
+                                request_sent=True)
+        try:
+            response = json.loads(line)
+            if response.get("id") != request_id:
+                raise _SessionError("serve response out of order", request_sent=True)
+            return response["exit_code"], response["stdout"], response["stderr"]
+        except (json.JSONDecodeError, AttributeError, KeyError) as e:
+            raise _SessionError(f"invalid serve response: {e}", request_sent=True)
+    
+    def close(self):
+        try:
+            self._process.stdin.close()
+            self._process.wait(timeout=5)
+        except (OSError, ValueError, subprocess.TimeoutExpired):
+            self._process.kill()
+            self._process.wait()
+
+
+_session: Optional[_CliSession] = None
+_session_lock = threading.Lock()
+_session_unsupported = False
+
+
+def _close_session():
+    global _session
+    with _session_lock:
+        if _session is not None:
+            _session.close()
+            _session = None
+
+
+atexit.register(_close_session)
+
+
+def _run_cli(args: List[str]) -> Tuple[int, str, str]:
     """
+    Run one CLI command, returning (exit_code, stdout, stderr).
+    
+    Uses the shared serve session, restarting it when the child has exited
+    or the working directory or environment changed. Falls back to a one-shot
+    process when the executable does not support `serve` or the session failed
+    before the request was written. If the child failed after receiving the
+    request (crash, garbled response), the failure is returned and the command
+    is not run again, since it may already have taken effect.
+    """
+    global _session, _session_unsupported
+    
     # Resolve CLI executable path
     cli_path = find_nx_cli_executable()
     
-    # Use exact arguments - no global flag injection
-    cmd = [cli_path] + args
+    with _session_lock:
+        if not _session_unsupported:
+            try:
+                if _session is None or not _session.is_usable(cli_path):
+                    if _session is not None:
+                        _session.close()
+                        _session = None
+                    _session = _CliSession(cli_path)
+                return _session.invoke(args)
+            except _ServeUnsupported:
+                _session_unsupported = True
+            except _SessionError as e:
+                _session.close()
+                _session = None
+                if e.request_sent:
+                    return _SESSION_FAILURE_EXIT_CODE, "", f"nx-cli serve session failed: {e}\n"
     
+    # Use exact arguments - no global flag injection
     result = subprocess.run(
-        cmd,
+        [cli_path] + args,
         capture_output=True,
         text=True,
         check=False  # Handle exit codes manually
     )
+    return result.returncode, result.stdout, result.stderr
+
+
+def invoke_cli(args: List[str]) -> Dict[str, Any]:
+    """
+    Invoke nx CLI with given arguments and return parsed JSON output.
     
-    if result.returncode != 0:
-        raise CLIError(result.returncode, result.stderr.strip())
+    Args:
+        args: CLI arguments (excluding 'nx' binary name)
+        
+    Returns:
+        Parsed JSON output as dict
+        
+    Raises:
+        CLIError: CLI returned non-zero exit code
+        CLIOutputError: CLI output was not valid JSON
+    """
+    exit_code, stdout, stderr = _run_cli(args)
+    
+    if exit_code != 0:
+        raise CLIError(exit_code, stderr.strip())
     
     try:
-        return json.loads(result.stdout)
+        return json.loads(stdout)
     except json.JSONDecodeError as e:
         raise CLIOutputError(f"Invalid JSON from CLI: {e}")
 
@@ -72,19 +242,9 @@ def invoke_cli_raw(args: List[str]) -> str:
     Raises:
         CLIError: CLI returned non-zero exit code
     """
-    # Resolve CLI executable path
-    cli_path = find_nx_cli_executable()
-    
-    cmd = [cli_path] + args
-    
-    result = subprocess.run(
-        cmd,
-        capture_output=True,
-        text=True,
-        check=False
-    )
+    exit_code, stdout, stderr = _run_cli(args)
     
-    if result.returncode != 0:
-        raise CLIError(result.returncode, result.stderr.strip())
+    if exit_code != 0:
+        raise CLIError(exit_code, stderr.strip())
     
-    return result.stdout
\ No newline at end of file
+    return stdout
\ No newline at end of file